@@ -0,0 +1,102 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       WorkerPool.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Core/Thread
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_WORKER_POOL_HPP__
+#define CARDINAL_ENGINE_WORKER_POOL_HPP__
+
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class WorkerPool
+/// \brief Persistent threads running indexed jobs
+///        The calling thread takes part in the work and
+///        ParallelFor only returns once every job is done
+class WorkerPool
+{
+public:
+
+    /// \brief A job, called with the index of the job
+    typedef std::function<void(int)> Job;
+
+public:
+
+    /// \brief Constructor
+    WorkerPool();
+
+    /// \brief Destructor, stops the workers
+    ~WorkerPool();
+
+    /// \brief Starts the workers
+    /// \param threadCount The number of threads working on jobs, including
+    ///        the calling thread. 0 means one thread per hardware thread.
+    void Initialize(size_t threadCount);
+
+    /// \brief Stops and joins the workers
+    void Shutdown();
+
+    /// \brief Runs the jobs [0, count) and waits for their completion
+    ///        Not reentrant, the jobs must not call ParallelFor
+    /// \param count The number of jobs
+    /// \param job The job to run
+    void ParallelFor(int count, Job const& job);
+
+    /// \brief Returns the number of threads working on jobs, including the caller
+    size_t GetThreadCount() const;
+
+private:
+
+    /// \brief Worker loop, waits for a batch of jobs and helps on it
+    /// \param firstBatch The last batch run before the worker started
+    void WorkerLoop(uint64_t firstBatch);
+
+    /// \brief Runs the jobs of the current batch until there is none left
+    void RunJobs();
+
+private:
+
+    std::vector<std::thread> m_workers;
+    std::mutex               m_mutex;
+    std::condition_variable  m_wakeCondition;
+    std::condition_variable  m_doneCondition;
+
+    Job const *       m_pJob;       ///< The job of the current batch
+    int               m_jobCount;   ///< The number of jobs of the current batch
+    std::atomic<int>  m_nextJob;    ///< The next job to run
+    std::atomic<int>  m_doneJobs;   ///< The number of completed jobs
+    uint64_t          m_batch;      ///< Incremented at each batch to wake the workers
+    int               m_busyWorkers;///< Workers still inside the current batch
+    bool              m_bStop;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_WORKER_POOL_HPP__
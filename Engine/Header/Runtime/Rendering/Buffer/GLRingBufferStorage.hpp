@@ -0,0 +1,89 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       GLRingBufferStorage.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_GL_RING_BUFFER_STORAGE_HPP__
+#define CARDINAL_ENGINE_GL_RING_BUFFER_STORAGE_HPP__
+
+#include "Runtime/Rendering/Buffer/IRingBufferStorage.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class GLRingBufferStorage
+/// \brief OpenGL storage of a ring buffer
+///        Persistently and coherently mapped with ARB_buffer_storage,
+///        falls back on unsynchronized glMapBufferRange calls otherwise
+class GLRingBufferStorage : public IRingBufferStorage
+{
+public:
+
+    /// \brief Constructor
+    /// \param target The GL binding target of the buffer
+    explicit GLRingBufferStorage(uint target);
+
+    /// \brief Destructor
+    ~GLRingBufferStorage() override;
+
+    /// \brief  (Re)creates the storage, the previous content is lost
+    /// \param  size The size in bytes
+    /// \return True on success
+    bool Allocate(size_t size) final;
+
+    /// \brief Releases the storage
+    void Release() final;
+
+    /// \brief  Returns a pointer to write a range of the storage
+    /// \param  offset The offset of the range in bytes
+    /// \param  size The size of the range in bytes
+    /// \return The pointer, valid until UnmapRange
+    void * MapRange(size_t offset, size_t size) final;
+
+    /// \brief Makes the written range visible to the GPU
+    /// \param offset The offset of the range in bytes
+    /// \param size The size of the range in bytes
+    void UnmapRange(size_t offset, size_t size) final;
+
+    /// \brief  Inserts a fence after the commands issued so far
+    /// \return The fence
+    Fence InsertFence() final;
+
+    /// \brief  Blocks until the fence is signaled, then deletes it
+    /// \param  fence The fence to wait for
+    /// \return True if the fence was not signaled yet
+    bool WaitFence(Fence fence) final;
+
+    /// \brief Returns the GL name of the buffer
+    uint GetBufferID() const final;
+
+private:
+
+    uint   m_target;
+    uint   m_buffer;
+    bool   m_bPersistent;  ///< The buffer is mapped once for its whole life
+    uchar* m_pMapping;     ///< The persistent mapping
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_GL_RING_BUFFER_STORAGE_HPP__
@@ -0,0 +1,84 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       IRingBufferStorage.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_I_RING_BUFFER_STORAGE_HPP__
+#define CARDINAL_ENGINE_I_RING_BUFFER_STORAGE_HPP__
+
+#include <cstddef>
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class IRingBufferStorage
+/// \brief Memory and synchronization behind a RingBuffer
+///        The ring logic only goes through this interface,
+///        so it can run on a CPU only implementation
+class IRingBufferStorage
+{
+public:
+
+    /// \brief Opaque fence handle, nullptr is no fence
+    typedef void * Fence;
+
+public:
+
+    /// \brief Destructor
+    virtual ~IRingBufferStorage() = default;
+
+    /// \brief  (Re)creates the storage, the previous content is lost
+    /// \param  size The size in bytes
+    /// \return True on success
+    virtual bool Allocate(size_t size) = 0;
+
+    /// \brief Releases the storage
+    virtual void Release() = 0;
+
+    /// \brief  Returns a pointer to write a range of the storage
+    /// \param  offset The offset of the range in bytes
+    /// \param  size The size of the range in bytes
+    /// \return The pointer, valid until UnmapRange
+    virtual void * MapRange(size_t offset, size_t size) = 0;
+
+    /// \brief Makes the written range visible to the GPU
+    /// \param offset The offset of the range in bytes
+    /// \param size The size of the range in bytes
+    virtual void UnmapRange(size_t offset, size_t size) = 0;
+
+    /// \brief  Inserts a fence after the commands issued so far
+    /// \return The fence
+    virtual Fence InsertFence() = 0;
+
+    /// \brief  Blocks until the fence is signaled, then deletes it
+    /// \param  fence The fence to wait for
+    /// \return True if the fence was not signaled yet
+    virtual bool WaitFence(Fence fence) = 0;
+
+    /// \brief Returns the GL name of the buffer, 0 without GL
+    virtual uint GetBufferID() const = 0;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_I_RING_BUFFER_STORAGE_HPP__
@@ -0,0 +1,106 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RingBuffer.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_RING_BUFFER_HPP__
+#define CARDINAL_ENGINE_RING_BUFFER_HPP__
+
+#include "Runtime/Rendering/Buffer/IRingBufferStorage.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class RingBuffer
+/// \brief Triple buffered stream of dynamic data
+///        Each Map writes the next region of the buffer. The region left
+///        is fenced, and a region is only written again once the GPU is
+///        done with it, so the CPU never waits on a buffer in use.
+class RingBuffer
+{
+public:
+
+    static const int s_regionCount = 3;
+
+public:
+
+    /// \brief Constructor
+    RingBuffer();
+
+    /// \brief Destructor
+    ~RingBuffer();
+
+    /// \brief Initializes the ring
+    /// \param pStorage The storage of the ring, owned by the ring
+    /// \param regionSize The size of a region in bytes
+    /// \return True on success
+    bool Initialize(IRingBufferStorage * pStorage, size_t regionSize);
+
+    /// \brief Waits for the GPU and releases the storage
+    void Release();
+
+    /// \brief  Grows the regions, waits for the GPU if needed
+    /// \param  regionSize The minimal size of a region in bytes
+    /// \return True if the storage was reallocated
+    bool Reserve(size_t regionSize);
+
+    /// \brief  Fences the current region and maps the next one
+    /// \param  size The number of bytes to write, at most the region size
+    /// \return The pointer to write
+    void * Map(size_t size);
+
+    /// \brief Ends the writes started by Map
+    void Unmap();
+
+    /// \brief Returns the offset of the current region in bytes
+    size_t GetOffset() const;
+
+    /// \brief Returns the size of a region in bytes
+    size_t GetRegionSize() const;
+
+    /// \brief Returns the GL name of the buffer
+    uint GetBufferID() const;
+
+    /// \brief Returns the number of writes that had to wait for the GPU
+    uint64 GetWaitCount() const;
+
+private:
+
+    /// \brief Waits for all regions
+    void WaitAll();
+
+private:
+
+    static const size_t s_alignment = 256; ///< Region alignment, safe for all attributes
+
+    IRingBufferStorage *      m_pStorage;
+    IRingBufferStorage::Fence m_fences[s_regionCount];
+    size_t                    m_regionSize;
+    size_t                    m_mappedSize;
+    int                       m_region;
+    bool                      m_bWritten;  ///< The current region may be read by the GPU
+    uint64                    m_waitCount;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_RING_BUFFER_HPP__
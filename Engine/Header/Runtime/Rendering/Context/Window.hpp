@@ -58,6 +58,16 @@ public:
     /// \return A pointer on the glfw window
     GLFWwindow * GetContext() const;
 
+    /// \brief  Returns the size of the window in screen coordinates
+    /// \param  width The width of the window
+    /// \param  height The height of the window
+    void GetSize(int & width, int & height) const;
+
+    /// \brief  Returns the size of the window in pixels
+    /// \param  width The width of the frame buffer
+    /// \param  height The height of the frame buffer
+    void GetFramebufferSize(int & width, int & height) const;
+
 private:
 
     /// \brief Destroy the current OpenGL context
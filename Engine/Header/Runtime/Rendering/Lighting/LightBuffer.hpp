@@ -0,0 +1,117 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightBuffer.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_LIGHT_BUFFER_HPP__
+#define CARDINAL_ENGINE_LIGHT_BUFFER_HPP__
+
+#include <cstddef>
+#include "Glm/glm/glm.hpp"
+#include "Runtime/Platform/Configuration/Type.hh"
+#include "Runtime/Rendering/Lighting/LightStructure.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class LightBuffer
+/// \brief CPU image of the std140 "Lights" uniform block
+///
+///        layout(std140) uniform Lights
+///        {
+///            vec3       lightDirection;    // 0
+///            float      lightIntensity;    // 12
+///            vec3       lightColor;        // 16
+///            float      ambientIntensity;  // 28
+///            int        pointLightCount;   // 32
+///            ivec4      clusterGrid;       // 48, clusters per axis and enabled flag
+///            vec4       clusterTile;       // 64, tile size in pixels, depth scale and bias
+///            PointLight pointLights[256];  // 80, stride 48
+///        };
+///
+///        struct PointLight { float range; float intensity; vec3 color; vec3 position; };
+///        range at 0, intensity at 4, color at 16, position at 32
+class LightBuffer
+{
+public:
+
+    static const int    s_maxPointLights     = 256;
+    static const uint   s_bindingPoint       = 0;   ///< The uniform buffer binding of the block
+    static const size_t s_pointLightOffset   = 80;
+    static const size_t s_pointLightStride   = 48;
+    static const size_t s_capacity           = s_pointLightOffset + s_maxPointLights * s_pointLightStride;
+
+public:
+
+    /// \brief Constructor, no light
+    LightBuffer();
+
+    /// \brief Sets the directional light
+    /// \param direction The direction of the light
+    /// \param intensity The intensity of the light
+    /// \param ambient The ambient intensity
+    /// \param color The color of the light
+    void SetDirectionalLight(glm::vec3 const& direction, float intensity, float ambient, glm::vec3 const& color);
+
+    /// \brief Sets a point light
+    /// \param index The index of the light, below s_maxPointLights
+    /// \param light The light
+    void SetPointLight(int index, PointLightStructure const& light);
+
+    /// \brief Sets the clustered lighting parameters
+    /// \param grid The number of clusters per axis, w enables the clusters
+    /// \param tile The size of a tile in pixels, the depth slicing scale and bias
+    void SetClusters(glm::ivec4 const& grid, glm::vec4 const& tile);
+
+    /// \brief Sets the number of point lights, clamped to s_maxPointLights
+    /// \param count The number of point lights
+    void SetPointLightCount(int count);
+
+    /// \brief Returns the number of point lights
+    int GetPointLightCount() const;
+
+    /// \brief Returns the packed block
+    uchar const * GetData() const;
+
+    /// \brief Returns the size in bytes of the packed block up to the last point light
+    size_t GetSize() const;
+
+private:
+
+    /// \brief Writes a float at the given offset
+    void WriteFloat(size_t offset, float value);
+
+    /// \brief Writes a vec3 at the given offset
+    void WriteVec3(size_t offset, glm::vec3 const& value);
+
+    /// \brief Writes an int at the given offset
+    void WriteInt(size_t offset, int value);
+
+private:
+
+    uchar m_data[s_capacity];
+    int   m_pointLightCount;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_LIGHT_BUFFER_HPP__
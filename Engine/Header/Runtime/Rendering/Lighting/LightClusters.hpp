@@ -0,0 +1,113 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightClusters.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_LIGHT_CLUSTERS_HPP__
+#define CARDINAL_ENGINE_LIGHT_CLUSTERS_HPP__
+
+#include <vector>
+#include "Glm/glm/glm.hpp"
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class LightClusters
+/// \brief Assigns point lights to the clusters of the view frustum
+///        The frustum is split in screen tiles and exponential depth slices.
+///        Each cluster gets the list of the lights whose sphere touches it.
+///        CPU only, the light manager uploads the result.
+class LightClusters
+{
+public:
+
+    static const int s_clusterX     = 16;
+    static const int s_clusterY     = 9;
+    static const int s_clusterZ     = 24;
+    static const int s_clusterCount = s_clusterX * s_clusterY * s_clusterZ;
+
+public:
+
+    /// \brief Constructor
+    LightClusters();
+
+    /// \brief Sets the perspective projection, rebuilds the clusters if it changed
+    /// \param projection The projection matrix
+    void SetProjection(glm::mat4 const& projection);
+
+    /// \brief Assigns the lights to the clusters
+    /// \param view The view matrix
+    /// \param pPositions The world positions of the lights
+    /// \param pRanges The ranges of the lights
+    /// \param count The number of lights
+    void Assign(glm::mat4 const& view, glm::vec3 const * pPositions, float const * pRanges, int count);
+
+    /// \brief Returns the offset and the count of the lights of each cluster, interleaved
+    std::vector<uint> const& GetCells() const;
+
+    /// \brief Returns the light indices of all clusters
+    std::vector<uint> const& GetLightIndices() const;
+
+    /// \brief Returns the index of a cluster
+    static int GetClusterIndex(int x, int y, int z);
+
+    /// \brief Returns the depth slice of a view depth, slice = log(depth) * scale + bias
+    int GetSlice(float depth) const;
+
+    /// \brief Returns the scale of the depth slicing
+    float GetDepthScale() const;
+
+    /// \brief Returns the bias of the depth slicing
+    float GetDepthBias() const;
+
+    /// \brief Returns the view space bounds of a cluster
+    /// \param cluster The index of the cluster
+    /// \param min The min corner
+    /// \param max The max corner
+    void GetClusterBounds(int cluster, glm::vec3 & min, glm::vec3 & max) const;
+
+    /// \brief  Tests a sphere against the view space bounds of a cluster
+    /// \return True if they intersect
+    bool Intersects(int cluster, glm::vec3 const& center, float radius) const;
+
+private:
+
+    glm::mat4              m_projection;
+    float                  m_near;
+    float                  m_far;
+    float                  m_tanX;         ///< Half width of the frustum at depth 1
+    float                  m_tanY;         ///< Half height of the frustum at depth 1
+    float                  m_depthScale;
+    float                  m_depthBias;
+    std::vector<float>     m_sliceDepth;   ///< Near depth of each slice, one extra entry
+    std::vector<glm::vec3> m_clusterMin;   ///< View space bounds
+    std::vector<glm::vec3> m_clusterMax;   ///< View space bounds
+
+    std::vector<uint>      m_cells;
+    std::vector<uint>      m_lightIndices;
+    std::vector<uint>      m_pairs;        ///< Light and cluster of each hit, packed
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_LIGHT_CLUSTERS_HPP__
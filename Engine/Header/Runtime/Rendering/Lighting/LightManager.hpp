@@ -25,6 +25,9 @@
 #define CARDINAL_ENGINE_LIGHT_MANAGER_HPP__
 
 #include <vector>
+#include "Runtime/Rendering/Lighting/LightBuffer.hpp"
+#include "Runtime/Rendering/Lighting/LightClusters.hpp"
+#include "Runtime/Rendering/Lighting/PointLightGrid.hpp"
 #include "Runtime/Rendering/Lighting/LightStructure.hpp"
 
 /// \namespace cardinal
@@ -37,6 +40,10 @@ class LightManager
 {
 public:
 
+    static const int s_nearestLightCount  = 4; ///< The lights shaded per object
+    static const int s_clusterCellsUnit   = 6; ///< Texture unit of the clusters offsets and counts
+    static const int s_clusterLightsUnit  = 7; ///< Texture unit of the clusters light indices
+
     /// \brief Initializes the light manager
     static void Initialize();
 
@@ -61,17 +68,29 @@ public:
     /// \param pLight The pointer on the light to release
     static void ReleasePointLight(class PointLight *& pLight);
 
-    /// \brief Searches the 4 nearest point lights from the given position
-    /// \param A vector of point light structures
-    static std::vector<PointLightStructure> GetNearestPointLights(glm::vec3 const& position);
+    /// \brief  Searches the nearest point lights from the given position
+    ///         Only valid after OnRenderBegin, the lights are indexed once per frame
+    /// \param  position The position
+    /// \param  pLights The lights, by increasing distance
+    /// \param  maxCount The size of pLights, at most PointLightGrid::s_maxQueryCount
+    /// \return The number of lights written
+    static int GetNearestPointLights(glm::vec3 const& position, PointLightStructure * pLights, int maxCount);
 
 private:
 
     friend class RenderingEngine;
 
     /// \brief Called just before rendering
-    ////       to updates uniforms in shader
-    static void OnRenderBegin();
+    ///        Uploads all lights in the lights uniform block and indexes them
+    /// \param projection The projection matrix of the main pass
+    /// \param view The view matrix of the main pass
+    /// \param width The width of the main pass viewport
+    /// \param height The height of the main pass viewport
+    /// \param bClustered Assigns the lights to the view clusters
+    static void OnRenderBegin(glm::mat4 const& projection, glm::mat4 const& view, int width, int height, bool bClustered);
+
+    /// \brief Assigns the lights to the view clusters and uploads them
+    static void UpdateClusters(glm::mat4 const& projection, glm::mat4 const& view, int width, int height);
 
     /// \brief Returns all points lights
     /// \return A vector of point lights
@@ -85,6 +104,14 @@ private:
 
     class DirectionalLight *        m_pDirectional;
     std::vector<class PointLight *> m_pointLights;
+    LightBuffer                     m_lightBuffer;
+    PointLightGrid                  m_lightGrid;      ///< Over the lights of m_lightBuffer
+    uint                            m_uniformBuffer = 0; ///< Bound to LightBuffer::s_bindingPoint
+    LightClusters                   m_clusters;
+    uint                            m_clusterCellsBuffer   = 0;
+    uint                            m_clusterCellsTexture  = 0;
+    uint                            m_clusterLightsBuffer  = 0;
+    uint                            m_clusterLightsTexture = 0;
 };
 
 } // !namespace
@@ -37,6 +37,7 @@ struct PointLightStructure
     float     intensity;
     glm::vec3 color;
     glm::vec3 position;
+    int       index;     ///< The index of the light in the lights uniform block
 };
 
 } // !namespace
@@ -0,0 +1,85 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PointLightGrid.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_POINT_LIGHT_GRID_HPP__
+#define CARDINAL_ENGINE_POINT_LIGHT_GRID_HPP__
+
+#include <vector>
+#include "Glm/glm/glm.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class PointLightGrid
+/// \brief Uniform grid over the point lights positions
+///        Rebuilt once per frame, answers nearest lights queries by
+///        visiting cells in growing shells around the query position
+class PointLightGrid
+{
+public:
+
+    static const int s_maxResolution = 64; ///< Cells per axis
+    static const int s_maxQueryCount = 16; ///< Max lights returned by a query
+
+public:
+
+    /// \brief Constructor, empty grid
+    PointLightGrid();
+
+    /// \brief Builds the grid, about 2 lights per cell
+    /// \param pPositions The positions of the lights
+    /// \param count The number of lights
+    void Build(glm::vec3 const * pPositions, int count);
+
+    /// \brief  Searches the nearest lights from a position
+    /// \param  position The position
+    /// \param  maxCount The max number of lights to return, at most s_maxQueryCount
+    /// \param  pIndices The indices of the lights, by increasing distance
+    /// \return The number of lights written
+    int QueryNearest(glm::vec3 const& position, int maxCount, int * pIndices) const;
+
+    /// \brief Returns the number of lights in the grid
+    int GetLightCount() const;
+
+private:
+
+    /// \brief Returns the cell of a position, clamped to the grid
+    glm::ivec3 GetCell(glm::vec3 const& position) const;
+
+    /// \brief Returns the index of a cell
+    int GetCellIndex(int x, int y, int z) const;
+
+private:
+
+    std::vector<glm::vec3> m_positions;
+    std::vector<int>       m_cellStart;  ///< First light of each cell in m_cellLights, one extra entry
+    std::vector<int>       m_cellLights; ///< Light indices sorted by cell
+    glm::vec3              m_origin;
+    glm::ivec3             m_resolution;
+    float                  m_cellSize;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_POINT_LIGHT_GRID_HPP__
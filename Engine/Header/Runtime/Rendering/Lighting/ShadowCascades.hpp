@@ -0,0 +1,116 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ShadowCascades.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_SHADOW_CASCADES_HPP__
+#define CARDINAL_ENGINE_SHADOW_CASCADES_HPP__
+
+#include "Glm/glm/glm.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class ShadowCascades
+/// \brief Splits the camera frustum in depth slices and fits a directional
+///        light orthographic projection around each of them.
+///        Each projection encloses the bounding sphere of its slice, so its size
+///        does not change with the camera rotation, and is snapped to the shadow
+///        map texels to avoid shimmering. CPU only, the rendering engine owns the maps.
+class ShadowCascades
+{
+public:
+
+    static const int s_maxCascades = 4;
+
+public:
+
+    /// \brief Constructor, 3 cascades of 1024x1024 texels
+    ShadowCascades();
+
+    /// \brief Sets the number of cascades and the size of their maps
+    /// \param cascadeCount The number of cascades, from 1 to s_maxCascades
+    /// \param resolution The width and height of each map in texels
+    void Configure(int cascadeCount, int resolution);
+
+    /// \brief Sets the view depth covered by the cascades
+    /// \param distance The distance, clamped to the camera far plane
+    void SetShadowDistance(float distance);
+
+    /// \brief Sets the blend between uniform (0) and logarithmic (1) splits
+    /// \param lambda The blend factor
+    void SetSplitLambda(float lambda);
+
+    /// \brief Sets the distance before a slice where the casters are kept
+    /// \param distance The distance toward the light
+    void SetCasterDistance(float distance);
+
+    /// \brief Fits the cascades to the camera frustum
+    /// \param projection The perspective projection of the camera
+    /// \param view The view matrix of the camera
+    /// \param lightDirection The direction of the light
+    void Update(glm::mat4 const& projection, glm::mat4 const& view, glm::vec3 const& lightDirection);
+
+    /// \brief  Computes the split depths of the cascades
+    ///         split = lambda * near * (far / near)^(i / n) + (1 - lambda) * (near + (far - near) * i / n)
+    /// \param  near The near plane of the camera
+    /// \param  far The last depth covered by the cascades
+    /// \param  count The number of cascades
+    /// \param  lambda The blend between uniform and logarithmic splits
+    /// \param  pSplits Receives count + 1 depths, from near to far
+    static void ComputeSplits(float near, float far, int count, float lambda, float * pSplits);
+
+    /// \brief  Computes the minimal bounding sphere of a slice of a symmetric frustum
+    /// \param  tanX The half width of the frustum at depth 1
+    /// \param  tanY The half height of the frustum at depth 1
+    /// \param  near The near depth of the slice
+    /// \param  far The far depth of the slice
+    /// \param  radius Receives the radius of the sphere
+    /// \return The view depth of the center of the sphere
+    static float ComputeSliceSphere(float tanX, float tanY, float near, float far, float & radius);
+
+    /// \brief Returns the number of cascades
+    int GetCascadeCount() const;
+
+    /// \brief Returns the size of the cascades maps in texels
+    int GetResolution() const;
+
+    /// \brief Returns the light projection view matrix of a cascade
+    glm::mat4 const& GetMatrix(int cascade) const;
+
+    /// \brief Returns a split depth, the cascade i covers [split(i), split(i + 1)]
+    float GetSplit(int index) const;
+
+private:
+
+    int       m_cascadeCount;
+    int       m_resolution;
+    float     m_shadowDistance;
+    float     m_splitLambda;
+    float     m_casterDistance;
+    float     m_splits  [s_maxCascades + 1]; ///< View depths
+    glm::mat4 m_matrices[s_maxCascades];     ///< Light projection view matrices
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_SHADOW_CASCADES_HPP__
@@ -0,0 +1,92 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BoundingBox.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_BOUNDING_BOX_HPP__
+#define CARDINAL_ENGINE_BOUNDING_BOX_HPP__
+
+#include <vector>
+#include <limits>
+
+#include "Glm/glm/glm.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class BoundingBox
+/// \brief Axis aligned bounding box
+///        A default constructed box is empty and is never culled
+class BoundingBox
+{
+public :
+
+    /// \brief Default constructor, creates an empty box
+    inline BoundingBox();
+
+    /// \brief Constructor
+    /// \param min The min corner of the box
+    /// \param max The max corner of the box
+    inline BoundingBox(glm::vec3 const& min, glm::vec3 const& max);
+
+    /// \brief Empties the box
+    inline void Reset();
+
+    /// \brief Grows the box to contain the given point
+    /// \param point The point to enclose
+    inline void Enclose(glm::vec3 const& point);
+
+    /// \brief Grows the box to contain the given points
+    /// \param points The points to enclose
+    inline void Enclose(std::vector<glm::vec3> const& points);
+
+    /// \brief  Returns the box enclosing this box transformed by the matrix
+    /// \param  transform The affine transformation to apply
+    /// \return The transformed box, empty if this box is empty
+    inline BoundingBox Transform(glm::mat4 const& transform) const;
+
+    /// \brief Tells if the box encloses at least one point
+    inline bool IsEmpty() const;
+
+    /// \brief Returns the min corner of the box
+    inline glm::vec3 const& GetMin() const;
+
+    /// \brief Returns the max corner of the box
+    inline glm::vec3 const& GetMax() const;
+
+    /// \brief Returns the center of the box
+    inline glm::vec3 GetCenter() const;
+
+    /// \brief Returns the half size of the box
+    inline glm::vec3 GetExtents() const;
+
+private:
+
+    glm::vec3 m_min;
+    glm::vec3 m_max;
+};
+
+} // !namespace
+
+#include "Impl/BoundingBox.inl"
+
+#endif // !CARDINAL_ENGINE_BOUNDING_BOX_HPP__
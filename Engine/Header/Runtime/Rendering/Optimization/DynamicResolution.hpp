@@ -0,0 +1,99 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       DynamicResolution.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_DYNAMIC_RESOLUTION_HPP__
+#define CARDINAL_ENGINE_DYNAMIC_RESOLUTION_HPP__
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class DynamicResolution
+/// \brief Scales the internal render resolution from the measured GPU frame time
+///        The scale drops as soon as the frame is over budget and only climbs back
+///        when there is enough headroom, so it does not oscillate around the target.
+class DynamicResolution
+{
+public:
+
+    static const int s_cooldownFrames = 30; ///< Samples ignored after a change, timings lag a few frames
+    static const int s_warmupFrames   = 10; ///< Samples averaged before the first decision
+
+    static constexpr float s_scaleStep      = 0.05f; ///< Scales are multiples of this step
+    static constexpr float s_upperThreshold = 1.00f; ///< Fraction of the budget above which the scale drops
+    static constexpr float s_lowerThreshold = 0.80f; ///< Fraction of the budget under which the scale climbs
+    static constexpr float s_smoothing      = 0.10f; ///< Weight of a new sample in the average
+
+public:
+
+    /// \brief Constructor, targets 60 fps between half and full resolution
+    DynamicResolution();
+
+    /// \brief Sets the frame time to hold and the range of the scale
+    /// \param targetFrameTime The GPU time budget of a frame in milliseconds
+    /// \param minScale The lowest scale of each axis
+    /// \param maxScale The highest scale of each axis
+    void Configure(float targetFrameTime, float minScale, float maxScale);
+
+    /// \brief Goes back to the highest scale and forgets the samples
+    void Reset();
+
+    /// \brief  Feeds a measured GPU frame time
+    /// \param  frameTime The GPU time of a frame in milliseconds
+    /// \return True if the scale changed
+    bool Update(float frameTime);
+
+    /// \brief Returns the current scale of each axis
+    float GetScale() const;
+
+    /// \brief Returns the averaged GPU frame time in milliseconds
+    float GetAverageFrameTime() const;
+
+    /// \brief Returns the GPU time budget of a frame in milliseconds
+    float GetTargetFrameTime() const;
+
+    /// \brief  Returns the render size of an axis
+    /// \param  size The window size of the axis
+    /// \param  scale The scale of the axis
+    /// \return The scaled size, at least 1
+    static int ComputeRenderSize(int size, float scale);
+
+private:
+
+    /// \brief Clamps a scale in the range and snaps it to the steps
+    float ClampScale(float scale) const;
+
+private:
+
+    float m_targetFrameTime;
+    float m_minScale;
+    float m_maxScale;
+    float m_scale;
+    float m_averageFrameTime;
+    int   m_sampleCount;
+    int   m_cooldown;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_DYNAMIC_RESOLUTION_HPP__
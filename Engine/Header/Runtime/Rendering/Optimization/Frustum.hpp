@@ -0,0 +1,78 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       Frustum.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_FRUSTUM_HPP__
+#define CARDINAL_ENGINE_FRUSTUM_HPP__
+
+#include "Glm/glm/glm.hpp"
+#include "Runtime/Rendering/Optimization/BoundingBox.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class Frustum
+/// \brief The six planes of a view volume, used to cull renderers
+///        on the CPU before issuing their draw calls
+class Frustum
+{
+public :
+
+    /// \brief Default constructor, the frustum contains everything
+    inline Frustum();
+
+    /// \brief Constructor, extracts the planes of the given matrix
+    /// \param projectionView The projection view matrix of the volume
+    inline explicit Frustum(glm::mat4 const& projectionView);
+
+    /// \brief Extracts the planes of the view volume (Gribb & Hartmann)
+    ///        Works for both perspective and orthographic projections
+    /// \param projectionView The projection view matrix of the volume
+    inline void Extract(glm::mat4 const& projectionView);
+
+    /// \brief  Tells if a world space box is at least partially inside the volume
+    ///         The test is conservative, a box may be kept while being outside
+    ///         near the corners of the frustum. Empty boxes are always visible.
+    /// \param  box The box to test
+    /// \return False if the box is fully outside one of the planes
+    inline bool IsVisible(BoundingBox const& box) const;
+
+    /// \brief  Tells if a point is inside the volume
+    /// \param  point The point to test
+    inline bool IsVisible(glm::vec3 const& point) const;
+
+private:
+
+    enum EPlane
+    {
+        Left = 0, Right, Bottom, Top, Near, Far, Count
+    };
+
+    glm::vec4 m_planes[EPlane::Count]; ///< Normalized planes, xyz is the inward normal
+};
+
+} // !namespace
+
+#include "Impl/Frustum.inl"
+
+#endif // !CARDINAL_ENGINE_FRUSTUM_HPP__
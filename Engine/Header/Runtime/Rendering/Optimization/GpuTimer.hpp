@@ -0,0 +1,73 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       GpuTimer.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_GPU_TIMER_HPP__
+#define CARDINAL_ENGINE_GPU_TIMER_HPP__
+
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class GpuTimer
+/// \brief Measures the GPU time of frames with a ring of timer queries
+///        Results are read a few frames later, once available, so the CPU
+///        never waits for the GPU. A frame is not measured if the ring is full.
+class GpuTimer
+{
+public:
+
+    static const int s_queryCount = 4; ///< Frames in flight
+
+    /// \brief Constructor
+    GpuTimer();
+
+    /// \brief Creates the queries
+    void Initialize();
+
+    /// \brief Deletes the queries
+    void Release();
+
+    /// \brief Starts measuring a frame
+    void Begin();
+
+    /// \brief Stops measuring the frame
+    void End();
+
+    /// \brief  Collects the finished measures
+    /// \param  frameTime The GPU time of the last finished frame in milliseconds
+    /// \return True if at least one frame finished since the last call
+    bool Read(float & frameTime);
+
+private:
+
+    uint m_queries[s_queryCount];
+    bool m_bPending[s_queryCount]; ///< The query waits for its result
+    int  m_current;                ///< The next query to issue
+    bool m_bMeasuring;             ///< Begin issued the current query
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_GPU_TIMER_HPP__
@@ -0,0 +1,122 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BoundingBox.inl
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Rendering/Optimization/Impl
+/// \author     Vincent STEHLY--CALISTO
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Default constructor, creates an empty box
+inline BoundingBox::BoundingBox()
+{
+    Reset();
+}
+
+/// \brief Constructor
+/// \param min The min corner of the box
+/// \param max The max corner of the box
+inline BoundingBox::BoundingBox(glm::vec3 const& min, glm::vec3 const& max)
+: m_min(min)
+, m_max(max)
+{
+    // None
+}
+
+/// \brief Empties the box
+inline void BoundingBox::Reset()
+{
+    m_min = glm::vec3( std::numeric_limits<float>::max());
+    m_max = glm::vec3(-std::numeric_limits<float>::max());
+}
+
+/// \brief Grows the box to contain the given point
+/// \param point The point to enclose
+inline void BoundingBox::Enclose(glm::vec3 const& point)
+{
+    m_min = glm::min(m_min, point);
+    m_max = glm::max(m_max, point);
+}
+
+/// \brief Grows the box to contain the given points
+/// \param points The points to enclose
+inline void BoundingBox::Enclose(std::vector<glm::vec3> const& points)
+{
+    for(glm::vec3 const& point : points)
+    {
+        Enclose(point);
+    }
+}
+
+/// \brief  Returns the box enclosing this box transformed by the matrix
+/// \param  transform The affine transformation to apply
+/// \return The transformed box, empty if this box is empty
+inline BoundingBox BoundingBox::Transform(glm::mat4 const& transform) const
+{
+    if(IsEmpty())
+    {
+        return BoundingBox();
+    }
+
+    // Arvo's method, the extents are projected on each world axis
+    glm::vec3 center  = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+    glm::vec3 extents = GetExtents();
+    glm::vec3 worldExtents(0.0f);
+
+    for(int nColumn = 0; nColumn < 3; ++nColumn)
+    {
+        worldExtents += glm::abs(glm::vec3(transform[nColumn])) * extents[nColumn];
+    }
+
+    return BoundingBox(center - worldExtents, center + worldExtents);
+}
+
+/// \brief Tells if the box encloses at least one point
+inline bool BoundingBox::IsEmpty() const
+{
+    return m_min.x > m_max.x || m_min.y > m_max.y || m_min.z > m_max.z;
+}
+
+/// \brief Returns the min corner of the box
+inline glm::vec3 const& BoundingBox::GetMin() const
+{
+    return m_min;
+}
+
+/// \brief Returns the max corner of the box
+inline glm::vec3 const& BoundingBox::GetMax() const
+{
+    return m_max;
+}
+
+/// \brief Returns the center of the box
+inline glm::vec3 BoundingBox::GetCenter() const
+{
+    return (m_min + m_max) * 0.5f;
+}
+
+/// \brief Returns the half size of the box
+inline glm::vec3 BoundingBox::GetExtents() const
+{
+    return (m_max - m_min) * 0.5f;
+}
+
+} // !namespace
@@ -0,0 +1,120 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       Frustum.inl
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Rendering/Optimization/Impl
+/// \author     Vincent STEHLY--CALISTO
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Default constructor, the frustum contains everything
+inline Frustum::Frustum()
+{
+    for(glm::vec4 & plane : m_planes)
+    {
+        plane = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+    }
+}
+
+/// \brief Constructor, extracts the planes of the given matrix
+/// \param projectionView The projection view matrix of the volume
+inline Frustum::Frustum(glm::mat4 const& projectionView)
+{
+    Extract(projectionView);
+}
+
+/// \brief Extracts the planes of the view volume (Gribb & Hartmann)
+///        Works for both perspective and orthographic projections
+/// \param projectionView The projection view matrix of the volume
+inline void Frustum::Extract(glm::mat4 const& projectionView)
+{
+    // glm matrices are column major, gets the rows
+    glm::vec4 row0(projectionView[0][0], projectionView[1][0], projectionView[2][0], projectionView[3][0]);
+    glm::vec4 row1(projectionView[0][1], projectionView[1][1], projectionView[2][1], projectionView[3][1]);
+    glm::vec4 row2(projectionView[0][2], projectionView[1][2], projectionView[2][2], projectionView[3][2]);
+    glm::vec4 row3(projectionView[0][3], projectionView[1][3], projectionView[2][3], projectionView[3][3]);
+
+    // OpenGL clip space, -w <= x, y, z <= w
+    m_planes[EPlane::Left]   = row3 + row0;
+    m_planes[EPlane::Right]  = row3 - row0;
+    m_planes[EPlane::Bottom] = row3 + row1;
+    m_planes[EPlane::Top]    = row3 - row1;
+    m_planes[EPlane::Near]   = row3 + row2;
+    m_planes[EPlane::Far]    = row3 - row2;
+
+    for(glm::vec4 & plane : m_planes)
+    {
+        float length = glm::length(glm::vec3(plane));
+        if(length > 0.0f)
+        {
+            plane /= length;
+        }
+    }
+}
+
+/// \brief  Tells if a world space box is at least partially inside the volume
+///         The test is conservative, a box may be kept while being outside
+///         near the corners of the frustum. Empty boxes are always visible.
+/// \param  box The box to test
+/// \return False if the box is fully outside one of the planes
+inline bool Frustum::IsVisible(BoundingBox const& box) const
+{
+    if(box.IsEmpty())
+    {
+        return true;
+    }
+
+    glm::vec3 center  = box.GetCenter();
+    glm::vec3 extents = box.GetExtents();
+
+    for(glm::vec4 const& plane : m_planes)
+    {
+        glm::vec3 normal(plane);
+
+        // Projected radius of the box on the plane normal
+        float radius   = glm::dot(extents, glm::abs(normal));
+        float distance = glm::dot(normal, center) + plane.w;
+
+        if(distance + radius < 0.0f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// \brief  Tells if a point is inside the volume
+/// \param  point The point to test
+inline bool Frustum::IsVisible(glm::vec3 const& point) const
+{
+    for(glm::vec4 const& plane : m_planes)
+    {
+        if(glm::dot(glm::vec3(plane), point) + plane.w < 0.0f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // !namespace
@@ -25,46 +25,54 @@
 namespace cardinal
 {
 
-/// \brief  Tells if there already is a similar vertex
-/// \param  pack The current pack to check
-/// \param  output The output map
-/// \param  result The result
-/// \return True or false
-/* static */ inline bool VBOIndexer::GetSimilarVertexIndex(
-        const VBOIndexer::sPackedVertex &pack,
-        const std::map<VBOIndexer::sPackedVertex, unsigned short> &output,
-        unsigned short &result)
+/// \brief  Hashes the bits of a packed vertex
+///         Vertices are equal if their bits are equal
+/// \param  pack The pack to hash
+/// \return The hash of the pack
+template <typename TPack>
+/* static */ inline uint32_t VBOIndexer::Hash(TPack const& pack)
 {
-    std::map<sPackedVertex, unsigned short>::const_iterator it = output.find(pack);
+    static_assert(sizeof(TPack) % sizeof(uint32_t) == 0, "Packed vertices must be made of 32 bits words");
 
-    if (it != output.end())
+    uint32_t words[sizeof(TPack) / sizeof(uint32_t)];
+    memcpy(words, &pack, sizeof(TPack));
+
+    // Murmur3 like mixing
+    uint32_t hash = 0;
+    for(uint32_t word : words)
     {
-        result = it->second;
-        return true;
+        word *= 0xCC9E2D51;
+        word  = (word << 15) | (word >> 17);
+        word *= 0x1B873593;
+
+        hash ^= word;
+        hash  = (hash << 13) | (hash >> 19);
+        hash  = hash * 5 + 0xE6546B64;
     }
 
-    return false;
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6B;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35;
+    hash ^= hash >> 16;
+
+    return hash;
 }
 
-/// \brief  Tells if there already is a similar vertex
-/// \param  pack The current pack to check
-/// \param  output The output map
-/// \param  result The result
-/// \return True or false
-/* static */ inline bool VBOIndexer::GetSimilarVertexIndex(
-        const VBOIndexer::sPackedVertexBeta &pack,
-        const std::map<VBOIndexer::sPackedVertexBeta, unsigned short> &output,
-        unsigned short &result)
+/// \brief  Clears the open addressing table and sizes it
+///         for the given vertex count (load factor <= 0.5)
+/// \param  vertexCount The number of vertices to index
+/// \return The mask to apply on hashes
+/* static */ inline uint32_t VBOIndexer::ResetTable(size_t vertexCount)
 {
-    std::map<sPackedVertexBeta, unsigned short>::const_iterator it = output.find(pack);
-
-    if (it != output.end())
+    size_t capacity = 16;
+    while(capacity < vertexCount * 2)
     {
-        result = it->second;
-        return true;
+        capacity <<= 1;
     }
 
-    return false;
+    s_table.assign(capacity, s_emptySlot);
+    return static_cast<uint32_t>(capacity - 1);
 }
 
-} // !namespace
\ No newline at end of file
+} // !namespace
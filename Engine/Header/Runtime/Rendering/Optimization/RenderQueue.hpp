@@ -0,0 +1,91 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RenderQueue.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_RENDER_QUEUE_HPP__
+#define CARDINAL_ENGINE_RENDER_QUEUE_HPP__
+
+#include <vector>
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class RenderQueue
+/// \brief The visible renderers of a pass, sorted by a 64 bits key
+///        From the most significant bits : program, texture, vao and depth.
+///        Draws sharing the same states end up next to each other, front to back.
+class RenderQueue
+{
+public:
+
+    static const int s_programBits = 12;
+    static const int s_textureBits = 16;
+    static const int s_vaoBits     = 16;
+    static const int s_depthBits   = 20;
+
+    /// \brief A submitted draw
+    struct Item
+    {
+        uint64            key;
+        class IRenderer * pRenderer;
+    };
+
+public:
+
+    /// \brief  Builds the sort key of a draw
+    ///         The names are truncated to their bits, the order of the draws
+    ///         only matters for performance
+    /// \param  program The program of the draw
+    /// \param  texture The texture of the draw
+    /// \param  vao The vertex array of the draw
+    /// \param  depth The view depth of the draw, negative depths are clamped to 0
+    /// \return The key
+    static uint64 MakeKey(uint program, uint texture, uint vao, float depth);
+
+    /// \brief  Returns the depth bits of a view depth, monotonic
+    /// \param  depth The view depth
+    static uint64 GetDepthBits(float depth);
+
+    /// \brief Removes all draws, keeps the capacity
+    void Clear();
+
+    /// \brief Adds a draw to the queue
+    /// \param key The sort key
+    /// \param pRenderer The renderer to draw
+    void Submit(uint64 key, class IRenderer * pRenderer);
+
+    /// \brief Sorts the draws by key, draws with the same key keep their submission order
+    void Sort();
+
+    /// \brief Returns the draws
+    std::vector<Item> const& GetItems() const;
+
+private:
+
+    std::vector<Item> m_items;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_RENDER_QUEUE_HPP__
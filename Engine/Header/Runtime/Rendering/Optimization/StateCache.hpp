@@ -0,0 +1,78 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       StateCache.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_STATE_CACHE_HPP__
+#define CARDINAL_ENGINE_STATE_CACHE_HPP__
+
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class StateCache
+/// \brief Filters the redundant program, texture and vertex array binds
+///        The cache only knows the GL state between Invalidate calls, outside
+///        of them all binds go through. Raw GL binds must be followed by Invalidate.
+class StateCache
+{
+public:
+
+    static const uint s_textureUnits = 8; ///< The texture units tracked
+
+    /// \brief Forgets the bound states, the next binds are all issued
+    static void Invalidate();
+
+    /// \brief Binds a program
+    /// \param program The program
+    static void UseProgram(uint program);
+
+    /// \brief Binds a 2D texture to a texture unit
+    /// \param unit The texture unit, from 0
+    /// \param texture The texture
+    static void BindTexture(uint unit, uint texture);
+
+    /// \brief Binds a vertex array
+    /// \param vao The vertex array
+    static void BindVertexArray(uint vao);
+
+    /// \brief Returns the number of binds skipped since the last reset
+    static uint64 GetAvoidedBindCount();
+
+    /// \brief Resets the number of skipped binds
+    static void ResetAvoidedBindCount();
+
+private:
+
+    static const uint s_unknown = 0xFFFFFFFF; ///< The state is not known
+
+    static uint   s_program;
+    static uint   s_vao;
+    static uint   s_activeUnit;
+    static uint   s_textures[s_textureUnits];
+    static uint64 s_avoidedBinds;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_STATE_CACHE_HPP__
@@ -24,9 +24,9 @@
 #ifndef CARDINAL_ENGINE_VBO_INDEXER_HPP__
 #define CARDINAL_ENGINE_VBO_INDEXER_HPP__
 
-#include <map>
 #include <vector>
 #include <cstring>
+#include <cstdint>
 
 #include "Glm/glm/glm.hpp"
 
@@ -48,7 +48,8 @@ public :
     /// \param outIndexes  The output indexes vector
     /// \param outVertices The output vertices vector
     /// \param outUVs      The output uvs vector
-    static void Index(
+    /// \return False if the mesh needs 32 bits indexes, the outputs are then left unchanged
+    static bool Index(
             std::vector<glm::vec3> const& inVertices,
             std::vector<glm::vec2> const& inUVs,
             std::vector<unsigned short> & outIndexes,
@@ -62,7 +63,8 @@ public :
     /// \param outIndexes  The output indexes vector
     /// \param outVertices The output vertices vector
     /// \param outUVs      The output uvs vector
-    static void Index(
+    /// \return False if the mesh needs 32 bits indexes, the outputs are then left unchanged
+    static bool Index(
             std::vector<glm::vec3> const& inVertices,
             std::vector<glm::vec3> const& inNormals,
             std::vector<glm::vec2> const& inUVs,
@@ -71,19 +73,47 @@ public :
             std::vector<glm::vec3>      & outNormals,
             std::vector<glm::vec2>      & outUVs);
 
+    /// \brief Indexes vertices who shares same properties
+    ///        32 bits indexes, for meshes above 65535 unique vertices
+    /// \param inVertices  The input vertices vector
+    /// \param inUVs       The input uvs vector
+    /// \param outIndexes  The output indexes vector
+    /// \param outVertices The output vertices vector
+    /// \param outUVs      The output uvs vector
+    static void Index(
+            std::vector<glm::vec3> const& inVertices,
+            std::vector<glm::vec2> const& inUVs,
+            std::vector<unsigned int>   & outIndexes,
+            std::vector<glm::vec3>      & outVertices,
+            std::vector<glm::vec2>      & outUVs);
+
+    /// \brief Indexes vertices who shares same properties
+    ///        32 bits indexes, for meshes above 65535 unique vertices
+    /// \param inVertices  The input vertices vector
+    /// \param inNormals   The input normals vector
+    /// \param inUVs       The input uvs vector
+    /// \param outIndexes  The output indexes vector
+    /// \param outVertices The output vertices vector
+    /// \param outNormals  The output normals vector
+    /// \param outUVs      The output uvs vector
+    static void Index(
+            std::vector<glm::vec3> const& inVertices,
+            std::vector<glm::vec3> const& inNormals,
+            std::vector<glm::vec2> const& inUVs,
+            std::vector<unsigned int>   & outIndexes,
+            std::vector<glm::vec3>      & outVertices,
+            std::vector<glm::vec3>      & outNormals,
+            std::vector<glm::vec2>      & outUVs);
+
 private:
 
+    static const uint32_t s_emptySlot = 0xFFFFFFFF;
+
     /// \struct sPackedVertex
     struct sPackedVertex
     {
         glm::vec3 position; ///< Stores the position of a vertex
         glm::vec2 uv;        ///< Stores the color of a vertex
-
-        /// \brief Compare helper method
-        bool operator<(const sPackedVertex other) const
-        {
-            return memcmp((void*)this, (void*)&other, sizeof(sPackedVertex)) > 0;
-        };
     };
 
     /// \struct sPackedVertexBeta
@@ -92,31 +122,47 @@ private:
         glm::vec3 position;
         glm::vec3 normals;
         glm::vec2 uv;
-
-        /// \brief Compare helper method
-        bool operator<(const sPackedVertexBeta other) const
-        {
-            return memcmp((void*)this, (void*)&other, sizeof(sPackedVertexBeta)) > 0;
-        };
     };
 
-    /// \brief  Tells if there already is a similar vertex
-    /// \param  pack The current pack to check
-    /// \param  output The output map
-    /// \param  result The result
-    /// \return True or false
-    inline static bool GetSimilarVertexIndex(sPackedVertex const& pack,
-            std::map<sPackedVertex,unsigned short> const& output,
-            unsigned short & result);
-
-    /// \brief  Tells if there already is a similar vertex
-    /// \param  pack The current pack to check
-    /// \param  output The output map
-    /// \param  result The result
-    /// \return True or false
-    inline static bool GetSimilarVertexIndex(sPackedVertexBeta const& pack,
-            std::map<sPackedVertexBeta,unsigned short> const& output,
-            unsigned short & result);
+    /// \brief  Hashes the bits of a packed vertex
+    ///         Vertices are equal if their bits are equal
+    /// \param  pack The pack to hash
+    /// \return The hash of the pack
+    template <typename TPack>
+    inline static uint32_t Hash(TPack const& pack);
+
+    /// \brief  Clears the open addressing table and sizes it
+    ///         for the given vertex count (load factor <= 0.5)
+    /// \param  vertexCount The number of vertices to index
+    /// \return The mask to apply on hashes
+    inline static uint32_t ResetTable(size_t vertexCount);
+
+    /// \brief  Indexes vertices with positions and uvs
+    /// \return False if an index does not fit in TIndex
+    template <typename TIndex>
+    static bool IndexImpl(
+            std::vector<glm::vec3> const& inVertices,
+            std::vector<glm::vec2> const& inUVs,
+            std::vector<TIndex>         & outIndexes,
+            std::vector<glm::vec3>      & outVertices,
+            std::vector<glm::vec2>      & outUVs);
+
+    /// \brief  Indexes vertices with positions, normals and uvs
+    /// \return False if an index does not fit in TIndex
+    template <typename TIndex>
+    static bool IndexImpl(
+            std::vector<glm::vec3> const& inVertices,
+            std::vector<glm::vec3> const& inNormals,
+            std::vector<glm::vec2> const& inUVs,
+            std::vector<TIndex>         & outIndexes,
+            std::vector<glm::vec3>      & outVertices,
+            std::vector<glm::vec3>      & outNormals,
+            std::vector<glm::vec2>      & outUVs);
+
+private:
+
+    /// Slots of the open addressing table, store output indexes
+    static thread_local std::vector<uint32_t> s_table;
 };
 
 } // !namespace
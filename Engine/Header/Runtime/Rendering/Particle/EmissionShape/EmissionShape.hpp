@@ -24,6 +24,7 @@
 #ifndef CARDINAL_ENGINE_EMISSION_SHAPE_HPP__
 #define CARDINAL_ENGINE_EMISSION_SHAPE_HPP__
 
+#include <random>
 #include "Glm/glm/vec3.hpp"
 #include "Runtime/Rendering/Hierarchy/Inspector.hpp"
 
@@ -43,8 +44,9 @@ public:
 
     /// \brief Returns a random position in the base of the emission shape
     /// \param systemPosition The position of the particle system
+    /// \param generator The random generator of the particle system
     /// \return The position
-    virtual glm::vec3 GetStartPosition(glm::vec3 const& systemPosition) const = 0;
+    virtual glm::vec3 GetStartPosition(glm::vec3 const& systemPosition, std::mt19937 & generator) const = 0;
 
     /// \brief Computes the start direction of a particles
     /// \param particlePosition The position of the particle
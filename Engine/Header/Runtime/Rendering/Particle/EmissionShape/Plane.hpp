@@ -47,8 +47,9 @@ public:
 
     /// \brief Returns a random position in the base of the emission shape
     /// \param systemPosition The position of the particle system
+    /// \param generator The random generator of the particle system
     /// \return The position
-    glm::vec3 GetStartPosition(glm::vec3 const& systemPosition) const final;
+    glm::vec3 GetStartPosition(glm::vec3 const& systemPosition, std::mt19937 & generator) const final;
 
     /// \brief Computes the start direction of a particles
     /// \param particlePosition The position of the particle
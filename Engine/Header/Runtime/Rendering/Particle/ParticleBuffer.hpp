@@ -0,0 +1,96 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleBuffer.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_PARTICLE_BUFFER_HPP__
+#define CARDINAL_ENGINE_PARTICLE_BUFFER_HPP__
+
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class ParticleBuffer
+/// \brief Structure of arrays storage of the particles of a system
+///        Each attribute lives in its own 16 bytes aligned array
+///        so that the simulation can load four particles at once
+class ParticleBuffer
+{
+public:
+
+    /// \brief Constructor
+    ParticleBuffer();
+
+    /// \brief Destructor
+    ~ParticleBuffer();
+
+    /// \brief Allocates the arrays for the given amount of particles
+    ///        All particles are dead after the allocation
+    /// \param capacity The max amount of particles
+    void Allocate(int capacity);
+
+    /// \brief Releases the arrays
+    void Release();
+
+    /// \brief Returns the max amount of particles
+    int GetCapacity() const;
+
+    /// \brief  Removes the dead particles of the range [0, count)
+    ///         Each dead particle is replaced by the last particle
+    ///         of the range (swap and pop), the order is not kept
+    /// \param  count The number of particles in the range
+    /// \return The number of living particles, packed at the front
+    int Compact(int count);
+
+public:
+
+    float * positionX;
+    float * positionY;
+    float * positionZ;
+    float * velocityX;
+    float * velocityY;
+    float * velocityZ;
+    float * colorR;
+    float * colorG;
+    float * colorB;
+    float * size;
+    float * lifeTime;
+
+private:
+
+    /// \brief Copies all attributes of a particle over another one
+    /// \param from The index of the particle to copy
+    /// \param to The index of the particle to overwrite
+    void Move(int from, int to);
+
+private:
+
+    static const int s_attributeCount = 11;
+
+    int     m_capacity;
+    uchar * m_pBlock;   ///< One allocation for all arrays
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_PARTICLE_BUFFER_HPP__
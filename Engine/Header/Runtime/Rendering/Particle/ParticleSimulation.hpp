@@ -0,0 +1,87 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleSimulation.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_PARTICLE_SIMULATION_HPP__
+#define CARDINAL_ENGINE_PARTICLE_SIMULATION_HPP__
+
+#include "Glm/glm/vec3.hpp"
+#include "Runtime/Rendering/Particle/ParticleBuffer.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class ParticleSimulation
+/// \brief Simulation kernels of the particle systems
+///        Integrates a range of particles and writes the living ones
+///        straight into the billboard buffers of the renderer
+///        (4 floats per position : xyz + size, 3 floats per color)
+class ParticleSimulation
+{
+public:
+
+    /// \brief  Tells if the SIMD kernel is compiled in
+    static bool IsSIMDSupported();
+
+    /// \brief  Simulates a range of particles, four at a time when possible
+    /// \param  particles The particles to simulate
+    /// \param  begin The first particle of the range
+    /// \param  end The end of the range
+    /// \param  gravity The gravity vector
+    /// \param  dt The elapsed time
+    /// \param  pPositionOut The billboard position buffer to fill
+    /// \param  pColorOut The billboard color buffer to fill
+    /// \return The number of living particles written
+    static int Simulate(ParticleBuffer & particles, int begin, int end,
+                        glm::vec3 const& gravity, float dt,
+                        float * pPositionOut, float * pColorOut);
+
+    /// \brief  Simulates a range of particles one by one
+    ///         Reference implementation of Simulate
+    /// \param  particles The particles to simulate
+    /// \param  begin The first particle of the range
+    /// \param  end The end of the range
+    /// \param  gravity The gravity vector
+    /// \param  dt The elapsed time
+    /// \param  pPositionOut The billboard position buffer to fill
+    /// \param  pColorOut The billboard color buffer to fill
+    /// \return The number of living particles written
+    static int SimulateScalar(ParticleBuffer & particles, int begin, int end,
+                              glm::vec3 const& gravity, float dt,
+                              float * pPositionOut, float * pColorOut);
+
+    /// \brief  Closes the gaps left in the billboard buffers by the jobs
+    ///         Job n wrote its billboards from the particle n * jobSize
+    /// \param  pPositions The billboard position buffer
+    /// \param  pColors The billboard color buffer
+    /// \param  pJobWritten The number of billboards written by each job
+    /// \param  jobCount The number of jobs
+    /// \param  jobSize The number of particles simulated by each job
+    /// \return The number of billboards, packed at the front
+    static int PackJobs(float * pPositions, float * pColors,
+                        int const * pJobWritten, int jobCount, int jobSize);
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_PARTICLE_SIMULATION_HPP__
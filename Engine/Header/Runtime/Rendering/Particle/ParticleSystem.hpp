@@ -24,10 +24,15 @@
 #ifndef CARDINAL_ENGINE_PARTICLE_SYSTEM_HPP__
 #define CARDINAL_ENGINE_PARTICLE_SYSTEM_HPP__
 
+#include <random>
+#include <vector>
+#include <cstdint>
+
 #include "Glm/glm/vec3.hpp"
 #include "Runtime/Platform/Configuration/Type.hh"
 #include "Runtime/Rendering/Hierarchy/Inspector.hpp"
 #include "Runtime/Rendering/Renderer/ParticleRenderer.hpp"
+#include "Runtime/Rendering/Particle/ParticleBuffer.hpp"
 #include "Runtime/Rendering/Particle/EmissionShape/EmissionShape.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Particle/ParticleShader.hpp"
 
@@ -39,18 +44,6 @@ namespace cardinal
 /// \brief System of basic particles
 class ParticleSystem : public Inspector
 {
-private:
-
-    struct Particle
-    {
-        glm::vec3 position;
-        glm::vec3 velocity;
-        glm::vec3 color;
-
-        float size;
-        float lifeTime;
-    };
-
 public:
 
     /// \brief Initializes the particle system
@@ -68,6 +61,12 @@ public:
     /// \param position The new position
     void SetPosition(glm::vec3 const& position);
 
+    /// \brief Sets the seed of the emission
+    ///        The simulation is deterministic for a given seed,
+    ///        whatever the number of threads updating the systems
+    /// \param seed The new seed
+    void SetSeed(uint32_t seed);
+
     /// \brief Called when the object is inspected
     void OnInspectorGUI() final;
 
@@ -81,23 +80,49 @@ private:
     /// \brief Destructor
     ~ParticleSystem();
 
-    /// \brief Updates billboards
+    /// \brief Updates billboards, on the calling thread only
     /// \param dt The elapsed time
     void Update(float dt);
 
-    /// \brief Finds and returns a new particle
+    /// \brief Emits the new particles of the step
+    ///        Thread safe with the other systems
+    /// \param dt The elapsed time
+    void Emit(float dt);
+
+    /// \brief Returns the number of simulation jobs of the step
+    ///        Only valid between Emit and EndUpdate
+    int GetJobCount() const;
+
+    /// \brief Simulates a slice of s_jobSize particles
+    ///        Thread safe with the other jobs of all systems
+    /// \param nJob The index of the job
+    /// \param dt The elapsed time
+    void SimulateJob(int nJob, float dt);
+
+    /// \brief Packs the billboards and the particles of the jobs
+    ///        and uploads the billboards, on the main thread
+    void EndUpdate();
+
+    /// \brief  Returns a new particle, in O(1)
+    ///         Living particles are packed in [0, m_liveParticles)
+    /// \return The index of the particle, -1 if the pool is full
     int GetNewParticle();
 
 private:
 
-    Particle *       m_pParticles;
+    static const int s_jobSize = 16384; ///< Particles per job, multiple of 4
+
+    ParticleBuffer   m_particles;
+    std::mt19937     m_generator;
+    std::vector<int> m_jobWritten;   ///< Billboards written by each job
     ParticleRenderer m_renderer;
     ParticleShader   m_shader;
     EmissionShape *  m_pEmissionShape;
     glm::vec3        m_gravity;
     glm::vec3        m_color;
     glm::vec3        m_position;
-    int              m_lastUsedParticle;
+    int              m_liveParticles;
+    int              m_simulatedParticles; ///< Particles alive at the beginning of the simulation
     int              m_particleAmount;
     int              m_emissionRate;
     float            m_lifeTime;
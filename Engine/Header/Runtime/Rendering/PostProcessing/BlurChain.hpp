@@ -0,0 +1,130 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BlurChain.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/PostProcessing
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_BLUR_CHAIN_HPP__
+#define CARDINAL_ENGINE_BLUR_CHAIN_HPP__
+
+#include "Runtime/Platform/Configuration/Type.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class BlurChain
+/// \brief Pool of half, quarter and eighth resolution targets shared by the blur effects
+///        A blur downsamples the source to the level matching its radius, then runs
+///        a horizontal and a vertical 9 taps pass there. The cost no longer grows
+///        with the square of the radius, large radii just use smaller levels.
+class BlurChain
+{
+public:
+
+    static const int s_levelCount = 3; ///< Half, quarter and eighth resolution
+    static const int s_kernelTaps = 4; ///< Taps on each side of the center
+
+    static constexpr float s_maxSpread = 1.5f; ///< Largest step between taps in level texels
+
+    /// \enum The weights of the separable kernel
+    enum EKernel
+    {
+        Gaussian,
+        Box
+    };
+
+public:
+
+    /// \brief  Selects the level and the tap step of a blur
+    /// \param  radius The radius of the blur in full resolution pixels
+    /// \param  spread The step between two taps in level texels
+    /// \return The level, from 0 for the half resolution
+    static int SelectLevel(float radius, float & spread);
+
+    /// \brief  Returns the size of a level on an axis
+    /// \param  size The full resolution size of the axis
+    /// \param  level The level, from 0 for the half resolution
+    static int GetLevelSize(int size, int level);
+
+    /// \brief  Blurs a texture
+    /// \param  sourceTexture The full resolution texture to blur
+    /// \param  radius The radius of the blur in full resolution pixels
+    /// \param  kernel The weights of the kernel
+    /// \return The blurred texture, valid until the next call. The source if the radius is null.
+    uint Blur(uint sourceTexture, float radius, EKernel kernel);
+
+    /// \brief  Downsamples a texture without blurring it further
+    /// \param  sourceTexture The full resolution texture
+    /// \param  level The level, from 0 for the half resolution
+    /// \return The downsampled texture, valid until the next call
+    uint Downsample(uint sourceTexture, int level);
+
+    /// \brief Returns the count of passes since the last reset
+    int GetPassCount() const;
+
+    /// \brief Resets the count of passes
+    void ResetPassCount();
+
+private:
+
+    friend class PostProcessingStack;
+
+    /// \brief Constructor
+    BlurChain();
+
+    /// \brief Creates the targets and gets the programs
+    /// \param width The full resolution width
+    /// \param height The full resolution height
+    /// \param quadVao The full screen quad
+    void Initialize(int width, int height, uint quadVao);
+
+    /// \brief Deletes the targets
+    void Release();
+
+    /// \brief Resizes the targets
+    /// \param width The new full resolution width
+    /// \param height The new full resolution height
+    void Resize(int width, int height);
+
+    /// \brief Renders a texture into a target of a level with the bound program
+    /// \param sourceTexture The texture to read
+    /// \param targetTexture The texture to write
+    /// \param level The level of the target
+    void RenderPass(uint sourceTexture, uint targetTexture, int level);
+
+private:
+
+    int  m_width;
+    int  m_height;
+    int  m_passCount;
+    uint m_quadVao;
+    uint m_fbo;
+    uint m_textures[s_levelCount][2]; ///< Two targets per level for the separable passes
+
+    uint m_downsampleShaderID;
+    uint m_separableShaderID;
+    int  m_directionID;
+    int  m_weightsID;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_BLUR_CHAIN_HPP__
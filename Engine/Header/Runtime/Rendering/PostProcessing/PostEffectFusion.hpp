@@ -0,0 +1,67 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PostEffectFusion.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/PostProcessing
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_POST_EFFECT_FUSION_HPP__
+#define CARDINAL_ENGINE_POST_EFFECT_FUSION_HPP__
+
+#include <string>
+#include <vector>
+
+#include "Runtime/Rendering/PostProcessing/PostEffects/PostEffect.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class PostEffectFusion
+/// \brief Generates a single fragment shader from a run of per-pixel effects
+///        Coordinate effects remap the coordinate the color texture is read at,
+///        color effects are then applied in the order of the stack
+class PostEffectFusion
+{
+public:
+
+    /// \brief Tells if an effect can be appended to a run
+    ///        Coordinate effects must come before any color effect
+    /// \param run The current run
+    /// \param pEffect The fusible effect to append
+    /// \return True if the effect can be fused with the run
+    static bool CanAppend(std::vector<PostEffect *> const& run, PostEffect const* pEffect);
+
+    /// \brief Returns the key identifying the program of a run
+    /// \param run The run
+    /// \return The names of the effects joined by '+'
+    static std::string GetKey(std::vector<PostEffect *> const& run);
+
+    /// \brief Generates the fragment shader of a run
+    /// \param run The run
+    /// \return The GLSL source
+    static std::string GenerateFragmentShader(std::vector<PostEffect *> const& run);
+
+    /// \brief Returns the full screen vertex shader used by fused programs
+    static const char * GetVertexShader();
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_POST_EFFECT_FUSION_HPP__
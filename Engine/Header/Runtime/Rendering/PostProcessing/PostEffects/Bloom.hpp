@@ -49,6 +49,12 @@ private:
     /// \brief Destructor
     ~Bloom();
 
+    /// \brief Blurs the color texture with the blur chain
+    /// \param blurChain The downsampled targets shared by the effects
+    /// \param colorTexture The color texture
+    /// \param lightScatteringTexture The result of the light scattering pass
+    void PrepareEffect(BlurChain & blurChain, uint colorTexture, uint lightScatteringTexture) final;
+
     /// \brief Applies the effect from the given textures
     /// \param colorTexture The color texture
     /// \param depthTexture The depth buffer texture
@@ -65,8 +71,8 @@ private:
     int       m_sampleCount;
 
     int       m_colorID;
-    int       m_qualityID;
-    int       m_sampleCountID;
+    int       m_blurTextureID;
+    uint      m_blurTexture;
 };
 
 } // !namespace
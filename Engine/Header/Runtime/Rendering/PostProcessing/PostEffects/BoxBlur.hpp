@@ -48,6 +48,12 @@ private:
     /// \brief Destructor
     ~BoxBlur();
 
+    /// \brief Blurs the color texture with the blur chain
+    /// \param blurChain The downsampled targets shared by the effects
+    /// \param colorTexture The color texture
+    /// \param lightScatteringTexture The result of the light scattering pass
+    void PrepareEffect(BlurChain & blurChain, uint colorTexture, uint lightScatteringTexture) final;
+
     /// \brief Applies the effect from the given textures
     /// \param colorTexture The color texture
     /// \param depthTexture The depth buffer texture
@@ -59,8 +65,9 @@ private:
 
 private:
 
-    int m_intensity;
-    int m_intesityID;
+    int  m_intensity;    ///< Width of the box in pixels
+    int  m_blurTextureID;
+    uint m_blurTexture;
 };
 
 } // !namespace
@@ -48,6 +48,12 @@ private:
     /// \brief Destructor
     ~GodRay();
 
+    /// \brief Downsamples the light scattering texture with the blur chain
+    /// \param blurChain The downsampled targets shared by the effects
+    /// \param colorTexture The color texture
+    /// \param lightScatteringTexture The result of the light scattering pass
+    void PrepareEffect(BlurChain & blurChain, uint colorTexture, uint lightScatteringTexture) final;
+
     /// \brief Applies the effect from the given textures
     /// \param colorTexture The color texture
     /// \param depthTexture The depth buffer texture
@@ -72,6 +78,8 @@ private:
     int m_sampleCountID;
     int m_lightPosition2DID;
     int m_lightScatteringTextureID;
+
+    uint m_scatteringTexture; ///< The light scattering at a quarter of the resolution
 };
 
 } // !namespace
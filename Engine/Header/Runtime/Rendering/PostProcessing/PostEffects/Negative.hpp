@@ -54,6 +54,12 @@ private:
 
     /// \brief Called to draw the GUI
     void OnGUI() final;
+
+    /// \brief Tells how the effect can be fused with its neighbors
+    EFusion GetFusion() const final;
+
+    /// \brief Returns the GLSL function of the effect
+    const char * GetFusedSource() const final;
 };
 
 } // !namespace
@@ -25,7 +25,9 @@
 #define CARDINAL_ENGINE_POST_EFFECT_HPP__
 
 #include <string>
+#include <vector>
 #include "Runtime/Platform/Configuration/Type.hh"
+#include "Runtime/Rendering/PostProcessing/BlurChain.hpp"
 
 #include "ImGUI/imgui.h"
 #include "ImGUI/imgui_impl_glfw_gl3.h"
@@ -65,12 +67,21 @@ public:
         Experimental2
     };
 
+    /// \enum How the effect can be merged with its neighbors into a single pass
+    enum EFusion
+    {
+        NotFused,        ///< The effect reads neighbor pixels and needs its own pass
+        ColorFusion,     ///< The effect provides vec3 <Name>Effect(vec3 color, vec2 uv)
+        CoordinateFusion ///< The effect provides vec2 <Name>Effect(vec2 uv), remapping the read coordinate
+    };
+
     /// \brief Returns the name of the post effect
     std::string const& GetName() const;
 
 protected:
 
     friend class PostProcessingStack;
+    friend class PostEffectFusion;
 
     /// \brief Constructor
     /// \param type The type of the effect
@@ -85,6 +96,12 @@ protected:
     /// \return True or false
     bool IsActive() const;
 
+    /// \brief Renders the intermediate passes of the effect, before its target is bound
+    /// \param blurChain The downsampled targets shared by the effects
+    /// \param colorTexture The color texture
+    /// \param lightScatteringTexture The result of the light scattering pass
+    virtual void PrepareEffect(BlurChain & blurChain, uint colorTexture, uint lightScatteringTexture);
+
     /// \brief Applies the effect from the given textures
     /// \param colorTexture The color texture
     /// \param depthTexture The depth buffer texture
@@ -94,6 +111,24 @@ protected:
     /// \brief Called to display the GUI
     virtual void OnGUI() = 0;
 
+    /// \brief Tells how the effect can be fused with its neighbors
+    /// \return NotFused by default
+    virtual EFusion GetFusion() const;
+
+    /// \brief Returns the GLSL uniforms and function of the effect
+    ///        Uniform names must be unique across all fusible effects
+    /// \return The source or nullptr if the effect is not fusible
+    virtual const char * GetFusedSource() const;
+
+    /// \brief Queries the locations of the uniforms of the effect in a fused program
+    /// \param program The linked fused program
+    /// \param uniformIDs The locations to append to, in the order SetFusedUniforms reads them
+    virtual void GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const;
+
+    /// \brief Uploads the uniforms of the effect to the bound fused program
+    /// \param pUniformIDs The locations appended by GetFusedUniformIDs
+    virtual void SetFusedUniforms(int const* pUniformIDs) const;
+
 protected:
 
     EType       m_type;
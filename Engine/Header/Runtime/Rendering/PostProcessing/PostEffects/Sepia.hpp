@@ -58,6 +58,21 @@ private:
     /// \brief Called to draw the GUI
     void OnGUI() final;
 
+    /// \brief Tells how the effect can be fused with its neighbors
+    EFusion GetFusion() const final;
+
+    /// \brief Returns the GLSL uniforms and function of the effect
+    const char * GetFusedSource() const final;
+
+    /// \brief Queries the locations of the uniforms of the effect in a fused program
+    /// \param program The linked fused program
+    /// \param uniformIDs The locations to append to
+    void GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const final;
+
+    /// \brief Uploads the uniforms of the effect to the bound fused program
+    /// \param pUniformIDs The locations appended by GetFusedUniformIDs
+    void SetFusedUniforms(int const* pUniformIDs) const final;
+
 private:
 
     float     m_threshold;
@@ -24,9 +24,12 @@
 #ifndef CARDINAL_ENGINE_POST_PROCESSING_STACK_HPP__
 #define CARDINAL_ENGINE_POST_PROCESSING_STACK_HPP__
 
+#include <string>
 #include <vector>
+#include <unordered_map>
 
 #include "Runtime/Platform/Configuration/Type.hh"
+#include "Runtime/Rendering/PostProcessing/BlurChain.hpp"
 #include "Runtime/Rendering/PostProcessing/PostEffects/PostEffect.hpp"
 #include "Runtime/Rendering/PostProcessing/PostEffects/Identity.hpp"
 #include "Runtime/Rendering/PostProcessing/PostEffects/Mirror.hpp"
@@ -78,16 +81,26 @@ private:
     ~PostProcessingStack();
 
     /// \brief Initializes the post processing stack
-    void Initialize();
+    /// \param width The width of the render targets
+    /// \param height The height of the render targets
+    void Initialize(int width, int height);
 
     /// \brief Release the post processing stack
     void Release();
 
+    /// \brief Resizes the render targets
+    /// \param width The new width
+    /// \param height The new height
+    void Resize(int width, int height);
+
     /// \brief Called at the beginning of the frame
     void OnPostProcessingBegin(uint lightScatteringTextureID, uint shadowMapTextureID);
 
     /// \brief Called to render effects
-    void OnPostProcessingRender();
+    /// \param outputWidth The width of the window
+    /// \param outputHeight The height of the window
+    /// \param bApplyEffects False to only upscale the frame to the window
+    void OnPostProcessingRender(int outputWidth, int outputHeight, bool bApplyEffects);
 
     /// \brief Called at the end of the frame
     void OnPostProcessingEnd();
@@ -99,8 +112,48 @@ private:
     /// \return The count of active shaders
     int GetActivePostProcessShaders() const;
 
+    /// \brief Returns the count of full screen passes of the last frame
+    /// \return The count of passes
+    int GetPassCount() const;
+
+    /// \brief Returns the texture the next pass reads from
+    uint GetPassSource() const;
+
+    /// \brief Binds and attaches the next ping-pong target
+    void BeginPass();
+
+    /// \brief Draws the full screen quad
+    void DrawQuad();
+
+    /// \brief Renders a single effect in its own pass
+    /// \param pEffect The effect to render
+    void RenderEffect(PostEffect * pEffect);
+
+    /// \brief A fused program with the uniform locations of its run
+    struct FusedProgram
+    {
+        uint                m_program;
+        bool                m_bResolved;      ///< The locations were queried
+        int                 m_colorTextureID;
+        int                 m_depthTextureID;
+        std::vector<int>    m_uniformIDs;     ///< The locations of all effects, in run order
+        std::vector<size_t> m_effectOffsets;  ///< The first location of each effect
+    };
+
+    /// \brief Renders the pending run of fusible effects in one pass
+    void RenderFusedRun();
+
+    /// \brief Returns the program of the pending run, compiling it if needed
+    ///        The uniform locations are queried once, when the program is ready
+    /// \return The program or nullptr if it could not be built or is still building
+    FusedProgram const* GetFusedProgram();
+
 private:
 
+    // Size of the render targets
+    int m_width;
+    int m_height;
+
     // QUAD
     uint m_postProcessVao;
     uint m_postProcessQuadVbo;
@@ -118,6 +171,15 @@ private:
     // PostEffects stack
     std::vector <PostEffect *> m_stack;
 
+    // Downsampled targets of the blur effects
+    BlurChain m_blurChain;
+
+    // Fusion
+    std::vector <PostEffect *>                    m_fusedRun;      ///< Pending run of fusible effects
+    std::unordered_map<std::string, FusedProgram> m_fusedPrograms; ///< Fused programs by run key
+    bool m_bSwapped;
+    int  m_passCount;
+
     // Light scattering
     uint m_lightScatteringTextureID;
 
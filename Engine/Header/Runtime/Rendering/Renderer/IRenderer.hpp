@@ -27,6 +27,7 @@
 #include "Runtime/Rendering/Shader/IShader.hpp"
 #include "Runtime/Platform/Configuration/Type.hh"
 #include "Runtime/Rendering/Hierarchy/Inspector.hpp"
+#include "Runtime/Rendering/Optimization/BoundingBox.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -52,6 +53,10 @@ public:
     /// \brief Returns the count of element to be draw
     int GetElementCount() const;
 
+    /// \brief  Returns the world space bounds of the renderer
+    /// \return The bounds, empty if the renderer can't be culled
+    BoundingBox GetBounds() const;
+
 protected:
 
     friend class RenderingEngine;
@@ -62,7 +67,9 @@ protected:
     glm::mat4 m_model;          ///< The model of the renderer
     int       m_elementsCount;  ///< The count of element to be draw
     bool      m_isIndexed;      ///< Tells if the renderer contains indexed data
+    uint      m_indexType;      ///< The GL type of the indexes of indexed data
     bool      m_isInstantiated; ///< Tells if the renderer contains instantiated data
+    BoundingBox m_bounds;       ///< The local space bounds, computed at initialization
 };
 
 } // !namespace
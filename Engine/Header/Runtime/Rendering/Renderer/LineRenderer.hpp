@@ -29,6 +29,7 @@
 #include "Glm/glm/ext.hpp"
 
 #include "Runtime/Rendering/Renderer/IRenderer.hpp"
+#include "Runtime/Rendering/Buffer/RingBuffer.hpp"
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
 /// \namespace cardinal
@@ -74,13 +75,18 @@ public:
     /// \brief Called when the object is inspected
     void OnInspectorGUI() final;
 
+private:
+
+    /// \brief Streams the lines in the next region of the ring
+    void UpdateBuffer();
+
 private:
 
     friend class RenderingEngine;
 
     std::vector<glm::vec3> m_lines;
-    uint                   m_verticesObject;
-    uint                   m_maxElement;
+    RingBuffer             m_verticesRing;
+    bool                   m_bDirty;  ///< The lines changed since the last upload
 };
 
 }  // !namespace
@@ -57,6 +57,16 @@ public :
                     std::vector<glm::vec3>      const &normals,
                     std::vector<glm::vec2>      const &uvs);
 
+    /// \brief Initializes the mesh with 32 bits indexes
+    /// \param indexes The indexes of the mesh
+    /// \param normals The normals of the mesh
+    /// \param vertices The vertices of the mesh
+    /// \param uvs The uvs of the mesh
+    void Initialize(std::vector<unsigned int>   const &indexes,
+                    std::vector<glm::vec3>      const &vertices,
+                    std::vector<glm::vec3>      const &normals,
+                    std::vector<glm::vec2>      const &uvs);
+
     /// \brief Updates the mesh
     /// \param indexes The indexes of the mesh
     /// \param normals The normals of the mesh
@@ -67,6 +77,10 @@ public :
                 std::vector<glm::vec3>      const &normals,
                 std::vector<glm::vec2>      const &uvs);
 
+    /// \brief Releases the buffers of the mesh, nothing is drawn
+    ///        until the next initialization
+    void Clear();
+
     /// \brief Sets the position of the mesh renderer
     /// \param position The new position
     void SetPosition(glm::vec3 const &position);
@@ -86,6 +100,17 @@ public :
     /// \brief Called when the object is inspected
     void OnInspectorGUI() final;
 
+private:
+
+    /// \brief Creates the buffers of the mesh
+    /// \param pIndexes The indexes of the mesh
+    /// \param indexCount The number of indexes
+    /// \param indexType The GL type of the indexes
+    void InitializeBuffers(void const * pIndexes, size_t indexCount, uint indexType,
+                           std::vector<glm::vec3> const &vertices,
+                           std::vector<glm::vec3> const &normals,
+                           std::vector<glm::vec2> const &uvs);
+
 private:
 
     friend class RenderingEngine;
@@ -29,6 +29,7 @@
 #include "Glm/glm/ext.hpp"
 
 #include "Runtime/Rendering/Renderer/IRenderer.hpp"
+#include "Runtime/Rendering/Buffer/RingBuffer.hpp"
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
 /// \namespace cardinal
@@ -58,7 +59,7 @@ public :
     /// \brief Sets the currentElementCount
     void SetElementCount(int count);
 
-    /// \brief Updates positions and color buffer
+    /// \brief Streams positions and colors in the next region of the rings
     void UpdateBuffer();
 
     /// \brief Base method implementation
@@ -75,10 +76,10 @@ private:
 
     friend class RenderingEngine;
 
-    uint m_billboardVertexBuffer;
-    uint m_billboardPositionBuffer;
-    uint m_billboardColorBuffer;
-    uint m_maxParticleAmount;
+    uint       m_billboardVertexBuffer;
+    RingBuffer m_billboardPositionRing;
+    RingBuffer m_billboardColorRing;
+    uint       m_maxParticleAmount;
 };
 
 }  // !namespace
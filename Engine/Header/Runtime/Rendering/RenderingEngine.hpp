@@ -25,11 +25,18 @@
 #define CARDINAL_ENGINE_RENDERING_ENGINE_HPP__
 
 #include <vector>
+#include <utility>
 #include "OpenVR/headers/openvr.h"
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
+#include "Runtime/Core/Thread/WorkerPool.hpp"
 #include "Runtime/Rendering/Context/Window.hpp"
 #include "Runtime/Rendering/Camera/Camera.hpp"
+#include "Runtime/Rendering/Lighting/LightStructure.hpp"
+#include "Runtime/Rendering/Lighting/ShadowCascades.hpp"
+#include "Runtime/Rendering/Optimization/GpuTimer.hpp"
+#include "Runtime/Rendering/Optimization/RenderQueue.hpp"
+#include "Runtime/Rendering/Optimization/DynamicResolution.hpp"
 #include "Runtime/Rendering/PostProcessing/PostProcessingStack.hpp"
 
 /// \namespace cardinal
@@ -114,6 +121,31 @@ public:
     /// \param pRenderer The renderer to release
     static void ReleaseRenderer(class IRenderer *& pRenderer);
 
+    /// \brief  Returns the number of renderers culled by the camera frustum
+    ///         during the last frame (both eyes in stereoscopic rendering)
+    /// \return The number of culled renderers
+    static uint64_t GetCulledRendererCount();
+
+    /// \brief  Returns the number of renderers culled by the light frustum
+    ///         of the shadow pass during the last frame
+    /// \return The number of culled shadow casters
+    static uint64_t GetCulledShadowCasterCount();
+
+    /// \brief  Sets the number of shadow cascades and the size of their maps
+    /// \param  cascadeCount The number of cascades, from 1 to ShadowCascades::s_maxCascades
+    /// \param  resolution The width and height of each map in texels
+    /// \return False if the maps can't be created
+    static bool SetShadowCascades(int cascadeCount, int resolution);
+
+    /// \brief  Returns the shadow cascades of the directional light
+    /// \return The cascades, fitted to the main camera of the last frame
+    static ShadowCascades const& GetShadowCascades();
+
+    /// \brief  Returns the depth map of a shadow cascade
+    /// \param  cascade The index of the cascade
+    /// \return The texture
+    static uint GetShadowMapTexture(int cascade);
+
     /// \brief Returns the main camera
     /// \return A pointer on the main camera
     static Camera * GetMainCamera();
@@ -130,10 +162,40 @@ public:
     /// \return True or false
     static bool IsPostProcessingActive();
 
+    /// \brief Sets the state of the clustered lighting
+    ///        All lights of the view are shaded per fragment instead of the nearest ones
+    /// \param bActive The new state
+    static void SetClusteredLightingActive(bool bActive);
+
+    /// \brief Tells if the clustered lighting is active or not
+    /// \return True or false
+    static bool IsClusteredLightingActive();
+
+    /// \brief Sets the state of the dynamic resolution
+    ///        The scene is rendered offscreen at a scale of the window driven by the GPU frame time
+    /// \param bActive The new state
+    static void SetDynamicResolutionActive(bool bActive);
+
+    /// \brief Tells if the dynamic resolution is active or not
+    /// \return True or false
+    static bool IsDynamicResolutionActive();
+
+    /// \brief Sets the frame rate the dynamic resolution holds and the range of the scale
+    /// \param targetFrameRate The GPU frame rate to hold
+    /// \param minScale The lowest scale of each axis
+    /// \param maxScale The highest scale of each axis
+    static void ConfigureDynamicResolution(float targetFrameRate, float minScale, float maxScale);
+
     /// \brief Returns a pointer on the post-processing stack
     /// \return A pointer on the post-processing stack
     static PostProcessingStack * GetPostProcessingStack();
 
+    /// \brief Returns the worker pool of the engine, one thread per hardware thread
+    ///        Shared by the particle update and the world generation and batching,
+    ///        it must only be used from the main thread
+    /// \return A reference on the worker pool
+    static WorkerPool & GetWorkerPool();
+
     /// \brief Returns the projection matrix
     static glm::mat4 const& GetProjectionMatrix();
 
@@ -192,6 +254,38 @@ private:
     /// \brief Called to render the hierarchy
     void RenderHierarchy();
 
+    /// \brief Follows the window size and the dynamic resolution scale
+    void UpdateResolution();
+
+    /// \brief Resizes the offscreen render targets
+    /// \param width The new width
+    /// \param height The new height
+    void ResizeRenderTargets(int width, int height);
+
+    /// \brief  Creates a depth map per shadow cascade
+    /// \return False if the maps can't be attached
+    bool CreateShadowMaps();
+
+    /// \brief Deletes the depth maps of the shadow cascades
+    void ReleaseShadowMaps();
+
+    /// \brief Renders the casters of each shadow cascade in its map
+    /// \param P The projection matrix of the camera
+    /// \param V The view matrix of the camera
+    /// \param lightDirection The direction of the directional light
+    void RenderShadowMaps(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 const& lightDirection);
+
+    /// \brief Draws the visible renderers sorted by states
+    /// \param P The projection matrix
+    /// \param V The view matrix
+    /// \param frustum The view volume of the pass
+    void DrawRenderers(glm::mat4 const& P, glm::mat4 const& V, class Frustum const& frustum);
+
+    /// \brief  Searches the nearest point lights of a renderer
+    /// \param  position The position of the renderer
+    /// \return The lights, valid until the next call
+    std::vector<PointLightStructure> const& FindNearestPointLights(glm::vec3 const& position);
+
     /// \brief Returns the wanted string
     std::string GetTrackedDeviceString(vr::IVRSystem *pHmd, vr::TrackedDeviceIndex_t unDevice, vr::TrackedDeviceProperty prop, vr::TrackedPropertyError *peError = NULL);
 
@@ -239,6 +333,7 @@ private:
     bool m_debugTime;
     bool m_bInterpolate;
     bool m_bStereoscopicRendering;
+    bool m_bClusteredLighting;
 
     double m_frameDelta;
     double m_frameTime;
@@ -257,24 +352,43 @@ private:
     uint64_t  m_currentTriangle;
     uint64_t  m_triangleCounter;
     uint64_t  m_triangleSecond;
+    uint64_t  m_culledRenderers;     ///< Renderers outside the camera frustum this frame
+    uint64_t  m_culledShadowCasters; ///< Renderers outside the light frustum this frame
     glm::mat4 m_projectionMatrix;
 
     // Rendering objects
     glm::vec3                          m_clearColor;
     std::vector<class IRenderer*>      m_renderers;
     std::vector<class ParticleSystem*> m_paricleSystems;
+    std::vector<PointLightStructure>   m_nearestLights; ///< Reused for each renderer
+    RenderQueue                        m_renderQueue;   ///< Reused for each pass
+
+    // Particles update, shared with the game through GetWorkerPool
+    WorkerPool                                         m_workerPool;
+    std::vector<std::pair<class ParticleSystem*, int>> m_particleJobs; ///< System and job index
 
     // Light scattering
     uint m_lightScatteringFbo;
     uint m_lightScatteringTexture;
 
     // Shadow mapping
-    uint m_shadowMapFbo;
-    uint m_shadowMapTexture;
+    ShadowCascades m_shadowCascades;
+    uint           m_shadowMapFbo;
+    uint           m_shadowMapTextures[ShadowCascades::s_maxCascades]; ///< One depth map per cascade
 
     // Post-processing
     bool                m_bIsPostProcessingEnabled;
     PostProcessingStack m_postProcessingStack;
+
+    // Resolution
+    int               m_windowWidth;   ///< Frame buffer size of the window
+    int               m_windowHeight;
+    int               m_targetWidth;   ///< Size of the offscreen render targets
+    int               m_targetHeight;
+    bool              m_bDynamicResolution;
+    DynamicResolution m_dynamicResolution;
+    GpuTimer          m_gpuTimer;
+    float             m_gpuFrameTime;  ///< Last measured GPU frame time in milliseconds
 };
 
 } // !namespace
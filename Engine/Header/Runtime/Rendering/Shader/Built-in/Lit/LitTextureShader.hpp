@@ -49,14 +49,8 @@ public:
     /// \brief Restore the pipeline state
     void End() final;
 
-private:
-
-    friend class LightManager;
-
-    static int s_lightDirection;
-    static int s_lightIntensity;
-    static int s_ambientIntensity;
-    static int s_lightColor;
+    /// \brief Returns the texture bound by Begin
+    uint GetTexture() const final;
 
 private:
 
@@ -44,6 +44,10 @@ public:
     /// \brief Sets the texture of the shader
     void SetTexture(uint textureID);
 
+    /// \brief Enables the tiling of packed atlas UVs
+    /// \param tileStep The size of an atlas tile in UV space, 0 to disable
+    void SetAtlasTiling(float tileStep);
+
     /// \brief Sets up the pipeline for the shader
     /// \param MVP The Projection-View-Model matrix to pass to the shader
     void Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights) final;
@@ -51,19 +55,18 @@ public:
     /// \brief Restore the pipeline state
     void End() final;
 
-private:
+    /// \brief Returns the texture bound by Begin
+    uint GetTexture() const final;
 
-    friend class LightManager;
+private:
 
-    static int s_lightDirection;
-    static int s_lightIntensity;
-    static int s_ambientIntensity;
-    static int s_lightColor;
+    static const int s_maxPointLights = 4; ///< The size of lightIndices in the shader
 
 private:
 
     // TODO : make uniforms static
-    uint m_textureID;
+    uint  m_textureID;
+    float m_atlasTileStep;
     std::vector<PointLightStructure> m_nearPointLights;
 
     int  m_viewID;
@@ -71,6 +74,10 @@ private:
     int  m_projection;
     int  m_lightCountID;
     int  m_textureSampler;
+    int  m_atlasTileStepID;
+    int  m_lightIndicesID;
+    int  m_clusterCellsID;
+    int  m_clusterLightsID;
 };
 
 } // !namespace
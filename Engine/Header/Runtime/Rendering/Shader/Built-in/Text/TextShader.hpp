@@ -50,6 +50,9 @@ public:
     /// \brief Restore the pipeline state
     void End() final;
 
+    /// \brief Returns the texture bound by Begin
+    uint GetTexture() const final;
+
 private:
 
     uint      m_texture;
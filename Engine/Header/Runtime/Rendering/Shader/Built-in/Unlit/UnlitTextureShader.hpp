@@ -49,6 +49,9 @@ public:
     /// \brief Restore the pipeline state
     void End() final;
 
+    /// \brief Returns the texture bound by Begin
+    uint GetTexture() const final;
+
     std::string debugName;
 
 private:
@@ -46,6 +46,9 @@ public:
     /// \brief Restore the pipeline state
     void End() final;
 
+    /// \brief Returns the texture bound by Begin
+    uint GetTexture() const final;
+
     /// \brief Sets the texture
     void SetTexture(int texture);
 
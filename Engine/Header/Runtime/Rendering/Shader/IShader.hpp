@@ -24,7 +24,10 @@
 #ifndef CARDINAL_ENGINE_I_SHADER_HPP__
 #define CARDINAL_ENGINE_I_SHADER_HPP__
 
+#include <string>
 #include <vector>
+#include <unordered_map>
+
 #include "Glm/glm/glm.hpp"
 #include "Runtime/Platform/Configuration/Type.hh"
 #include "Runtime/Rendering/Hierarchy/Inspector.hpp"
@@ -36,8 +39,26 @@ namespace cardinal
 
 /// \class IShader
 /// \brief Base class for all built-in shaders
+///        Uniform locations are resolved once per program and the last
+///        value of each uniform is kept to skip redundant uploads
 class IShader : public Inspector
 {
+public:
+
+    /// \brief Resolves and caches the active uniforms of a linked program
+    /// \param program The program
+    static void ResolveUniforms(int program);
+
+    /// \brief Forgets the uniforms of a program, before deleting or relinking it
+    /// \param program The program
+    static void ReleaseUniforms(int program);
+
+    /// \brief Returns the number of uniform uploads skipped since the last reset
+    static uint64 GetAvoidedUniformCount();
+
+    /// \brief Resets the number of skipped uniform uploads
+    static void ResetAvoidedUniformCount();
+
 public:
 
     /// \brief Sets up the pipeline for the shader
@@ -48,13 +69,73 @@ public:
     /// \brief Restore the pipeline state
     virtual void End  () = 0;
 
+    /// \brief  Returns the texture bound by Begin, used to sort the draws
+    /// \return The texture, 0 if the shader has none
+    virtual uint GetTexture() const;
+
+    /// \brief  Returns the location of a uniform of the shader program
+    /// \param  name The name of the uniform
+    /// \return The location, -1 if the uniform is not active
+    int GetUniformLocation(const char * name);
+
+    /// \brief Binds a uniform block of the shader program to a buffer binding point
+    /// \param name The name of the block
+    /// \param binding The binding point
+    void BindUniformBlock(const char * name, uint binding);
+
+    /// \brief Sets an integer in the shader
+    void SetInt(int uniform, int value);
+
+    /// \brief Sets 4 integers in the shader
+    void SetInt4(int uniform, glm::ivec4 const& value);
+
+    /// \brief Sets a float in the shader
+    void SetFloat(int uniform, float value);
+
+    /// \brief Sets 3 floats in the shader
+    void SetFloat3(int uniform, glm::vec3 const& value);
+
     /// \brief Sets 4 floats in the shader
     void SetFloat4(int uniform, float x, float y, float z, float w);
 
+    /// \brief Sets a 4x4 matrix in the shader
+    void SetMatrix4(int uniform, glm::mat4 const& value);
+
 public:
 
      int m_shaderID = 0; ///< The shader to use
      int m_matrixID = 0; ///< The MVP matrix ID
+
+private:
+
+    /// \brief The last value uploaded to a uniform
+    struct UniformValue
+    {
+        float m_data[16];
+        int   m_size;     ///< In floats, 0 if unknown
+    };
+
+    /// \brief The uniforms of a linked program
+    struct ProgramUniforms
+    {
+        std::unordered_map<std::string, int> m_locations;
+        std::vector<UniformValue>            m_values;  ///< Indexed by location
+    };
+
+    /// \brief  Returns the uniforms of the shader program
+    ProgramUniforms & GetProgramUniforms();
+
+    /// \brief  Records the value of a uniform
+    /// \return False if the uniform already had this value
+    bool UpdateValue(int uniform, const void * pData, int size);
+
+private:
+
+    static std::unordered_map<int, ProgramUniforms> s_programs;
+    static uint64                                   s_avoidedUniforms;
+
+    ProgramUniforms * m_pUniforms       = nullptr; ///< Cached entry of s_programs
+    int               m_uniformsProgram = -1;      ///< The program of m_pUniforms
 };
 
 } // !namespace 
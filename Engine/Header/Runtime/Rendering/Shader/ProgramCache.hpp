@@ -0,0 +1,109 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ProgramCache.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Shader
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_PROGRAM_CACHE_HPP__
+#define CARDINAL_ENGINE_PROGRAM_CACHE_HPP__
+
+#include <string>
+#include <vector>
+
+#include "Runtime/Platform/Configuration/Configuration.hh"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \class  ProgramCache
+/// \brief  Stores linked program binaries on the disk, one file per program name
+///         An entry is only valid for the key it was written with, the key hashes
+///         the sources and the driver. Any change of them misses and the entry
+///         is overwritten by the next recompilation.
+class ProgramCache
+{
+public:
+
+    static const uint32 s_magic   = 0x43505243; ///< "CRPC"
+    static const uint32 s_version = 1;          ///< Bumped when the file layout changes
+    static const uint64 s_seed    = 0xcbf29ce484222325ull; ///< FNV-1a offset basis
+
+    /// \brief  Hashes a string with FNV-1a
+    /// \param  szData The null terminated string
+    /// \param  seed The hash to continue, s_seed to start a new one
+    /// \return The hash
+    static uint64 Hash(const char * szData, uint64 seed);
+
+    /// \brief Sets the directory of the cache files
+    /// \param directory The directory, created on the first write
+    static void SetDirectory(std::string const& directory);
+
+    /// \brief Enables or disables the cache
+    /// \param bEnabled The new state
+    static void SetEnabled(bool bEnabled);
+
+    /// \brief Tells if the cache is enabled
+    static bool IsEnabled();
+
+    /// \brief  Returns the file of a program
+    /// \param  szName The name of the program
+    /// \return The path of the file
+    static std::string GetPath(const char * szName);
+
+    /// \brief  Reads an entry
+    /// \param  path The file of the entry
+    /// \param  key The expected key
+    /// \param  format The binary format of the driver
+    /// \param  binary The program binary
+    /// \return False if the file is missing, corrupted or has another key
+    static bool ReadEntry(std::string const& path, uint64 key, uint32 & format, std::vector<char> & binary);
+
+    /// \brief  Writes an entry, replacing the previous one
+    /// \param  path The file of the entry
+    /// \param  key The key of the entry
+    /// \param  format The binary format of the driver
+    /// \param  binary The program binary
+    /// \return False if the file can't be written
+    static bool WriteEntry(std::string const& path, uint64 key, uint32 format, std::vector<char> const& binary);
+
+    /// \brief Deletes an entry
+    /// \param path The file of the entry
+    static void RemoveEntry(std::string const& path);
+
+private:
+
+    /// \brief The fixed size beginning of a file
+    struct Header
+    {
+        uint32 magic;
+        uint32 version;
+        uint64 key;
+        uint32 format;
+        uint32 binarySize;
+    };
+
+    static bool        s_bEnabled;
+    static std::string s_directory;
+};
+
+} // !namespace
+
+#endif // !CARDINAL_ENGINE_PROGRAM_CACHE_HPP__
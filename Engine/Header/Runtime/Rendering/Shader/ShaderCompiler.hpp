@@ -24,6 +24,10 @@
 #ifndef CARDINAL_ENGINE_SHADER_COMPILER_HPP__
 #define CARDINAL_ENGINE_SHADER_COMPILER_HPP__
 
+#include <string>
+#include <vector>
+#include <unordered_map>
+
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
 /// \namespace cardinal
@@ -32,22 +36,107 @@ namespace cardinal
 
 /// \class  ShaderCompiler
 /// \brief  Tool to compile shaders
+///         Compilations and links are only submitted to the driver, their status
+///         is checked by FinalizeProgram when the program is first needed.
+///         Errors are reported through the logger.
 class ShaderCompiler
 {
 public :
 
-    /// \brief Loads a shader from the given paths
-    /// \param czVertexShader The path to the vertex shader
-    /// \param csFragmentShader The path to the fragment shader
+    /// \brief Lets the driver compile on its own threads when it can
+    static void Initialize();
+
+    /// \brief  Loads a shader from the given paths
+    /// \param  czVertexShader The path to the vertex shader
+    /// \param  csFragmentShader The path to the fragment shader
+    /// \return The program, 0 if a file can't be read
     static int LoadShaders(const char * czVertexShader,const char * csFragmentShader);
 
-    // TODO
-    /// \brief Loads a shader from the given paths
-    /// \param czVertexShader The path to the vertex shader
-    /// \param csFragmentShader The path to the fragment shader
+    /// \brief  Compiles and links a program from sources
+    /// \param  szVertexCode The source of the vertex shader
+    /// \param  szFragmentCode The source of the fragment shader
+    /// \param  szVertexName The name of the vertex shader in the logs
+    /// \param  szFragmentName The name of the fragment shader in the logs
+    /// \return The program
+    static int CompileShaders(const char * szVertexCode, const char * szFragmentCode, const char * szVertexName, const char * szFragmentName);
+
+    /// \brief  Loads a shader from the given paths
+    /// \param  czVertexShader The path to the vertex shader
+    /// \param  szGeometryShader The path to the geometry shader
+    /// \param  csFragmentShader The path to the fragment shader
+    /// \return The program, 0 if a file can't be read
     static int LoadShaders(const char * czVertexShader, const char * szGeometryShader, const char * csFragmentShader);
+
+    /// \brief  Tells if the program is still waiting for its status check
+    /// \param  program The program
+    static bool IsProgramPending(uint program);
+
+    /// \brief  Tells if the driver finished to build the program
+    ///         Without KHR_parallel_shader_compile the driver can't tell and
+    ///         the program is always reported as ready
+    /// \param  program The program
+    static bool IsProgramReady(uint program);
+
+    /// \brief  Waits for the program, reports its errors and releases its shaders
+    /// \param  program The program
+    /// \return True if the program is linked
+    static bool FinalizeProgram(uint program);
+
+private:
+
+    /// \brief A submitted program whose status was not checked yet
+    struct PendingProgram
+    {
+        std::vector<uint>        m_shaders;
+        std::vector<std::string> m_names;
+        std::string              m_cachePath;
+        uint64                   m_cacheKey;
+        bool                     m_bCache;
+    };
+
+    /// \brief  Logs the info log of a shader or a program
+    ///         Trailing line breaks are removed
+    /// \param  log The null terminated log
+    static void LogInfoLog(std::vector<char> & log);
+
+    /// \brief  Reads the source of a shader
+    /// \param  szPath The path to the shader
+    /// \param  code The source
+    /// \return False if the file can't be read
+    static bool ReadSource(const char * szPath, std::string & code);
+
+    /// \brief  Submits the compilation and the link of a program
+    /// \param  stageCount The number of shaders
+    /// \param  pStages The type of each shader
+    /// \param  pCodes The source of each shader
+    /// \param  pNames The name of each shader in the logs
+    /// \return The program
+    static uint SubmitProgram(uint stageCount, const uint * pStages, const char * const * pCodes, const char * const * pNames);
+
+    /// \brief  Returns the identification string of the driver
+    ///         A program binary is only valid for the driver that produced it
+    static std::string const& GetDriverString();
+
+    /// \brief  Tells if the driver can save and restore program binaries
+    static bool IsBinarySupported();
+
+    /// \brief  Creates a program from a cached binary
+    /// \param  path The file of the entry
+    /// \param  key The key of the sources
+    /// \return The program, 0 on a cache miss
+    static uint LoadCachedProgram(std::string const& path, uint64 key);
+
+    /// \brief Saves the binary of a linked program in the cache
+    /// \param path The file of the entry
+    /// \param key The key of the sources
+    /// \param program The linked program
+    static void StoreCachedProgram(std::string const& path, uint64 key, uint program);
+
+private:
+
+    static std::unordered_map<uint, PendingProgram> s_pendingPrograms;
 };
 
 } // !namespace
 
-#endif // !CARDINAL_ENGINE_SHADER_COMPILER_HPP__
\ No newline at end of file
+#endif // !CARDINAL_ENGINE_SHADER_COMPILER_HPP__
@@ -35,6 +35,8 @@ namespace cardinal
 
 /// \class ShaderManager
 /// \brief Stores shaders ID and provides a way to access it
+///        Registered programs may still be building, they are finalized
+///        the first time their ID is requested.
 class ShaderManager
 {
 public:
@@ -60,6 +62,7 @@ public:
     static void Unregister(std::string const& shaderKey);
 
     /// \brief Returns the shader ID references by the given key
+    ///        Waits for the program if it is still building
     /// \param shaderKey The key of the shader
     /// \return The shader ID
     static int GetShaderID(std::string const& shaderKey);
@@ -73,10 +76,17 @@ private:
     /// \brief  Default constuctor
     ShaderManager();
 
+    /// \brief A registered program
+    struct ShaderEntry
+    {
+        int  m_shaderID;
+        bool m_bFinalized; ///< The status of the program was checked
+    };
+
     // TODO : Use IDs
     // TODO : Destructor
 
-    std::unordered_map<std::string, int> m_textureIDs;
+    std::unordered_map<std::string, ShaderEntry> m_textureIDs;
 };
 
 } // !namespace
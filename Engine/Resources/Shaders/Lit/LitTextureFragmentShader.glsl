@@ -12,10 +12,26 @@ out vec3 color;
 // Uniforms
 uniform sampler2D textureSampler;
 
-uniform vec3  lightDirection;
-uniform float lightIntensity;
-uniform float ambientIntensity;
-uniform vec3  lightColor;
+// Lighting, see LightBuffer
+struct PointLight
+{
+    float range;
+    float intensity;
+    vec3  color;
+    vec3  position;
+};
+
+layout(std140) uniform Lights
+{
+    vec3       lightDirection;
+    float      lightIntensity;
+    vec3       lightColor;
+    float      ambientIntensity;
+    int        pointLightCount;
+    ivec4      clusterGrid;    // Clusters count, w = 0 when not clustered
+    vec4       clusterTile;    // Tile size in pixels, depth scale and bias
+    PointLight pointLights[256];
+};
 
 void main(void)
 {
@@ -15,7 +15,27 @@ out vec3 surface_normal;
 uniform mat4 M;
 uniform mat4 V;
 uniform mat4 MVP;
-uniform vec3 lightDirection;
+
+// Lighting, see LightBuffer
+struct PointLight
+{
+    float range;
+    float intensity;
+    vec3  color;
+    vec3  position;
+};
+
+layout(std140) uniform Lights
+{
+    vec3       lightDirection;
+    float      lightIntensity;
+    vec3       lightColor;
+    float      ambientIntensity;
+    int        pointLightCount;
+    ivec4      clusterGrid;    // Clusters count, w = 0 when not clustered
+    vec4       clusterTile;    // Tile size in pixels, depth scale and bias
+    PointLight pointLights[256];
+};
 
 void main()
 {
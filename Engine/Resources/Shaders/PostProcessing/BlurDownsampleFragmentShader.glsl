@@ -0,0 +1,23 @@
+#version 330 core
+
+// In
+in vec2 textureUV;
+
+// Out
+out vec3 color;
+
+// Uniform
+uniform sampler2D colorTexture;
+
+void main(void)
+{
+    // Each bilinear tap averages 2x2 source texels, the four taps cover 4x4
+    vec2 offset = vec2(1.0f) / vec2(textureSize(colorTexture, 0));
+
+    vec3 sum = texture(colorTexture, textureUV + vec2(-offset.x, -offset.y)).rgb;
+    sum     += texture(colorTexture, textureUV + vec2( offset.x, -offset.y)).rgb;
+    sum     += texture(colorTexture, textureUV + vec2(-offset.x,  offset.y)).rgb;
+    sum     += texture(colorTexture, textureUV + vec2( offset.x,  offset.y)).rgb;
+
+    color = sum * 0.25f;
+}
@@ -0,0 +1,26 @@
+#version 330 core
+
+// In
+in vec2 textureUV;
+
+// Out
+out vec3 color;
+
+// Uniform
+uniform sampler2D colorTexture;
+uniform vec2      direction;  // Step between two taps in uv
+uniform float     weights[5]; // Center tap first
+
+void main(void)
+{
+    vec3 sum = texture(colorTexture, textureUV).rgb * weights[0];
+
+    for(int i = 1; i < 5; ++i)
+    {
+        vec2 offset = direction * float(i);
+        sum += texture(colorTexture, textureUV + offset).rgb * weights[i];
+        sum += texture(colorTexture, textureUV - offset).rgb * weights[i];
+    }
+
+    color = sum;
+}
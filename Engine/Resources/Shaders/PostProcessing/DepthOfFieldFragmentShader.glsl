@@ -9,9 +9,9 @@ out vec3 color;
 // Uniform
 uniform sampler2D colorTexture;
 uniform sampler2D depthTexture;
+uniform sampler2D blurTexture; // Blurred by the blur chain at a lower resolution
 
 uniform float blurPlane;
-uniform int   intensity;
 
 float LinearizeDepth(in vec2 uv)
 {
@@ -27,24 +27,10 @@ void main(void)
 
     if(fragmentDepth >= (blurPlane / 2000.0f))
     {
-         vec3 fColor = vec3(0.0f, 0.0f, 0.0f);
-         vec2 offset = vec2(1.0f / 1600.0f, 1.0f / 900.0f);
-
-         int middle = intensity / 2;
-         for(int u = 0; u < intensity; ++u)
-         {
-             for(int v = 0; v < intensity; ++v)
-             {
-                 float oX = (u - middle) * offset.x;
-                 float oY = (v - middle) * offset.y;
-                 fColor += texture(colorTexture, vec2(textureUV.x + oX, textureUV.y + oY)).rgb;
-             }
-         }
-
-         color = fColor / (intensity * intensity);
+        color = texture(blurTexture, textureUV).rgb;
     }
     else
     {
         color = texture(colorTexture, textureUV).rgb;
     }
-}
\ No newline at end of file
+}
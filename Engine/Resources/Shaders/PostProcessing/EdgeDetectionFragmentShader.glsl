@@ -13,7 +13,7 @@ uniform int       weight;
 void main(void)
 {
     vec3 fColor = vec3(0.0f, 0.0f, 0.0f);
-    vec2 offset = vec2(1.0f / 1600.0f, 1.0f / 900.0f);
+    vec2 offset = vec2(1.0f) / vec2(textureSize(colorTexture, 0));
 
     float M[9] = float[](-1, -1, -1,   -1, weight, -1,   -1, -1, -1);
 
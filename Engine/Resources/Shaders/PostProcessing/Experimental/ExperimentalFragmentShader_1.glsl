@@ -52,7 +52,7 @@ void blur()
 {
     float transformation;
     float sum = 0;
-    vec2 offset = vec2(1.0f / 1600.0f, 1.0f / 900.0f);
+    vec2 offset = vec2(1.0f) / vec2(textureSize(colorTexture, 0));
     int intensity = 2;
 
     int radius = 5;
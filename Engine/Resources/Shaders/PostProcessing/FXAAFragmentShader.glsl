@@ -14,7 +14,7 @@ uniform float     FXAAReduceMin;
 
 void main( void )
 {
-    vec2 frameBufSize = vec2(1600, 900);
+    vec2 frameBufSize = vec2(textureSize(colorTexture, 0));
     vec3 rgbNW = texture(colorTexture,textureUV + (vec2(-1.0,-1.0) / frameBufSize)).xyz;
     vec3 rgbNE = texture(colorTexture,textureUV + (vec2( 1.0,-1.0) / frameBufSize)).xyz;
     vec3 rgbSW = texture(colorTexture,textureUV + (vec2(-1.0, 1.0) / frameBufSize)).xyz;
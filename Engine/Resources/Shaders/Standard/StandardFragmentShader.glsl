@@ -5,6 +5,7 @@ in vec2 uv;
 in vec3 light_vector;
 in vec3 vertex_world;
 in vec3 surface_normal;
+in float view_depth;
 
 struct PointLightOut
 {
@@ -24,14 +25,54 @@ out vec3 color;
 uniform sampler2D textureSampler;
 
 uniform vec3  lightPosition;
-uniform float lightIntensity;
-uniform float ambientIntensity;
-uniform vec3  lightColor;
 uniform int   lightCount;
+uniform float atlasTileStep;
+
+// Clustered lighting, see LightClusters
+uniform usamplerBuffer clusterCells;  // Offset and count of the lights of each cluster
+uniform usamplerBuffer clusterLights; // Light indices of the clusters
+
+// Lighting, see LightBuffer
+struct PointLight
+{
+    float range;
+    float intensity;
+    vec3  color;
+    vec3  position;
+};
+
+layout(std140) uniform Lights
+{
+    vec3       lightDirection;
+    float      lightIntensity;
+    vec3       lightColor;
+    float      ambientIntensity;
+    int        pointLightCount;
+    ivec4      clusterGrid;    // Clusters count, w = 0 when not clustered
+    vec4       clusterTile;    // Tile size in pixels, depth scale and bias
+    PointLight pointLights[256];
+};
+
+// Must match the stride used by the greedy terrain batching
+const float atlasUVStride = 32.0f;
 
 void main(void)
 {
-    vec3  diffuse = texture(textureSampler, uv).rgb;
+    vec3 diffuse;
+
+    if(atlasTileStep > 0.0f)
+    {
+        // Packed UVs : tile * stride + repeat count, wraps each repeat in the tile
+        vec2 tile     = floor(uv / atlasUVStride);
+        vec2 atlasUV  = (tile + fract(uv - tile * atlasUVStride)) * atlasTileStep;
+        vec2 gradient = uv * atlasTileStep;
+
+        diffuse = textureGrad(textureSampler, atlasUV, dFdx(gradient), dFdy(gradient)).rgb;
+    }
+    else
+    {
+        diffuse = texture(textureSampler, uv).rgb;
+    }
 
     vec3 n = normalize(surface_normal);
     vec3 l = normalize(light_vector);
@@ -45,7 +86,37 @@ void main(void)
     vec3  _lightColor   = vec3(0.0f);
     vec3  pointLighting = vec3(0.0f);
 
-    for(int i = 0; i < lightCount; ++i)
+    int shadedCount = lightCount;
+
+    if(clusterGrid.w != 0)
+    {
+        ivec2 tile    = ivec2(gl_FragCoord.xy / clusterTile.xy);
+        int   slice   = int(floor(log(max(view_depth, 1e-4f)) * clusterTile.z + clusterTile.w));
+        tile          = clamp(tile,  ivec2(0), clusterGrid.xy - 1);
+        slice         = clamp(slice, 0,        clusterGrid.z  - 1);
+
+        uvec2 cell    = texelFetch(clusterCells, (slice * clusterGrid.y + tile.y) * clusterGrid.x + tile.x).rg;
+        shadedCount   = int(cell.y);
+
+        for(int i = 0; i < shadedCount; ++i)
+        {
+            PointLight light  = pointLights[texelFetch(clusterLights, int(cell.x) + i).r];
+            vec3       vector = light.position - vertex_world;
+
+            l         = normalize(vector);
+            _distance = length   (vector);
+
+            if(_distance <= light.range)
+            {
+                _brightness += max(0.0f, (max(dot(n, l), 1.0f)) * pow(smoothstep(light.range, 0.1f, _distance), 1.0f));
+            }
+
+            _lightColor += light.color;
+            _intensity  += light.intensity / 5.0f;
+        }
+    }
+
+    for(int i = 0; i < lightCount && clusterGrid.w == 0; ++i)
     {
         l         = normalize(lights_out[i].point_light_vector);
         _distance = length   (lights_out[i].point_light_vector);
@@ -61,9 +132,9 @@ void main(void)
 
     pointLighting = diffuse * _lightColor * _intensity * _brightness;
 
-    if(lightCount > 1)
+    if(shadedCount > 1)
     {
-        pointLighting /= lightCount;
+        pointLighting /= shadedCount;
     }
 
     color = worldLighting + pointLighting;
@@ -10,6 +10,7 @@ out vec2 uv;
 out vec3 light_vector;
 out vec3 vertex_world;
 out vec3 surface_normal;
+out float view_depth;
 
 struct PointLightOut
 {
@@ -26,9 +27,8 @@ out PointLightOut lights_out[4];
 uniform mat4 M;
 uniform mat4 V;
 uniform mat4 MVP;
-uniform vec3 lightDirection;
 
-// Lighting
+// Lighting, see LightBuffer
 struct PointLight
 {
     float range;
@@ -37,8 +37,21 @@ struct PointLight
     vec3  position;
 };
 
-uniform int        lightCount;
-uniform PointLight lights[4];
+layout(std140) uniform Lights
+{
+    vec3       lightDirection;
+    float      lightIntensity;
+    vec3       lightColor;
+    float      ambientIntensity;
+    int        pointLightCount;
+    ivec4      clusterGrid;    // Clusters count, w = 0 when not clustered
+    vec4       clusterTile;    // Tile size in pixels, depth scale and bias
+    PointLight pointLights[256];
+};
+
+// The nearest lights of the object
+uniform int   lightCount;
+uniform ivec4 lightIndices;
 
 void main()
 {
@@ -47,43 +60,28 @@ void main()
 
     vec3 vertexPosition_cameraspace = (V * M * vec4(vertex_position, 1.0f)).xyz;
     light_vector = -(vec4(lightDirection, 1.0f)).xyz;
+    view_depth   = -vertexPosition_cameraspace.z;
 
     surface_normal = (M * vec4(vertex_normal, 0.0f)).xyz;
     uv             = vertex_uv;
 
-    if(lightCount > 0)
+    // Clustered lighting reads the lights per fragment
+    if(clusterGrid.w != 0)
     {
-        lights_out[0].point_light_range     = lights[0].range;
-        lights_out[0].point_light_intensity = lights[0].intensity;
-        lights_out[0].point_light_color     = lights[0].color;
-        lights_out[0].point_light_pos       = lights[0].position;
-        lights_out[0].point_light_vector    = lights[0].position - vertex_world;
+        return;
     }
 
-    if(lightCount > 1)
+    for(int i = 0; i < 4; ++i)
     {
-        lights_out[1].point_light_range     = lights[1].range;
-        lights_out[1].point_light_intensity = lights[1].intensity;
-        lights_out[1].point_light_color     = lights[1].color;
-        lights_out[1].point_light_pos       = lights[1].position;
-        lights_out[1].point_light_vector    = lights[1].position - vertex_world;
-     }
+        if(i < lightCount)
+        {
+            PointLight light = pointLights[lightIndices[i]];
 
-    if(lightCount > 2)
-    {
-        lights_out[2].point_light_range     = lights[2].range;
-        lights_out[2].point_light_intensity = lights[2].intensity;
-        lights_out[2].point_light_color     = lights[2].color;
-        lights_out[2].point_light_pos       = lights[2].position;
-        lights_out[2].point_light_vector    = lights[2].position - vertex_world;
-    }
-
-    if(lightCount > 3)
-    {
-        lights_out[3].point_light_range     = lights[3].range;
-        lights_out[3].point_light_intensity = lights[3].intensity;
-        lights_out[3].point_light_color     = lights[3].color;
-        lights_out[3].point_light_pos       = lights[3].position;
-        lights_out[3].point_light_vector    = lights[3].position - vertex_world;
+            lights_out[i].point_light_range     = light.range;
+            lights_out[i].point_light_intensity = light.intensity;
+            lights_out[i].point_light_color     = light.color;
+            lights_out[i].point_light_pos       = light.position;
+            lights_out[i].point_light_vector    = light.position - vertex_world;
+        }
     }
 }
\ No newline at end of file
@@ -0,0 +1,200 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       WorkerPool.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Core/Thread
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Core/Thread/WorkerPool.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+WorkerPool::WorkerPool()
+: m_pJob(nullptr)
+, m_jobCount(0)
+, m_nextJob(0)
+, m_doneJobs(0)
+, m_batch(0)
+, m_busyWorkers(0)
+, m_bStop(false)
+{
+    // None
+}
+
+/// \brief Destructor, stops the workers
+WorkerPool::~WorkerPool()
+{
+    Shutdown();
+}
+
+/// \brief Starts the workers
+/// \param threadCount The number of threads working on jobs, including
+///        the calling thread. 0 means one thread per hardware thread.
+void WorkerPool::Initialize(size_t threadCount)
+{
+    Shutdown();
+
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+    }
+
+    // The batches already run are not the new workers' ones. The batch is
+    // read here and not by the workers, one could start after the next batch
+    uint64_t lastBatch = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bStop   = false;
+        lastBatch = m_batch;
+    }
+
+    for (size_t nWorker = 1; nWorker < threadCount; ++nWorker)
+    {
+        m_workers.emplace_back(&WorkerPool::WorkerLoop, this, lastBatch);
+    }
+}
+
+/// \brief Stops and joins the workers
+void WorkerPool::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bStop = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread & worker : m_workers)
+    {
+        worker.join();
+    }
+
+    m_workers.clear();
+}
+
+/// \brief Runs the jobs [0, count) and waits for their completion
+///        Not reentrant, the jobs must not call ParallelFor
+/// \param count The number of jobs
+/// \param job The job to run
+void WorkerPool::ParallelFor(int count, Job const& job)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    // Not worth waking the workers
+    if (count == 1 || m_workers.empty())
+    {
+        for (int nJob = 0; nJob < count; ++nJob)
+        {
+            job(nJob);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ASSERT_TRUE(m_pJob == nullptr);
+
+        m_pJob        = &job;
+        m_jobCount    = count;
+        m_nextJob     = 0;
+        m_doneJobs    = 0;
+        m_busyWorkers = static_cast<int>(m_workers.size());
+        m_batch++;
+    }
+
+    m_wakeCondition.notify_all();
+
+    // The calling thread helps
+    RunJobs();
+
+    // Waits for the jobs and for the workers to leave the batch,
+    // the job is a reference on the stack of the caller
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this]
+    {
+        return m_doneJobs.load() == m_jobCount && m_busyWorkers == 0;
+    });
+
+    m_pJob = nullptr;
+}
+
+/// \brief Returns the number of threads working on jobs, including the caller
+size_t WorkerPool::GetThreadCount() const
+{
+    return m_workers.size() + 1;
+}
+
+/// \brief Worker loop, waits for a batch of jobs and helps on it
+/// \param firstBatch The last batch run before the worker started
+void WorkerPool::WorkerLoop(uint64_t firstBatch)
+{
+    uint64_t lastBatch = firstBatch;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [this, lastBatch]
+            {
+                return m_bStop || m_batch != lastBatch;
+            });
+
+            if (m_bStop)
+            {
+                return;
+            }
+
+            // Only woken by a running batch, never by a past one
+            ASSERT_TRUE(m_pJob != nullptr);
+            lastBatch = m_batch;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busyWorkers--;
+        }
+
+        m_doneCondition.notify_one();
+    }
+}
+
+/// \brief Runs the jobs of the current batch until there is none left
+void WorkerPool::RunJobs()
+{
+    int nJob = m_nextJob.fetch_add(1);
+    while (nJob < m_jobCount)
+    {
+        (*m_pJob)(nJob);
+        m_doneJobs.fetch_add(1);
+
+        nJob = m_nextJob.fetch_add(1);
+    }
+}
+
+} // !namespace
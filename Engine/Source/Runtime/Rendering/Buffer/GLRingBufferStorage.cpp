@@ -0,0 +1,177 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       GLRingBufferStorage.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Glew/include/GL/glew.h"
+
+#include "Runtime/Core/Debug/Logger.hpp"
+#include "Runtime/Rendering/Buffer/GLRingBufferStorage.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+/// \param target The GL binding target of the buffer
+GLRingBufferStorage::GLRingBufferStorage(uint target)
+: m_target(target)
+, m_buffer(0)
+, m_bPersistent(false)
+, m_pMapping(nullptr)
+{
+    // None
+}
+
+/// \brief Destructor
+GLRingBufferStorage::~GLRingBufferStorage()
+{
+    Release();
+}
+
+/// \brief  (Re)creates the storage, the previous content is lost
+/// \param  size The size in bytes
+/// \return True on success
+bool GLRingBufferStorage::Allocate(size_t size)
+{
+    Release();
+
+    glGenBuffers(1, &m_buffer);
+    glBindBuffer(m_target, m_buffer);
+
+    m_bPersistent = GLEW_ARB_buffer_storage != 0;
+    if (m_bPersistent)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glBufferStorage(m_target, static_cast<GLsizeiptr>(size), nullptr, flags);
+        m_pMapping = static_cast<uchar *>(glMapBufferRange(m_target, 0, static_cast<GLsizeiptr>(size), flags));
+
+        if (m_pMapping == nullptr)
+        {
+            Logger::LogError("Unable to map a ring buffer persistently");
+            glBindBuffer(m_target, 0);
+            Release();
+            return false;
+        }
+    }
+    else
+    {
+        glBufferData(m_target, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(m_target, 0);
+    return true;
+}
+
+/// \brief Releases the storage
+void GLRingBufferStorage::Release()
+{
+    if (m_buffer == 0)
+    {
+        return;
+    }
+
+    if (m_pMapping != nullptr)
+    {
+        glBindBuffer  (m_target, m_buffer);
+        glUnmapBuffer (m_target);
+        glBindBuffer  (m_target, 0);
+    }
+
+    glDeleteBuffers(1, &m_buffer);
+
+    m_buffer      = 0;
+    m_pMapping    = nullptr;
+    m_bPersistent = false;
+}
+
+/// \brief  Returns a pointer to write a range of the storage
+/// \param  offset The offset of the range in bytes
+/// \param  size The size of the range in bytes
+/// \return The pointer, valid until UnmapRange
+void * GLRingBufferStorage::MapRange(size_t offset, size_t size)
+{
+    if (m_bPersistent)
+    {
+        return m_pMapping + offset;
+    }
+
+    // The ring guarantees the GPU is done with the range
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+
+    glBindBuffer(m_target, m_buffer);
+    return glMapBufferRange(m_target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), flags);
+}
+
+/// \brief Makes the written range visible to the GPU
+/// \param offset The offset of the range in bytes
+/// \param size The size of the range in bytes
+void GLRingBufferStorage::UnmapRange(size_t /* offset */, size_t /* size */)
+{
+    if (m_bPersistent)
+    {
+        // Coherent mapping, nothing to flush
+        return;
+    }
+
+    glBindBuffer (m_target, m_buffer);
+    glUnmapBuffer(m_target);
+    glBindBuffer (m_target, 0);
+}
+
+/// \brief  Inserts a fence after the commands issued so far
+/// \return The fence
+IRingBufferStorage::Fence GLRingBufferStorage::InsertFence()
+{
+    return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+/// \brief  Blocks until the fence is signaled, then deletes it
+/// \param  fence The fence to wait for
+/// \return True if the fence was not signaled yet
+bool GLRingBufferStorage::WaitFence(Fence fence)
+{
+    GLsync sync = static_cast<GLsync>(fence);
+
+    // Flushes on the first wait so that the fence is eventually signaled
+    GLbitfield flags   = GL_SYNC_FLUSH_COMMANDS_BIT;
+    GLenum     status  = glClientWaitSync(sync, flags, 0);
+    bool       bWaited = false;
+
+    while (status == GL_TIMEOUT_EXPIRED)
+    {
+        bWaited = true;
+        status  = glClientWaitSync(sync, flags, 1000000); // 1 ms
+        flags   = 0;
+    }
+
+    glDeleteSync(sync);
+    return bWaited;
+}
+
+/// \brief Returns the GL name of the buffer
+uint GLRingBufferStorage::GetBufferID() const
+{
+    return m_buffer;
+}
+
+} // !namespace
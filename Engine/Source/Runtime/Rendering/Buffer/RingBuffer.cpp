@@ -0,0 +1,202 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RingBuffer.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Buffer/RingBuffer.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+RingBuffer::RingBuffer()
+: m_pStorage(nullptr)
+, m_regionSize(0)
+, m_mappedSize(0)
+, m_region(0)
+, m_bWritten(false)
+, m_waitCount(0)
+{
+    for (IRingBufferStorage::Fence & fence : m_fences)
+    {
+        fence = nullptr;
+    }
+}
+
+/// \brief Destructor
+RingBuffer::~RingBuffer()
+{
+    Release();
+}
+
+/// \brief Initializes the ring
+/// \param pStorage The storage of the ring, owned by the ring
+/// \param regionSize The size of a region in bytes
+/// \return True on success
+bool RingBuffer::Initialize(IRingBufferStorage * pStorage, size_t regionSize)
+{
+    ASSERT_NOT_NULL(pStorage);
+
+    Release();
+
+    m_pStorage = pStorage;
+    return Reserve(regionSize);
+}
+
+/// \brief Waits for the GPU and releases the storage
+void RingBuffer::Release()
+{
+    if (m_pStorage == nullptr)
+    {
+        return;
+    }
+
+    WaitAll();
+
+    m_pStorage->Release();
+    delete m_pStorage;
+
+    m_pStorage   = nullptr;
+    m_regionSize = 0;
+    m_mappedSize = 0;
+    m_region     = 0;
+    m_bWritten   = false;
+}
+
+/// \brief  Grows the regions, waits for the GPU if needed
+/// \param  regionSize The minimal size of a region in bytes
+/// \return True if the storage was reallocated
+bool RingBuffer::Reserve(size_t regionSize)
+{
+    ASSERT_NOT_NULL(m_pStorage);
+    ASSERT_EQ(m_mappedSize, 0u);
+
+    if (regionSize <= m_regionSize)
+    {
+        return false;
+    }
+
+    // The regions must stay aligned
+    regionSize = (regionSize + s_alignment - 1) & ~(s_alignment - 1);
+
+    WaitAll();
+
+    if (!m_pStorage->Allocate(regionSize * s_regionCount))
+    {
+        m_regionSize = 0;
+        return false;
+    }
+
+    // The first Map writes the region 0
+    m_regionSize = regionSize;
+    m_region     = s_regionCount - 1;
+    m_bWritten   = false;
+    return true;
+}
+
+/// \brief  Fences the current region and maps the next one
+/// \param  size The number of bytes to write, at most the region size
+/// \return The pointer to write
+void * RingBuffer::Map(size_t size)
+{
+    ASSERT_NOT_NULL(m_pStorage);
+    ASSERT_EQ(m_mappedSize, 0u);
+    ASSERT_TRUE(size <= m_regionSize);
+
+    // The commands issued so far are the last ones reading the current region
+    if (m_bWritten && m_fences[m_region] == nullptr)
+    {
+        m_fences[m_region] = m_pStorage->InsertFence();
+    }
+
+    m_region   = (m_region + 1) % s_regionCount;
+    m_bWritten = true;
+
+    if (m_fences[m_region] != nullptr)
+    {
+        if (m_pStorage->WaitFence(m_fences[m_region]))
+        {
+            m_waitCount++;
+        }
+
+        m_fences[m_region] = nullptr;
+    }
+
+    m_mappedSize = (size == 0) ? 1 : size;
+    return m_pStorage->MapRange(GetOffset(), m_mappedSize);
+}
+
+/// \brief Ends the writes started by Map
+void RingBuffer::Unmap()
+{
+    ASSERT_NOT_NULL(m_pStorage);
+    ASSERT_NE(m_mappedSize, 0u);
+
+    m_pStorage->UnmapRange(GetOffset(), m_mappedSize);
+    m_mappedSize = 0;
+}
+
+/// \brief Returns the offset of the current region in bytes
+size_t RingBuffer::GetOffset() const
+{
+    return static_cast<size_t>(m_region) * m_regionSize;
+}
+
+/// \brief Returns the size of a region in bytes
+size_t RingBuffer::GetRegionSize() const
+{
+    return m_regionSize;
+}
+
+/// \brief Returns the GL name of the buffer
+uint RingBuffer::GetBufferID() const
+{
+    return m_pStorage != nullptr ? m_pStorage->GetBufferID() : 0;
+}
+
+/// \brief Returns the number of writes that had to wait for the GPU
+uint64 RingBuffer::GetWaitCount() const
+{
+    return m_waitCount;
+}
+
+/// \brief Waits for all regions
+void RingBuffer::WaitAll()
+{
+    // The current region may still be read by the GPU
+    if (m_bWritten && m_fences[m_region] == nullptr)
+    {
+        m_fences[m_region] = m_pStorage->InsertFence();
+    }
+
+    for (IRingBufferStorage::Fence & fence : m_fences)
+    {
+        if (fence != nullptr)
+        {
+            m_pStorage->WaitFence(fence);
+            fence = nullptr;
+        }
+    }
+}
+
+} // !namespace
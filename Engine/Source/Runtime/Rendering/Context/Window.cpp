@@ -64,9 +64,6 @@ void Window::Initialize(int width, int height, const char *szTitle)
     ASSERT_GT(width,  0);
     ASSERT_GT(height, 0);
 
-    ASSERT_LT(width, 1920);
-    ASSERT_LT(height, 1080);
-
     if(m_pWindow != nullptr)
     {
         Destroy();
@@ -134,6 +131,22 @@ GLFWwindow * Window::GetContext() const
     return m_pWindow;
 }
 
+/// \brief  Returns the size of the window in screen coordinates
+/// \param  width The width of the window
+/// \param  height The height of the window
+void Window::GetSize(int & width, int & height) const
+{
+    glfwGetWindowSize(m_pWindow, &width, &height);
+}
+
+/// \brief  Returns the size of the window in pixels
+/// \param  width The width of the frame buffer
+/// \param  height The height of the frame buffer
+void Window::GetFramebufferSize(int & width, int & height) const
+{
+    glfwGetFramebufferSize(m_pWindow, &width, &height);
+}
+
 } // !namespace
 
 
@@ -0,0 +1,127 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightBuffer.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstring>
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Lighting/LightBuffer.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ const int    LightBuffer::s_maxPointLights;
+/* static */ const uint   LightBuffer::s_bindingPoint;
+/* static */ const size_t LightBuffer::s_pointLightOffset;
+/* static */ const size_t LightBuffer::s_pointLightStride;
+/* static */ const size_t LightBuffer::s_capacity;
+
+/// \brief Constructor, no light
+LightBuffer::LightBuffer()
+: m_pointLightCount(0)
+{
+    memset(m_data, 0, sizeof(m_data));
+}
+
+/// \brief Sets the directional light
+/// \param direction The direction of the light
+/// \param intensity The intensity of the light
+/// \param ambient The ambient intensity
+/// \param color The color of the light
+void LightBuffer::SetDirectionalLight(glm::vec3 const& direction, float intensity, float ambient, glm::vec3 const& color)
+{
+    WriteVec3 ( 0, direction);
+    WriteFloat(12, intensity);
+    WriteVec3 (16, color);
+    WriteFloat(28, ambient);
+}
+
+/// \brief Sets a point light
+/// \param index The index of the light, below s_maxPointLights
+/// \param light The light
+void LightBuffer::SetPointLight(int index, PointLightStructure const& light)
+{
+    ASSERT_TRUE(index >= 0 && index < s_maxPointLights);
+
+    const size_t offset = s_pointLightOffset + static_cast<size_t>(index) * s_pointLightStride;
+
+    WriteFloat(offset +  0, light.range);
+    WriteFloat(offset +  4, light.intensity);
+    WriteVec3 (offset + 16, light.color);
+    WriteVec3 (offset + 32, light.position);
+}
+
+/// \brief Sets the clustered lighting parameters
+/// \param grid The number of clusters per axis, w enables the clusters
+/// \param tile The size of a tile in pixels, the depth slicing scale and bias
+void LightBuffer::SetClusters(glm::ivec4 const& grid, glm::vec4 const& tile)
+{
+    memcpy(m_data + 48, &grid[0], 4 * sizeof(int));
+    memcpy(m_data + 64, &tile[0], 4 * sizeof(float));
+}
+
+/// \brief Sets the number of point lights, clamped to s_maxPointLights
+/// \param count The number of point lights
+void LightBuffer::SetPointLightCount(int count)
+{
+    m_pointLightCount = count < s_maxPointLights ? count : s_maxPointLights;
+    WriteInt(32, m_pointLightCount);
+}
+
+/// \brief Returns the number of point lights
+int LightBuffer::GetPointLightCount() const
+{
+    return m_pointLightCount;
+}
+
+/// \brief Returns the packed block
+uchar const * LightBuffer::GetData() const
+{
+    return m_data;
+}
+
+/// \brief Returns the size in bytes of the packed block up to the last point light
+size_t LightBuffer::GetSize() const
+{
+    return s_pointLightOffset + static_cast<size_t>(m_pointLightCount) * s_pointLightStride;
+}
+
+/// \brief Writes a float at the given offset
+void LightBuffer::WriteFloat(size_t offset, float value)
+{
+    memcpy(m_data + offset, &value, sizeof(float));
+}
+
+/// \brief Writes a vec3 at the given offset
+void LightBuffer::WriteVec3(size_t offset, glm::vec3 const& value)
+{
+    memcpy(m_data + offset, &value[0], 3 * sizeof(float));
+}
+
+/// \brief Writes an int at the given offset
+void LightBuffer::WriteInt(size_t offset, int value)
+{
+    memcpy(m_data + offset, &value, sizeof(int));
+}
+
+} // !namespace
@@ -0,0 +1,257 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightClusters.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <algorithm>
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Lighting/LightClusters.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+LightClusters::LightClusters()
+: m_projection(0.0f)
+, m_near(0.1f)
+, m_far(1.0f)
+, m_tanX(1.0f)
+, m_tanY(1.0f)
+, m_depthScale(0.0f)
+, m_depthBias(0.0f)
+, m_sliceDepth(s_clusterZ + 1, 0.0f)
+, m_clusterMin(s_clusterCount)
+, m_clusterMax(s_clusterCount)
+, m_cells(s_clusterCount * 2, 0)
+{
+    // None
+}
+
+/// \brief Sets the perspective projection, rebuilds the clusters if it changed
+/// \param projection The projection matrix
+void LightClusters::SetProjection(glm::mat4 const& projection)
+{
+    if (projection == m_projection)
+    {
+        return;
+    }
+
+    m_projection = projection;
+    m_tanX       = 1.0f / projection[0][0];
+    m_tanY       = 1.0f / projection[1][1];
+    m_near       = projection[3][2] / (projection[2][2] - 1.0f);
+    m_far        = projection[3][2] / (projection[2][2] + 1.0f);
+
+    // Exponential slices, each cluster is about as deep as wide
+    const float logRatio = std::log(m_far / m_near);
+    m_depthScale = s_clusterZ / logRatio;
+    m_depthBias  = -s_clusterZ * std::log(m_near) / logRatio;
+
+    for (int z = 0; z <= s_clusterZ; ++z)
+    {
+        m_sliceDepth[z] = m_near * std::pow(m_far / m_near, static_cast<float>(z) / s_clusterZ);
+    }
+
+    for (int z = 0; z < s_clusterZ; ++z)
+    {
+        const float zn = m_sliceDepth[z];
+        const float zf = m_sliceDepth[z + 1];
+
+        for (int y = 0; y < s_clusterY; ++y)
+        {
+            const float y0 = -1.0f + 2.0f *  y      / s_clusterY;
+            const float y1 = -1.0f + 2.0f * (y + 1) / s_clusterY;
+
+            for (int x = 0; x < s_clusterX; ++x)
+            {
+                const float x0 = -1.0f + 2.0f *  x      / s_clusterX;
+                const float x1 = -1.0f + 2.0f * (x + 1) / s_clusterX;
+
+                // The tile widens with the depth, the bounds enclose both ends
+                const int cluster = GetClusterIndex(x, y, z);
+                m_clusterMin[cluster] = glm::vec3(
+                        std::min(x0 * zn, x0 * zf) * m_tanX,
+                        std::min(y0 * zn, y0 * zf) * m_tanY,
+                        -zf);
+                m_clusterMax[cluster] = glm::vec3(
+                        std::max(x1 * zn, x1 * zf) * m_tanX,
+                        std::max(y1 * zn, y1 * zf) * m_tanY,
+                        -zn);
+            }
+        }
+    }
+}
+
+/// \brief Assigns the lights to the clusters
+/// \param view The view matrix
+/// \param pPositions The world positions of the lights
+/// \param pRanges The ranges of the lights
+/// \param count The number of lights
+void LightClusters::Assign(glm::mat4 const& view, glm::vec3 const * pPositions, float const * pRanges, int count)
+{
+    ASSERT_TRUE(count < (1 << 20));
+
+    m_pairs.clear();
+    std::fill(m_cells.begin(), m_cells.end(), 0u);
+
+    for (int nLight = 0; nLight < count; ++nLight)
+    {
+        const glm::vec3 center = glm::vec3(view * glm::vec4(pPositions[nLight], 1.0f));
+        const float     radius = pRanges[nLight];
+        const float     depth  = -center.z;
+
+        if (depth + radius < m_near || depth - radius > m_far)
+        {
+            continue;
+        }
+
+        // One slice of margin, the exact test is done on the bounds
+        const int z0 = std::max(GetSlice(std::max(depth - radius, m_near)) - 1, 0);
+        const int z1 = std::min(GetSlice(std::min(depth + radius, m_far))  + 1, s_clusterZ - 1);
+
+        for (int z = z0; z <= z1; ++z)
+        {
+            // The x bounds of a cluster only depend on its column and its slice,
+            // the y bounds on its row and its slice, the candidates are separable
+            int x0 = s_clusterX, x1 = -1;
+            for (int x = 0; x < s_clusterX; ++x)
+            {
+                const int cluster = GetClusterIndex(x, 0, z);
+                if (m_clusterMin[cluster].x <= center.x + radius && m_clusterMax[cluster].x >= center.x - radius)
+                {
+                    x0 = std::min(x0, x);
+                    x1 = x;
+                }
+            }
+
+            int y0 = s_clusterY, y1 = -1;
+            for (int y = 0; y < s_clusterY; ++y)
+            {
+                const int cluster = GetClusterIndex(0, y, z);
+                if (m_clusterMin[cluster].y <= center.y + radius && m_clusterMax[cluster].y >= center.y - radius)
+                {
+                    y0 = std::min(y0, y);
+                    y1 = y;
+                }
+            }
+
+            for (int y = y0; y <= y1; ++y)
+            {
+                for (int x = x0; x <= x1; ++x)
+                {
+                    const int cluster = GetClusterIndex(x, y, z);
+                    if (Intersects(cluster, center, radius))
+                    {
+                        m_pairs.push_back(static_cast<uint>(nLight) << 12u | static_cast<uint>(cluster));
+                        m_cells[cluster * 2 + 1]++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Counting sort of the hits by cluster, lights stay in increasing order
+    uint offset = 0;
+    for (int nCluster = 0; nCluster < s_clusterCount; ++nCluster)
+    {
+        m_cells[nCluster * 2] = offset;
+        offset += m_cells[nCluster * 2 + 1];
+    }
+
+    m_lightIndices.resize(m_pairs.size());
+    for (int nCluster = 0; nCluster < s_clusterCount; ++nCluster)
+    {
+        m_cells[nCluster * 2 + 1] = m_cells[nCluster * 2];
+    }
+
+    for (uint pair : m_pairs)
+    {
+        const uint cluster = pair & 0xFFFu;
+        m_lightIndices[m_cells[cluster * 2 + 1]++] = pair >> 12u;
+    }
+
+    for (int nCluster = 0; nCluster < s_clusterCount; ++nCluster)
+    {
+        m_cells[nCluster * 2 + 1] -= m_cells[nCluster * 2];
+    }
+}
+
+/// \brief Returns the offset and the count of the lights of each cluster, interleaved
+std::vector<uint> const& LightClusters::GetCells() const
+{
+    return m_cells;
+}
+
+/// \brief Returns the light indices of all clusters
+std::vector<uint> const& LightClusters::GetLightIndices() const
+{
+    return m_lightIndices;
+}
+
+/// \brief Returns the index of a cluster
+/* static */ int LightClusters::GetClusterIndex(int x, int y, int z)
+{
+    return (z * s_clusterY + y) * s_clusterX + x;
+}
+
+/// \brief Returns the depth slice of a view depth, slice = log(depth) * scale + bias
+int LightClusters::GetSlice(float depth) const
+{
+    int slice = static_cast<int>(std::floor(std::log(depth) * m_depthScale + m_depthBias));
+    return std::min(std::max(slice, 0), s_clusterZ - 1);
+}
+
+/// \brief Returns the scale of the depth slicing
+float LightClusters::GetDepthScale() const
+{
+    return m_depthScale;
+}
+
+/// \brief Returns the bias of the depth slicing
+float LightClusters::GetDepthBias() const
+{
+    return m_depthBias;
+}
+
+/// \brief Returns the view space bounds of a cluster
+/// \param cluster The index of the cluster
+/// \param min The min corner
+/// \param max The max corner
+void LightClusters::GetClusterBounds(int cluster, glm::vec3 & min, glm::vec3 & max) const
+{
+    min = m_clusterMin[cluster];
+    max = m_clusterMax[cluster];
+}
+
+/// \brief  Tests a sphere against the view space bounds of a cluster
+/// \return True if they intersect
+bool LightClusters::Intersects(int cluster, glm::vec3 const& center, float radius) const
+{
+    const glm::vec3 closest = glm::clamp(center, m_clusterMin[cluster], m_clusterMax[cluster]);
+    const glm::vec3 delta   = closest - center;
+
+    return glm::dot(delta, delta) <= radius * radius;
+}
+
+} // !namespace
@@ -26,10 +26,6 @@
 #include "Runtime/Core/Debug/Logger.hpp"
 #include "Runtime/Core/Assertion/Assert.hh"
 
-#include "Runtime/Rendering/Shader/ShaderManager.hpp"
-#include "Runtime/Rendering/Shader/Built-in/Lit/LitTextureShader.hpp"
-#include "Runtime/Rendering/Shader/Built-in/Standard/StandardShader.hpp"
-
 #include "Runtime/Rendering/Lighting/LightManager.hpp"
 #include "Runtime/Rendering/Lighting/Lights/PointLight.hpp"
 #include "Runtime/Rendering/Lighting/Lights/DirectionalLight.hpp"
@@ -46,6 +42,20 @@ namespace cardinal
     if(LightManager::s_pInstance == nullptr)
     {
         LightManager::s_pInstance = new LightManager();
+
+        // Shared by all lit programs, see LightBuffer
+        glGenBuffers    (1, &s_pInstance->m_uniformBuffer);
+        glBindBuffer    (GL_UNIFORM_BUFFER, s_pInstance->m_uniformBuffer);
+        glBufferData    (GL_UNIFORM_BUFFER, LightBuffer::s_capacity, nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer    (GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, LightBuffer::s_bindingPoint, s_pInstance->m_uniformBuffer);
+
+        // Clustered lighting, read with texelFetch by the shaders
+        glGenBuffers (1, &s_pInstance->m_clusterCellsBuffer);
+        glGenBuffers (1, &s_pInstance->m_clusterLightsBuffer);
+        glGenTextures(1, &s_pInstance->m_clusterCellsTexture);
+        glGenTextures(1, &s_pInstance->m_clusterLightsTexture);
+
         Logger::LogInfo("Light manager successfully initialized");
     }
     else
@@ -59,6 +69,11 @@ namespace cardinal
 {
     if(LightManager::s_pInstance != nullptr)
     {
+        glDeleteBuffers (1, &s_pInstance->m_uniformBuffer);
+        glDeleteBuffers (1, &s_pInstance->m_clusterCellsBuffer);
+        glDeleteBuffers (1, &s_pInstance->m_clusterLightsBuffer);
+        glDeleteTextures(1, &s_pInstance->m_clusterCellsTexture);
+        glDeleteTextures(1, &s_pInstance->m_clusterLightsTexture);
         delete LightManager::s_pInstance;
         LightManager::s_pInstance = nullptr;
 
@@ -95,7 +110,13 @@ namespace cardinal
 }
 
 /// \brief Called just before rendering
-/* static */ void LightManager::OnRenderBegin()
+///        Uploads all lights in the lights uniform block and indexes them
+/// \param projection The projection matrix of the main pass
+/// \param view The view matrix of the main pass
+/// \param width The width of the main pass viewport
+/// \param height The height of the main pass viewport
+/// \param bClustered Assigns the lights to the view clusters
+/* static */ void LightManager::OnRenderBegin(glm::mat4 const& projection, glm::mat4 const& view, int width, int height, bool bClustered)
 {
     ASSERT_NOT_NULL(s_pInstance);
 
@@ -113,17 +134,98 @@ namespace cardinal
         lightColor       = s_pInstance->m_pDirectional->GetLightColor();
     }
 
-    glUseProgram ((uint)ShaderManager::GetShaderID("LitTexture"));
-    glUniform1f  (LitTextureShader::s_lightIntensity,   lightIntensity);
-    glUniform1f  (LitTextureShader::s_ambientIntensity, ambientIntensity);
-    glUniform3f  (LitTextureShader::s_lightDirection,   direction.x,    direction.y,    direction.z);
-    glUniform3f  (LitTextureShader::s_lightColor,       lightColor.x,   lightColor.y,   lightColor.z);
-
-    glUseProgram ((uint)ShaderManager::GetShaderID("Standard"));
-    glUniform1f  (StandardShader::s_lightIntensity,     lightIntensity);
-    glUniform1f  (StandardShader::s_ambientIntensity,   ambientIntensity);
-    glUniform3f  (StandardShader::s_lightDirection,     direction.x,    direction.y,    direction.z);
-    glUniform3f  (StandardShader::s_lightColor,         lightColor.x,   lightColor.y,   lightColor.z);
+    LightBuffer & buffer = s_pInstance->m_lightBuffer;
+    buffer.SetDirectionalLight(direction, lightIntensity, ambientIntensity, lightColor);
+
+    std::vector<PointLight *> const& pointLights = s_pInstance->m_pointLights;
+    buffer.SetPointLightCount(static_cast<int>(pointLights.size()));
+
+    // Only the lights of the block can be shaded
+    glm::vec3 positions[LightBuffer::s_maxPointLights];
+
+    for (int nLight = 0; nLight < buffer.GetPointLightCount(); ++nLight)
+    {
+        PointLight const* pLight = pointLights[nLight];
+        positions[nLight] = pLight->GetPosition();
+        buffer.SetPointLight(nLight, PointLightStructure
+        {
+            pLight->GetRange(),
+            pLight->GetIntensity(),
+            pLight->GetColor(),
+            pLight->GetPosition(),
+            nLight
+        });
+    }
+
+    s_pInstance->m_lightGrid.Build(positions, buffer.GetPointLightCount());
+
+    if (bClustered)
+    {
+        UpdateClusters(projection, view, width, height);
+    }
+    else
+    {
+        buffer.SetClusters(glm::ivec4(0), glm::vec4(0.0f));
+    }
+
+    // A single upload per frame, the programs read the block
+    glBindBuffer   (GL_UNIFORM_BUFFER, s_pInstance->m_uniformBuffer);
+    glBufferData   (GL_UNIFORM_BUFFER, LightBuffer::s_capacity, nullptr, GL_DYNAMIC_DRAW);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, buffer.GetSize(), buffer.GetData());
+    glBindBuffer   (GL_UNIFORM_BUFFER, 0);
+}
+
+/// \brief Assigns the lights to the view clusters and uploads them
+/* static */ void LightManager::UpdateClusters(glm::mat4 const& projection, glm::mat4 const& view, int width, int height)
+{
+    ASSERT_NOT_NULL(s_pInstance);
+
+    LightBuffer   & buffer   = s_pInstance->m_lightBuffer;
+    LightClusters & clusters = s_pInstance->m_clusters;
+
+    const int count = buffer.GetPointLightCount();
+
+    glm::vec3 positions[LightBuffer::s_maxPointLights];
+    float     ranges   [LightBuffer::s_maxPointLights];
+    for (int nLight = 0; nLight < count; ++nLight)
+    {
+        positions[nLight] = s_pInstance->m_pointLights[nLight]->GetPosition();
+        ranges   [nLight] = s_pInstance->m_pointLights[nLight]->GetRange();
+    }
+
+    clusters.SetProjection(projection);
+    clusters.Assign(view, positions, ranges, count);
+
+    buffer.SetClusters(
+            glm::ivec4(LightClusters::s_clusterX, LightClusters::s_clusterY, LightClusters::s_clusterZ, 1),
+            glm::vec4 (static_cast<float>(width)  / LightClusters::s_clusterX,
+                       static_cast<float>(height) / LightClusters::s_clusterY,
+                       clusters.GetDepthScale(),
+                       clusters.GetDepthBias()));
+
+    std::vector<uint> const& cells   = clusters.GetCells();
+    std::vector<uint> const& indices = clusters.GetLightIndices();
+
+    // Orphaned every frame, the index list is never empty for the texture
+    const uint empty = 0;
+    glBindBuffer(GL_TEXTURE_BUFFER, s_pInstance->m_clusterCellsBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, cells.size() * sizeof(uint), cells.data(), GL_STREAM_DRAW);
+
+    glBindBuffer(GL_TEXTURE_BUFFER, s_pInstance->m_clusterLightsBuffer);
+    glBufferData(GL_TEXTURE_BUFFER,
+                 indices.empty() ? sizeof(uint) : indices.size() * sizeof(uint),
+                 indices.empty() ? &empty       : indices.data(), GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    glActiveTexture(GL_TEXTURE0 + s_clusterCellsUnit);
+    glBindTexture  (GL_TEXTURE_BUFFER, s_pInstance->m_clusterCellsTexture);
+    glTexBuffer    (GL_TEXTURE_BUFFER, GL_RG32UI, s_pInstance->m_clusterCellsBuffer);
+
+    glActiveTexture(GL_TEXTURE0 + s_clusterLightsUnit);
+    glBindTexture  (GL_TEXTURE_BUFFER, s_pInstance->m_clusterLightsTexture);
+    glTexBuffer    (GL_TEXTURE_BUFFER, GL_R32UI, s_pInstance->m_clusterLightsBuffer);
+
+    glActiveTexture(GL_TEXTURE0);
 }
 
 /// \brief Returns all points lights
@@ -167,35 +269,38 @@ namespace cardinal
                 LightManager::s_pInstance->m_pointLights.begin() + index);
     }
 
+    // The indices of the grid are stale until the next frame
+    LightManager::s_pInstance->m_lightGrid.Build(nullptr, 0);
+
     delete pLight;
     pLight = nullptr;
 }
 
-/// \brief Searches the 4 nearest point lights from the given position
-/// \param A vector of point light structures
-/* static */
-std::vector<PointLightStructure> LightManager::GetNearestPointLights(glm::vec3 const& position)
+/// \brief  Searches the nearest point lights from the given position
+///         Only valid after OnRenderBegin, the lights are indexed once per frame
+/// \param  position The position
+/// \param  pLights The lights, by increasing distance
+/// \param  maxCount The size of pLights, at most PointLightGrid::s_maxQueryCount
+/// \return The number of lights written
+/* static */ int LightManager::GetNearestPointLights(glm::vec3 const& position, PointLightStructure * pLights, int maxCount)
 {
     ASSERT_NOT_NULL(s_pInstance);
-    std::vector<PointLightStructure> lights;
 
-    int index = -1;
-    size_t count = LightManager::s_pInstance->m_pointLights.size();
-    for (size_t nLight = 0; nLight < count; ++nLight)
+    int indices[PointLightGrid::s_maxQueryCount];
+    int count = s_pInstance->m_lightGrid.QueryNearest(position, maxCount, indices);
+
+    for (int nLight = 0; nLight < count; ++nLight)
     {
-        if(lights.size() != 4) // TODO Get only nearest and consider a max range
-        {
-            lights.emplace_back(PointLightStructure
-            {
-                s_pInstance->m_pointLights[nLight]->GetRange(),
-                s_pInstance->m_pointLights[nLight]->GetIntensity(),
-                s_pInstance->m_pointLights[nLight]->GetColor(),
-                s_pInstance->m_pointLights[nLight]->GetPosition(),
-            });
-        }
+        PointLight const* pLight = s_pInstance->m_pointLights[indices[nLight]];
+
+        pLights[nLight].range     = pLight->GetRange();
+        pLights[nLight].intensity = pLight->GetIntensity();
+        pLights[nLight].color     = pLight->GetColor();
+        pLights[nLight].position  = pLight->GetPosition();
+        pLights[nLight].index     = indices[nLight];
     }
 
-    return lights;
+    return count;
 }
 
 } // !namespace
\ No newline at end of file
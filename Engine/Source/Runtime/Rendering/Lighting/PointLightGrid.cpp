@@ -0,0 +1,249 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PointLightGrid.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Lighting/PointLightGrid.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ const int PointLightGrid::s_maxResolution;
+/* static */ const int PointLightGrid::s_maxQueryCount;
+
+/// \brief Constructor, empty grid
+PointLightGrid::PointLightGrid()
+: m_origin(0.0f)
+, m_resolution(0)
+, m_cellSize(1.0f)
+{
+    // None
+}
+
+/// \brief Builds the grid, about 2 lights per cell
+/// \param pPositions The positions of the lights
+/// \param count The number of lights
+void PointLightGrid::Build(glm::vec3 const * pPositions, int count)
+{
+    m_positions.assign(pPositions, pPositions + count);
+    m_cellLights.resize(static_cast<size_t>(count));
+
+    if (count == 0)
+    {
+        m_resolution = glm::ivec3(0);
+        m_cellStart.assign(1, 0);
+        return;
+    }
+
+    glm::vec3 min = m_positions[0];
+    glm::vec3 max = m_positions[0];
+    for (glm::vec3 const& position : m_positions)
+    {
+        min = glm::min(min, position);
+        max = glm::max(max, position);
+    }
+
+    // Sizes the cells on the non flat axes only, lights are often on a plane
+    const float     epsilon = 1e-3f;
+    const glm::vec3 extent  = max - min;
+
+    float volume = 1.0f;
+    int   axes   = 0;
+    for (int nAxis = 0; nAxis < 3; ++nAxis)
+    {
+        if (extent[nAxis] > epsilon)
+        {
+            volume *= extent[nAxis];
+            ++axes;
+        }
+    }
+
+    const float maxExtent = std::max(extent.x, std::max(extent.y, extent.z));
+    const float cells     = std::max(1.0f, count * 0.5f);
+
+    m_cellSize = (axes == 0) ? 1.0f : std::pow(volume / cells, 1.0f / axes);
+    m_cellSize = std::max(m_cellSize, std::max(maxExtent / s_maxResolution, epsilon));
+    m_origin   = min;
+
+    for (int nAxis = 0; nAxis < 3; ++nAxis)
+    {
+        m_resolution[nAxis] = std::min(s_maxResolution, static_cast<int>(extent[nAxis] / m_cellSize) + 1);
+    }
+
+    // Counting sort of the lights by cell
+    const int cellCount = m_resolution.x * m_resolution.y * m_resolution.z;
+    m_cellStart.assign(static_cast<size_t>(cellCount) + 1, 0);
+
+    std::vector<int> lightCells(static_cast<size_t>(count));
+    for (int nLight = 0; nLight < count; ++nLight)
+    {
+        glm::ivec3 cell    = GetCell(m_positions[nLight]);
+        lightCells[nLight] = GetCellIndex(cell.x, cell.y, cell.z);
+        m_cellStart[lightCells[nLight] + 1]++;
+    }
+
+    for (int nCell = 0; nCell < cellCount; ++nCell)
+    {
+        m_cellStart[nCell + 1] += m_cellStart[nCell];
+    }
+
+    std::vector<int> cursor(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (int nLight = 0; nLight < count; ++nLight)
+    {
+        m_cellLights[cursor[lightCells[nLight]]++] = nLight;
+    }
+}
+
+/// \brief  Searches the nearest lights from a position
+/// \param  position The position
+/// \param  maxCount The max number of lights to return, at most s_maxQueryCount
+/// \param  pIndices The indices of the lights, by increasing distance
+/// \return The number of lights written
+int PointLightGrid::QueryNearest(glm::vec3 const& position, int maxCount, int * pIndices) const
+{
+    ASSERT_TRUE(maxCount <= s_maxQueryCount);
+
+    if (m_positions.empty() || maxCount <= 0)
+    {
+        return 0;
+    }
+
+    // Sorted by (distance, index), ties are resolved like a brute force search
+    float distances[s_maxQueryCount];
+    int   found = 0;
+
+    const glm::ivec3 cell = GetCell(position);
+
+    int maxRing = 0;
+    for (int nAxis = 0; nAxis < 3; ++nAxis)
+    {
+        maxRing = std::max(maxRing, std::max(cell[nAxis], m_resolution[nAxis] - 1 - cell[nAxis]));
+    }
+
+    for (int ring = 0; ring <= maxRing; ++ring)
+    {
+        const glm::ivec3 lo = glm::max(cell - ring, glm::ivec3(0));
+        const glm::ivec3 hi = glm::min(cell + ring, m_resolution - 1);
+
+        for (int z = lo.z; z <= hi.z; ++z)
+        {
+            for (int y = lo.y; y <= hi.y; ++y)
+            {
+                // Inside the shell, only the two x faces are new
+                const bool bShellRow = std::abs(z - cell.z) == ring || std::abs(y - cell.y) == ring;
+                const int  step      = bShellRow ? 1 : std::max(1, 2 * ring);
+
+                for (int x = cell.x - ring; x <= cell.x + ring; x += step)
+                {
+                    if (x < lo.x || x > hi.x)
+                    {
+                        continue;
+                    }
+
+                    const int cellIndex = GetCellIndex(x, y, z);
+                    for (int nEntry = m_cellStart[cellIndex]; nEntry < m_cellStart[cellIndex + 1]; ++nEntry)
+                    {
+                        const int       light    = m_cellLights[nEntry];
+                        const glm::vec3 delta    = m_positions[light] - position;
+                        const float     distance = glm::dot(delta, delta);
+
+                        if (found == maxCount && (distance > distances[found - 1] ||
+                           (distance == distances[found - 1] && light > pIndices[found - 1])))
+                        {
+                            continue;
+                        }
+
+                        // Insertion in the sorted list
+                        int slot = (found == maxCount) ? found - 1 : found++;
+                        while (slot > 0 && (distances[slot - 1] > distance ||
+                              (distances[slot - 1] == distance && pIndices[slot - 1] > light)))
+                        {
+                            distances[slot] = distances[slot - 1];
+                            pIndices [slot] = pIndices [slot - 1];
+                            --slot;
+                        }
+
+                        distances[slot] = distance;
+                        pIndices [slot] = light;
+                    }
+                }
+            }
+        }
+
+        if (found < maxCount)
+        {
+            continue;
+        }
+
+        // Lower bound of the distance to the lights out of the visited cells
+        bool  bComplete = true;
+        float bound     = FLT_MAX;
+        for (int nAxis = 0; nAxis < 3; ++nAxis)
+        {
+            if (cell[nAxis] - ring > 0)
+            {
+                bComplete = false;
+                bound     = std::min(bound, position[nAxis] - (m_origin[nAxis] + (cell[nAxis] - ring) * m_cellSize));
+            }
+
+            if (cell[nAxis] + ring < m_resolution[nAxis] - 1)
+            {
+                bComplete = false;
+                bound     = std::min(bound, (m_origin[nAxis] + (cell[nAxis] + ring + 1) * m_cellSize) - position[nAxis]);
+            }
+        }
+
+        // Either all cells were visited, or no remaining light can be closer
+        if (bComplete || (bound > 0.0f && bound * bound > distances[found - 1]))
+        {
+            break;
+        }
+    }
+
+    return found;
+}
+
+/// \brief Returns the number of lights in the grid
+int PointLightGrid::GetLightCount() const
+{
+    return static_cast<int>(m_positions.size());
+}
+
+/// \brief Returns the cell of a position, clamped to the grid
+glm::ivec3 PointLightGrid::GetCell(glm::vec3 const& position) const
+{
+    glm::ivec3 cell = glm::ivec3(glm::floor((position - m_origin) / m_cellSize));
+    return glm::clamp(cell, glm::ivec3(0), m_resolution - 1);
+}
+
+/// \brief Returns the index of a cell
+int PointLightGrid::GetCellIndex(int x, int y, int z) const
+{
+    return (z * m_resolution.y + y) * m_resolution.x + x;
+}
+
+} // !namespace
@@ -0,0 +1,181 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ShadowCascades.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <algorithm>
+
+#include "Glm/glm/gtc/matrix_transform.hpp"
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Lighting/ShadowCascades.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ const int ShadowCascades::s_maxCascades;
+
+/// \brief Constructor, 3 cascades of 1024x1024 texels
+ShadowCascades::ShadowCascades()
+: m_cascadeCount  (3)
+, m_resolution    (1024)
+, m_shadowDistance(400.0f)
+, m_splitLambda   (0.75f)
+, m_casterDistance(500.0f)
+{
+    for (int nSplit = 0; nSplit <= s_maxCascades; ++nSplit)
+    {
+        m_splits[nSplit] = 0.0f;
+    }
+
+    for (int nCascade = 0; nCascade < s_maxCascades; ++nCascade)
+    {
+        m_matrices[nCascade] = glm::mat4(1.0f);
+    }
+}
+
+/// \brief Sets the number of cascades and the size of their maps
+void ShadowCascades::Configure(int cascadeCount, int resolution)
+{
+    ASSERT_GT(cascadeCount, 0);
+    ASSERT_GT(resolution,   0);
+
+    m_cascadeCount = std::min(cascadeCount, s_maxCascades);
+    m_resolution   = resolution;
+}
+
+/// \brief Sets the view depth covered by the cascades
+void ShadowCascades::SetShadowDistance(float distance)
+{
+    m_shadowDistance = distance;
+}
+
+/// \brief Sets the blend between uniform (0) and logarithmic (1) splits
+void ShadowCascades::SetSplitLambda(float lambda)
+{
+    m_splitLambda = glm::clamp(lambda, 0.0f, 1.0f);
+}
+
+/// \brief Sets the distance before a slice where the casters are kept
+void ShadowCascades::SetCasterDistance(float distance)
+{
+    m_casterDistance = distance;
+}
+
+/// \brief Fits the cascades to the camera frustum
+void ShadowCascades::Update(glm::mat4 const& projection, glm::mat4 const& view, glm::vec3 const& lightDirection)
+{
+    const float tanX = 1.0f / projection[0][0];
+    const float tanY = 1.0f / projection[1][1];
+    const float near = projection[3][2] / (projection[2][2] - 1.0f);
+    const float far  = projection[3][2] / (projection[2][2] + 1.0f);
+
+    ComputeSplits(near, std::min(far, m_shadowDistance), m_cascadeCount, m_splitLambda, m_splits);
+
+    const glm::mat4 inverseView = glm::inverse(view);
+    const glm::vec3 direction   = glm::normalize(lightDirection);
+    const glm::vec3 up          = std::abs(direction.z) > 0.99f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(0.0f, 0.0f, 1.0f);
+
+    for (int nCascade = 0; nCascade < m_cascadeCount; ++nCascade)
+    {
+        float radius = 0.0f;
+        float depth  = ComputeSliceSphere(tanX, tanY, m_splits[nCascade], m_splits[nCascade + 1], radius);
+
+        const glm::vec3 center = glm::vec3(inverseView * glm::vec4(0.0f, 0.0f, -depth, 1.0f));
+        const glm::vec3 eye    = center - direction * (radius + m_casterDistance);
+
+        glm::mat4 lightView       = glm::lookAt(eye, center, up);
+        glm::mat4 lightProjection = glm::ortho(-radius, radius, -radius, radius, 0.0f, m_casterDistance + 2.0f * radius);
+
+        // Snaps the world origin on a texel, the cascade only moves by whole texels
+        const float     halfResolution = m_resolution * 0.5f;
+        const glm::vec4 origin         = lightProjection * lightView * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        const glm::vec2 texel          = glm::vec2(origin) * halfResolution;
+        const glm::vec2 offset         = (glm::floor(texel + 0.5f) - texel) / halfResolution;
+
+        lightProjection[3][0] += offset.x;
+        lightProjection[3][1] += offset.y;
+
+        m_matrices[nCascade] = lightProjection * lightView;
+    }
+}
+
+/// \brief Computes the split depths of the cascades
+/* static */ void ShadowCascades::ComputeSplits(float near, float far, int count, float lambda, float * pSplits)
+{
+    ASSERT_GT(count, 0);
+    ASSERT_NOT_NULL(pSplits);
+
+    for (int nSplit = 0; nSplit <= count; ++nSplit)
+    {
+        const float ratio       = static_cast<float>(nSplit) / count;
+        const float logarithmic = near * std::pow(far / near, ratio);
+        const float uniform     = near + (far - near) * ratio;
+
+        pSplits[nSplit] = lambda * logarithmic + (1.0f - lambda) * uniform;
+    }
+
+    // Exact bounds, the blend may drift by a few ulps
+    pSplits[0]     = near;
+    pSplits[count] = far;
+}
+
+/// \brief Computes the minimal bounding sphere of a slice of a symmetric frustum
+/* static */ float ShadowCascades::ComputeSliceSphere(float tanX, float tanY, float near, float far, float & radius)
+{
+    // The corners at depth z are at k * z from the axis, the center
+    // is on the axis at the depth where near and far corners are equidistant
+    const float k2    = tanX * tanX + tanY * tanY;
+    const float depth = std::min(0.5f * (near + far) * (1.0f + k2), far);
+
+    radius = std::sqrt((far - depth) * (far - depth) + k2 * far * far);
+    return depth;
+}
+
+/// \brief Returns the number of cascades
+int ShadowCascades::GetCascadeCount() const
+{
+    return m_cascadeCount;
+}
+
+/// \brief Returns the size of the cascades maps in texels
+int ShadowCascades::GetResolution() const
+{
+    return m_resolution;
+}
+
+/// \brief Returns the light projection view matrix of a cascade
+glm::mat4 const& ShadowCascades::GetMatrix(int cascade) const
+{
+    ASSERT_LT(cascade, m_cascadeCount);
+    return m_matrices[cascade];
+}
+
+/// \brief Returns a split depth
+float ShadowCascades::GetSplit(int index) const
+{
+    ASSERT_LT(index, m_cascadeCount + 1);
+    return m_splits[index];
+}
+
+} // !namespace
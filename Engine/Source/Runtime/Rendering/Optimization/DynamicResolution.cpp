@@ -0,0 +1,151 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       DynamicResolution.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <algorithm>
+
+#include "Runtime/Rendering/Optimization/DynamicResolution.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ const int DynamicResolution::s_cooldownFrames;
+/* static */ const int DynamicResolution::s_warmupFrames;
+
+/* static */ constexpr float DynamicResolution::s_scaleStep;
+/* static */ constexpr float DynamicResolution::s_upperThreshold;
+/* static */ constexpr float DynamicResolution::s_lowerThreshold;
+/* static */ constexpr float DynamicResolution::s_smoothing;
+
+/// \brief Constructor, targets 60 fps between half and full resolution
+DynamicResolution::DynamicResolution()
+: m_targetFrameTime(1000.0f / 60.0f)
+, m_minScale(0.5f)
+, m_maxScale(1.0f)
+, m_scale(1.0f)
+, m_averageFrameTime(0.0f)
+, m_sampleCount(0)
+, m_cooldown(0)
+{
+    // None
+}
+
+/// \brief Sets the frame time to hold and the range of the scale
+void DynamicResolution::Configure(float targetFrameTime, float minScale, float maxScale)
+{
+    m_targetFrameTime = std::max(targetFrameTime, 0.1f);
+    m_minScale        = std::max(std::min(minScale, maxScale), s_scaleStep);
+    m_maxScale        = std::max(minScale, maxScale);
+    m_scale           = ClampScale(m_scale);
+}
+
+/// \brief Goes back to the highest scale and forgets the samples
+void DynamicResolution::Reset()
+{
+    m_scale            = ClampScale(m_maxScale);
+    m_averageFrameTime = 0.0f;
+    m_sampleCount      = 0;
+    m_cooldown         = 0;
+}
+
+/// \brief Feeds a measured GPU frame time
+bool DynamicResolution::Update(float frameTime)
+{
+    if(m_cooldown > 0)
+    {
+        m_cooldown--;
+        return false;
+    }
+
+    if(m_sampleCount == 0)
+    {
+        m_averageFrameTime = frameTime;
+    }
+    else
+    {
+        m_averageFrameTime += (frameTime - m_averageFrameTime) * s_smoothing;
+    }
+
+    // A single slow frame must not change the scale
+    if(++m_sampleCount < s_warmupFrames)
+    {
+        return false;
+    }
+
+    float scale = m_scale;
+    if(m_averageFrameTime > m_targetFrameTime * s_upperThreshold)
+    {
+        // The cost follows the pixel count, the square of the scale
+        scale = std::min(m_scale * std::sqrt(m_targetFrameTime / m_averageFrameTime), m_scale - s_scaleStep);
+    }
+    else if(m_averageFrameTime < m_targetFrameTime * s_lowerThreshold)
+    {
+        scale = m_scale + s_scaleStep;
+    }
+
+    scale = ClampScale(scale);
+    if(scale == m_scale)
+    {
+        return false;
+    }
+
+    // The average measured the old resolution
+    m_scale       = scale;
+    m_sampleCount = 0;
+    m_cooldown    = s_cooldownFrames;
+    return true;
+}
+
+/// \brief Returns the current scale of each axis
+float DynamicResolution::GetScale() const
+{
+    return m_scale;
+}
+
+/// \brief Returns the averaged GPU frame time in milliseconds
+float DynamicResolution::GetAverageFrameTime() const
+{
+    return m_averageFrameTime;
+}
+
+/// \brief Returns the GPU time budget of a frame in milliseconds
+float DynamicResolution::GetTargetFrameTime() const
+{
+    return m_targetFrameTime;
+}
+
+/// \brief Returns the render size of an axis
+/* static */ int DynamicResolution::ComputeRenderSize(int size, float scale)
+{
+    return std::max(static_cast<int>(std::lround(static_cast<float>(size) * scale)), 1);
+}
+
+/// \brief Clamps a scale in the range and snaps it to the steps
+float DynamicResolution::ClampScale(float scale) const
+{
+    float snapped = std::round(scale / s_scaleStep) * s_scaleStep;
+    return std::min(std::max(snapped, m_minScale), m_maxScale);
+}
+
+} // !namespace
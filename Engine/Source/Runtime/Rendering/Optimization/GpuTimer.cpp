@@ -0,0 +1,115 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       GpuTimer.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Glew/include/GL/glew.h"
+#include "Runtime/Rendering/Optimization/GpuTimer.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+GpuTimer::GpuTimer()
+: m_current(0)
+, m_bMeasuring(false)
+{
+    for(int nQuery = 0; nQuery < s_queryCount; ++nQuery)
+    {
+        m_queries [nQuery] = 0;
+        m_bPending[nQuery] = false;
+    }
+}
+
+/// \brief Creates the queries
+void GpuTimer::Initialize()
+{
+    glGenQueries(s_queryCount, m_queries);
+}
+
+/// \brief Deletes the queries
+void GpuTimer::Release()
+{
+    glDeleteQueries(s_queryCount, m_queries);
+
+    for(int nQuery = 0; nQuery < s_queryCount; ++nQuery)
+    {
+        m_queries [nQuery] = 0;
+        m_bPending[nQuery] = false;
+    }
+}
+
+/// \brief Starts measuring a frame
+void GpuTimer::Begin()
+{
+    m_bMeasuring = !m_bPending[m_current] && m_queries[m_current] != 0;
+    if(m_bMeasuring)
+    {
+        glBeginQuery(GL_TIME_ELAPSED, m_queries[m_current]);
+    }
+}
+
+/// \brief Stops measuring the frame
+void GpuTimer::End()
+{
+    if(m_bMeasuring)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        m_bPending[m_current] = true;
+        m_current             = (m_current + 1) % s_queryCount;
+        m_bMeasuring          = false;
+    }
+}
+
+/// \brief Collects the finished measures
+bool GpuTimer::Read(float & frameTime)
+{
+    bool bRead = false;
+
+    // From the oldest query to the newest
+    for(int nQuery = 0; nQuery < s_queryCount; ++nQuery)
+    {
+        int index = (m_current + nQuery) % s_queryCount;
+        if(!m_bPending[index])
+        {
+            continue;
+        }
+
+        GLint available = 0;
+        glGetQueryObjectiv(m_queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+        if(available == 0)
+        {
+            break;
+        }
+
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(m_queries[index], GL_QUERY_RESULT, &elapsed);
+
+        frameTime         = static_cast<float>(elapsed) / 1000000.0f;
+        m_bPending[index] = false;
+        bRead             = true;
+    }
+
+    return bRead;
+}
+
+} // !namespace
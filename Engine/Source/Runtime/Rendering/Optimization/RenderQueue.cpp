@@ -0,0 +1,88 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RenderQueue.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstring>
+#include <algorithm>
+
+#include "Runtime/Rendering/Optimization/RenderQueue.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Builds the sort key of a draw
+/* static */ uint64 RenderQueue::MakeKey(uint program, uint texture, uint vao, float depth)
+{
+    const uint64 programMask = (1ull << s_programBits) - 1;
+    const uint64 textureMask = (1ull << s_textureBits) - 1;
+    const uint64 vaoMask     = (1ull << s_vaoBits)     - 1;
+
+    return ((program & programMask) << (s_textureBits + s_vaoBits + s_depthBits))
+         | ((texture & textureMask) << (s_vaoBits + s_depthBits))
+         | ((vao     & vaoMask)     <<  s_depthBits)
+         | GetDepthBits(depth);
+}
+
+/// \brief Returns the depth bits of a view depth, monotonic
+/* static */ uint64 RenderQueue::GetDepthBits(float depth)
+{
+    // Positive floats are ordered as their bits, the sign bit is always 0
+    if (!(depth > 0.0f))
+    {
+        return 0;
+    }
+
+    uint32 bits = 0;
+    memcpy(&bits, &depth, sizeof(bits));
+
+    return bits >> (31 - s_depthBits);
+}
+
+/// \brief Removes all draws, keeps the capacity
+void RenderQueue::Clear()
+{
+    m_items.clear();
+}
+
+/// \brief Adds a draw to the queue
+void RenderQueue::Submit(uint64 key, class IRenderer * pRenderer)
+{
+    m_items.push_back(Item{key, pRenderer});
+}
+
+/// \brief Sorts the draws by key
+void RenderQueue::Sort()
+{
+    std::stable_sort(m_items.begin(), m_items.end(), [](Item const& a, Item const& b)
+    {
+        return a.key < b.key;
+    });
+}
+
+/// \brief Returns the draws
+std::vector<RenderQueue::Item> const& RenderQueue::GetItems() const
+{
+    return m_items;
+}
+
+} // !namespace
@@ -0,0 +1,115 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       StateCache.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Glew/include/GL/glew.h"
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ uint   StateCache::s_program      = StateCache::s_unknown;
+/* static */ uint   StateCache::s_vao          = StateCache::s_unknown;
+/* static */ uint   StateCache::s_activeUnit   = StateCache::s_unknown;
+/* static */ uint   StateCache::s_textures[StateCache::s_textureUnits] =
+{
+    StateCache::s_unknown, StateCache::s_unknown, StateCache::s_unknown, StateCache::s_unknown,
+    StateCache::s_unknown, StateCache::s_unknown, StateCache::s_unknown, StateCache::s_unknown
+};
+/* static */ uint64 StateCache::s_avoidedBinds = 0;
+
+/// \brief Forgets the bound states, the next binds are all issued
+/* static */ void StateCache::Invalidate()
+{
+    s_program    = s_unknown;
+    s_vao        = s_unknown;
+    s_activeUnit = s_unknown;
+
+    for (uint nUnit = 0; nUnit < s_textureUnits; ++nUnit)
+    {
+        s_textures[nUnit] = s_unknown;
+    }
+}
+
+/// \brief Binds a program
+/* static */ void StateCache::UseProgram(uint program)
+{
+    if (program == s_program)
+    {
+        ++s_avoidedBinds;
+        return;
+    }
+
+    glUseProgram(program);
+    s_program = program;
+}
+
+/// \brief Binds a 2D texture to a texture unit
+/* static */ void StateCache::BindTexture(uint unit, uint texture)
+{
+    ASSERT_LT(unit, s_textureUnits);
+
+    if (texture == s_textures[unit])
+    {
+        ++s_avoidedBinds;
+        return;
+    }
+
+    if (unit != s_activeUnit)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        s_activeUnit = unit;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    s_textures[unit] = texture;
+}
+
+/// \brief Binds a vertex array
+/* static */ void StateCache::BindVertexArray(uint vao)
+{
+    if (vao == s_vao)
+    {
+        ++s_avoidedBinds;
+        return;
+    }
+
+    glBindVertexArray(vao);
+    s_vao = vao;
+}
+
+/// \brief Returns the number of binds skipped since the last reset
+/* static */ uint64 StateCache::GetAvoidedBindCount()
+{
+    return s_avoidedBinds;
+}
+
+/// \brief Resets the number of skipped binds
+/* static */ void StateCache::ResetAvoidedBindCount()
+{
+    s_avoidedBinds = 0;
+}
+
+} // !namespace
@@ -21,19 +21,26 @@
 /// \package    Rendering/Optimization
 /// \author     Vincent STEHLY--CALISTO
 
+#include <limits>
+
+#include "Runtime/Core/Debug/Logger.hpp"
 #include "Runtime/Rendering/Optimization/VBOIndexer.hpp"
 
 /// \namespace cardinal
 namespace cardinal
 {
 
+/* static */ const uint32_t VBOIndexer::s_emptySlot;
+/* static */ thread_local std::vector<uint32_t> VBOIndexer::s_table;
+
 /// \brief Indexes vertices who shares same properties
 /// \param inVertices  The input vertices vector
 /// \param inColors    The input colors vector
 /// \param outIndexes  The output indexes vector
 /// \param outVertices The output vertices vector
 /// \param outColors   The output colors vector
-/* static */ void VBOIndexer::Index(
+/// \return False if the mesh needs 32 bits indexes
+/* static */ bool VBOIndexer::Index(
         const std::vector<glm::vec3> &inVertices,
         const std::vector<glm::vec2> &inUVs,
 
@@ -41,70 +48,183 @@ namespace cardinal
         std::vector<glm::vec3> &outVertices,
         std::vector<glm::vec2> &outUVs)
 {
-    std::map<sPackedVertex, unsigned short> output;
+    return IndexImpl(inVertices, inUVs, outIndexes, outVertices, outUVs);
+}
+
+/* static */ bool VBOIndexer::Index(
+        const std::vector<glm::vec3> &inVertices,
+        const std::vector<glm::vec3> &inNormals,
+        const std::vector<glm::vec2> &inUVs,
+
+        std::vector<unsigned short> &outIndexes,
+        std::vector<glm::vec3> &outVertices,
+        std::vector<glm::vec3> &outNormals,
+        std::vector<glm::vec2> &outUVs)
+{
+    return IndexImpl(inVertices, inNormals, inUVs, outIndexes, outVertices, outNormals, outUVs);
+}
+
+/* static */ void VBOIndexer::Index(
+        const std::vector<glm::vec3> &inVertices,
+        const std::vector<glm::vec2> &inUVs,
+
+        std::vector<unsigned int> &outIndexes,
+        std::vector<glm::vec3> &outVertices,
+        std::vector<glm::vec2> &outUVs)
+{
+    IndexImpl(inVertices, inUVs, outIndexes, outVertices, outUVs);
+}
+
+/* static */ void VBOIndexer::Index(
+        const std::vector<glm::vec3> &inVertices,
+        const std::vector<glm::vec3> &inNormals,
+        const std::vector<glm::vec2> &inUVs,
+
+        std::vector<unsigned int> &outIndexes,
+        std::vector<glm::vec3> &outVertices,
+        std::vector<glm::vec3> &outNormals,
+        std::vector<glm::vec2> &outUVs)
+{
+    IndexImpl(inVertices, inNormals, inUVs, outIndexes, outVertices, outNormals, outUVs);
+}
+
+/// \brief Indexes vertices with positions and uvs
+template <typename TIndex>
+/* static */ bool VBOIndexer::IndexImpl(
+        const std::vector<glm::vec3> &inVertices,
+        const std::vector<glm::vec2> &inUVs,
+
+        std::vector<TIndex> &outIndexes,
+        std::vector<glm::vec3> &outVertices,
+        std::vector<glm::vec2> &outUVs)
+{
+    size_t   inVerticesSize = inVertices.size();
+    uint32_t mask           = ResetTable(inVerticesSize);
+
+    size_t indexCount  = outIndexes.size();
+    size_t vertexCount = outVertices.size();
+
+    outIndexes.reserve(indexCount + inVerticesSize);
 
     // For each input vertex
-    size_t inVerticesSize = inVertices.size();
     for (size_t nVertex = 0; nVertex < inVerticesSize; ++nVertex)
     {
-        unsigned short index;
         sPackedVertex pack = {inVertices[nVertex], inUVs[nVertex]};
 
-        bool bIsFound = GetSimilarVertexIndex(pack, output, index);
+        // Linear probing until a similar vertex or an empty slot is found
+        uint32_t slot = Hash(pack) & mask;
+        while (s_table[slot] != s_emptySlot)
+        {
+            uint32_t index = s_table[slot];
+            if (memcmp(&outVertices[index], &pack.position, sizeof(glm::vec3)) == 0 &&
+                memcmp(&outUVs     [index], &pack.uv,       sizeof(glm::vec2)) == 0)
+            {
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
 
-        if (bIsFound)
+        if (s_table[slot] != s_emptySlot)
         {
-            outIndexes.push_back(index);
+            outIndexes.push_back(static_cast<TIndex>(s_table[slot]));
         }
         else
         {
+            // The index must fit before being narrowed
+            size_t newIndex = outVertices.size();
+            if (newIndex > std::numeric_limits<TIndex>::max())
+            {
+                Logger::LogError("Cannot index more than %u vertices with %u bytes indexes",
+                                 (uint32_t)std::numeric_limits<TIndex>::max() + 1, (uint32_t)sizeof(TIndex));
+
+                outIndexes.resize (indexCount);
+                outVertices.resize(vertexCount);
+                outUVs.resize     (vertexCount);
+                return false;
+            }
+
             outVertices.push_back(inVertices[nVertex]);
             outUVs.push_back  (inUVs[nVertex]);
 
-            size_t newIndex = outVertices.size() - 1;
-            outIndexes.push_back(static_cast<unsigned short>(newIndex));
-            output[pack] = static_cast<unsigned short>(newIndex);
+            outIndexes.push_back(static_cast<TIndex>(newIndex));
+            s_table[slot] = static_cast<uint32_t>(newIndex);
         }
-
     }
+
+    return true;
 }
 
-/* static */ void VBOIndexer::Index(
+/// \brief Indexes vertices with positions, normals and uvs
+template <typename TIndex>
+/* static */ bool VBOIndexer::IndexImpl(
         const std::vector<glm::vec3> &inVertices,
         const std::vector<glm::vec3> &inNormals,
         const std::vector<glm::vec2> &inUVs,
 
-        std::vector<unsigned short> &outIndexes,
+        std::vector<TIndex> &outIndexes,
         std::vector<glm::vec3> &outVertices,
         std::vector<glm::vec3> &outNormals,
         std::vector<glm::vec2> &outUVs)
 {
-    std::map<sPackedVertexBeta, unsigned short> output;
+    size_t   inVerticesSize = inVertices.size();
+    uint32_t mask           = ResetTable(inVerticesSize);
+
+    size_t indexCount  = outIndexes.size();
+    size_t vertexCount = outVertices.size();
+
+    outIndexes.reserve(indexCount + inVerticesSize);
 
     // For each input vertex
-    size_t inVerticesSize = inVertices.size();
     for (size_t nVertex = 0; nVertex < inVerticesSize; ++nVertex)
     {
-        unsigned short index;
         sPackedVertexBeta pack = {inVertices[nVertex], inNormals[nVertex], inUVs[nVertex]};
 
-        bool bIsFound = GetSimilarVertexIndex(pack, output, index);
+        // Linear probing until a similar vertex or an empty slot is found
+        uint32_t slot = Hash(pack) & mask;
+        while (s_table[slot] != s_emptySlot)
+        {
+            uint32_t index = s_table[slot];
+            if (memcmp(&outVertices[index], &pack.position, sizeof(glm::vec3)) == 0 &&
+                memcmp(&outNormals [index], &pack.normals,  sizeof(glm::vec3)) == 0 &&
+                memcmp(&outUVs     [index], &pack.uv,       sizeof(glm::vec2)) == 0)
+            {
+                break;
+            }
+
+            slot = (slot + 1) & mask;
+        }
 
-        if (bIsFound)
+        if (s_table[slot] != s_emptySlot)
         {
-            outIndexes.push_back(index);
+            outIndexes.push_back(static_cast<TIndex>(s_table[slot]));
         }
         else
         {
+            // The index must fit before being narrowed
+            size_t newIndex = outVertices.size();
+            if (newIndex > std::numeric_limits<TIndex>::max())
+            {
+                Logger::LogError("Cannot index more than %u vertices with %u bytes indexes",
+                                 (uint32_t)std::numeric_limits<TIndex>::max() + 1, (uint32_t)sizeof(TIndex));
+
+                outIndexes.resize (indexCount);
+                outVertices.resize(vertexCount);
+                outNormals.resize (vertexCount);
+                outUVs.resize     (vertexCount);
+                return false;
+            }
+
             outVertices.push_back(inVertices[nVertex]);
             outNormals.push_back(inNormals[nVertex]);
             outUVs.push_back  (inUVs[nVertex]);
 
-            size_t newIndex = outVertices.size() - 1;
-            outIndexes.push_back(static_cast<unsigned short>(newIndex));
-            output[pack] = static_cast<unsigned short>(newIndex);
+            outIndexes.push_back(static_cast<TIndex>(newIndex));
+            s_table[slot] = static_cast<uint32_t>(newIndex);
         }
     }
+
+    return true;
 }
 
 } // !namespace
\ No newline at end of file
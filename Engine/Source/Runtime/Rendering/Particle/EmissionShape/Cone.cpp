@@ -54,10 +54,21 @@ void Cone::DrawGizmo(glm::vec3 const& systemPosition)
 
 /// \brief Returns a random position in the base of the emission shape
 /// \param systemPosition The position of the particle system
+/// \param generator The random generator of the particle system
 /// \return The position
-glm::vec3 Cone::GetStartPosition(glm::vec3 const& systemPosition) const
+glm::vec3 Cone::GetStartPosition(glm::vec3 const& systemPosition, std::mt19937 & generator) const
 {
-    glm::vec2 position2D = glm::diskRand(m_radius);
+    // Rejection sampling, as glm::diskRand but without the global rand state
+    std::uniform_real_distribution<float> distribution(-m_radius, m_radius);
+
+    glm::vec2 position2D;
+    do
+    {
+        position2D.x = distribution(generator);
+        position2D.y = distribution(generator);
+    }
+    while (glm::dot(position2D, position2D) > m_radius * m_radius);
+
     return glm::vec3(systemPosition.x + position2D.x,
                      systemPosition.y + position2D.y, systemPosition.z);
 }
@@ -61,10 +61,16 @@ void Plane::DrawGizmo(glm::vec3 const& systemPosition)
 
 /// \brief Returns a random position in the base of the emission shape
 /// \param systemPosition The position of the particle system
+/// \param generator The random generator of the particle system
 /// \return The position
-glm::vec3 Plane::GetStartPosition(glm::vec3 const& systemPosition) const
+glm::vec3 Plane::GetStartPosition(glm::vec3 const& systemPosition, std::mt19937 & generator) const
 {
-    glm::vec2 position2D = glm::linearRand(glm::vec2(0.0f, 0.0f), glm::vec2(m_lenght, m_width));
+    std::uniform_real_distribution<float> lenght(0.0f, m_lenght);
+    std::uniform_real_distribution<float> width (0.0f, m_width);
+
+    glm::vec2 position2D;
+    position2D.x = lenght(generator);
+    position2D.y = width (generator);
     return glm::vec3(systemPosition.x + position2D.x,
                      systemPosition.y + position2D.y, systemPosition.z);
 }
@@ -0,0 +1,158 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleBuffer.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstdint>
+#include <algorithm>
+
+#include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Particle/ParticleBuffer.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Constructor
+ParticleBuffer::ParticleBuffer()
+: positionX(nullptr)
+, positionY(nullptr)
+, positionZ(nullptr)
+, velocityX(nullptr)
+, velocityY(nullptr)
+, velocityZ(nullptr)
+, colorR   (nullptr)
+, colorG   (nullptr)
+, colorB   (nullptr)
+, size     (nullptr)
+, lifeTime (nullptr)
+, m_capacity(0)
+, m_pBlock  (nullptr)
+{
+    // None
+}
+
+/// \brief Destructor
+ParticleBuffer::~ParticleBuffer()
+{
+    Release();
+}
+
+/// \brief Allocates the arrays for the given amount of particles
+///        All particles are dead after the allocation
+/// \param capacity The max amount of particles
+void ParticleBuffer::Allocate(int capacity)
+{
+    ASSERT_GT(capacity, 0);
+
+    Release();
+
+    // Rounds the arrays to 4 floats to keep each of them aligned
+    size_t stride = (static_cast<size_t>(capacity) + 3) & ~static_cast<size_t>(3);
+
+    m_capacity = capacity;
+    m_pBlock   = new uchar[stride * s_attributeCount * sizeof(float) + 15];
+
+    uintptr_t address = (reinterpret_cast<uintptr_t>(m_pBlock) + 15) & ~static_cast<uintptr_t>(15);
+    float *   pArray  = reinterpret_cast<float *>(address);
+
+    float ** arrays[s_attributeCount] =
+    {
+        &positionX, &positionY, &positionZ,
+        &velocityX, &velocityY, &velocityZ,
+        &colorR,    &colorG,    &colorB,
+        &size,      &lifeTime
+    };
+
+    for(float ** ppArray : arrays)
+    {
+        *ppArray = pArray;
+        pArray  += stride;
+    }
+
+    // The arrays are contiguous, a null life time means a dead particle
+    std::fill(positionX, positionX + stride * s_attributeCount, 0.0f);
+}
+
+/// \brief Releases the arrays
+void ParticleBuffer::Release()
+{
+    delete[] m_pBlock;
+
+    m_pBlock   = nullptr;
+    m_capacity = 0;
+    positionX  = positionY = positionZ = nullptr;
+    velocityX  = velocityY = velocityZ = nullptr;
+    colorR     = colorG    = colorB    = nullptr;
+    size       = lifeTime  = nullptr;
+}
+
+/// \brief Returns the max amount of particles
+int ParticleBuffer::GetCapacity() const
+{
+    return m_capacity;
+}
+
+/// \brief  Removes the dead particles of the range [0, count)
+///         Each dead particle is replaced by the last particle
+///         of the range (swap and pop), the order is not kept
+/// \param  count The number of particles in the range
+/// \return The number of living particles, packed at the front
+int ParticleBuffer::Compact(int count)
+{
+    ASSERT_TRUE(count <= m_capacity);
+
+    int nParticle = 0;
+    while(nParticle < count)
+    {
+        if(lifeTime[nParticle] > 0.0f)
+        {
+            ++nParticle;
+            continue;
+        }
+
+        // The moved particle is tested on the next iteration
+        --count;
+        Move(count, nParticle);
+    }
+
+    return count;
+}
+
+/// \brief Copies all attributes of a particle over another one
+/// \param from The index of the particle to copy
+/// \param to The index of the particle to overwrite
+void ParticleBuffer::Move(int from, int to)
+{
+    positionX[to] = positionX[from];
+    positionY[to] = positionY[from];
+    positionZ[to] = positionZ[from];
+    velocityX[to] = velocityX[from];
+    velocityY[to] = velocityY[from];
+    velocityZ[to] = velocityZ[from];
+    colorR   [to] = colorR   [from];
+    colorG   [to] = colorG   [from];
+    colorB   [to] = colorB   [from];
+    size     [to] = size     [from];
+    lifeTime [to] = lifeTime [from];
+}
+
+} // !namespace
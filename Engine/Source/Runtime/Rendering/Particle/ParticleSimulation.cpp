@@ -0,0 +1,288 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleSimulation.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstring>
+
+#include "Runtime/Platform/Configuration/Configuration.hh"
+#include "Runtime/Rendering/Particle/ParticleSimulation.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define CARDINAL_PARTICLE_SSE2
+#   include <emmintrin.h>
+#endif
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief  Tells if the SIMD kernel is compiled in
+/* static */ bool ParticleSimulation::IsSIMDSupported()
+{
+#if defined(CARDINAL_PARTICLE_SSE2)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// \brief  Simulates a range of particles one by one
+///         Reference implementation of Simulate
+/// \param  particles The particles to simulate
+/// \param  begin The first particle of the range
+/// \param  end The end of the range
+/// \param  gravity The gravity vector
+/// \param  dt The elapsed time
+/// \param  pPositionOut The billboard position buffer to fill
+/// \param  pColorOut The billboard color buffer to fill
+/// \return The number of living particles written
+/* static */ int ParticleSimulation::SimulateScalar(
+        ParticleBuffer & particles, int begin, int end,
+        glm::vec3 const& gravity, float dt,
+        float * pPositionOut, float * pColorOut)
+{
+    int written = 0;
+    for(int nParticle = begin; nParticle < end; ++nParticle)
+    {
+        if(particles.lifeTime[nParticle] <= 0.0f)
+        {
+            continue;
+        }
+
+        // Decrease life
+        particles.lifeTime[nParticle] -= dt;
+        if(particles.lifeTime[nParticle] <= 0.0f)
+        {
+            continue;
+        }
+
+        // Simple physics : gravity only, no collisions
+        particles.velocityX[nParticle] += gravity.x * dt;
+        particles.velocityY[nParticle] += gravity.y * dt;
+        particles.velocityZ[nParticle] += gravity.z * dt;
+        particles.positionX[nParticle] += particles.velocityX[nParticle] * dt;
+        particles.positionY[nParticle] += particles.velocityY[nParticle] * dt;
+        particles.positionZ[nParticle] += particles.velocityZ[nParticle] * dt;
+
+        // Fill the GPU buffers
+        pPositionOut[written * 4 + 0] = particles.positionX[nParticle];
+        pPositionOut[written * 4 + 1] = particles.positionY[nParticle];
+        pPositionOut[written * 4 + 2] = particles.positionZ[nParticle];
+        pPositionOut[written * 4 + 3] = particles.size     [nParticle];
+
+        pColorOut[written * 3 + 0] = particles.colorR[nParticle];
+        pColorOut[written * 3 + 1] = particles.colorG[nParticle];
+        pColorOut[written * 3 + 2] = particles.colorB[nParticle];
+
+        written++;
+    }
+
+    return written;
+}
+
+/// \brief  Simulates a range of particles, four at a time when possible
+/// \param  particles The particles to simulate
+/// \param  begin The first particle of the range
+/// \param  end The end of the range
+/// \param  gravity The gravity vector
+/// \param  dt The elapsed time
+/// \param  pPositionOut The billboard position buffer to fill
+/// \param  pColorOut The billboard color buffer to fill
+/// \return The number of living particles written
+/* static */ int ParticleSimulation::Simulate(
+        ParticleBuffer & particles, int begin, int end,
+        glm::vec3 const& gravity, float dt,
+        float * pPositionOut, float * pColorOut)
+{
+#if defined(CARDINAL_PARTICLE_SSE2)
+    // Scalar head until the range is aligned on 4 particles
+    int alignedBegin = (begin + 3) & ~3;
+    if(alignedBegin > end)
+    {
+        alignedBegin = end;
+    }
+
+    int written = SimulateScalar(particles, begin, alignedBegin, gravity, dt, pPositionOut, pColorOut);
+    int simdEnd = alignedBegin + ((end - alignedBegin) & ~3);
+
+    float * pPositionX = particles.positionX;
+    float * pPositionY = particles.positionY;
+    float * pPositionZ = particles.positionZ;
+    float * pVelocityX = particles.velocityX;
+    float * pVelocityY = particles.velocityY;
+    float * pVelocityZ = particles.velocityZ;
+    float * pLifeTime  = particles.lifeTime;
+
+    const __m128 zero     = _mm_setzero_ps();
+    const __m128 delta    = _mm_set1_ps(dt);
+    const __m128 gravityX = _mm_set1_ps(gravity.x * dt);
+    const __m128 gravityY = _mm_set1_ps(gravity.y * dt);
+    const __m128 gravityZ = _mm_set1_ps(gravity.z * dt);
+
+    for(int nParticle = alignedBegin; nParticle < simdEnd; nParticle += 4)
+    {
+        // Decrease the life of the particles alive at the beginning of the step
+        __m128 lifeTime = _mm_load_ps(pLifeTime + nParticle);
+        __m128 wasAlive = _mm_cmpgt_ps(lifeTime, zero);
+
+        if(_mm_movemask_ps(wasAlive) == 0)
+        {
+            continue;
+        }
+
+        lifeTime = _mm_sub_ps(lifeTime, _mm_and_ps(wasAlive, delta));
+        _mm_store_ps(pLifeTime + nParticle, lifeTime);
+
+        __m128 alive = _mm_cmpgt_ps(lifeTime, zero);
+        int    mask  = _mm_movemask_ps(alive);
+
+        if(mask == 0)
+        {
+            continue;
+        }
+
+        // Simple physics : gravity only, no collisions
+        // Dead lanes are left untouched
+        __m128 velocityX = _mm_load_ps(pVelocityX + nParticle);
+        __m128 velocityY = _mm_load_ps(pVelocityY + nParticle);
+        __m128 velocityZ = _mm_load_ps(pVelocityZ + nParticle);
+
+        velocityX = _mm_add_ps(velocityX, _mm_and_ps(alive, gravityX));
+        velocityY = _mm_add_ps(velocityY, _mm_and_ps(alive, gravityY));
+        velocityZ = _mm_add_ps(velocityZ, _mm_and_ps(alive, gravityZ));
+
+        __m128 positionX = _mm_add_ps(_mm_load_ps(pPositionX + nParticle), _mm_and_ps(alive, _mm_mul_ps(velocityX, delta)));
+        __m128 positionY = _mm_add_ps(_mm_load_ps(pPositionY + nParticle), _mm_and_ps(alive, _mm_mul_ps(velocityY, delta)));
+        __m128 positionZ = _mm_add_ps(_mm_load_ps(pPositionZ + nParticle), _mm_and_ps(alive, _mm_mul_ps(velocityZ, delta)));
+
+        _mm_store_ps(pVelocityX + nParticle, velocityX);
+        _mm_store_ps(pVelocityY + nParticle, velocityY);
+        _mm_store_ps(pVelocityZ + nParticle, velocityZ);
+        _mm_store_ps(pPositionX + nParticle, positionX);
+        _mm_store_ps(pPositionY + nParticle, positionY);
+        _mm_store_ps(pPositionZ + nParticle, positionZ);
+
+        __m128 size   = _mm_load_ps(particles.size   + nParticle);
+        __m128 colorR = _mm_load_ps(particles.colorR + nParticle);
+        __m128 colorG = _mm_load_ps(particles.colorG + nParticle);
+        __m128 colorB = _mm_load_ps(particles.colorB + nParticle);
+
+        // Transposes to the interleaved billboard layout
+        // xyzs xyzs xyzs xyzs | rgbr gbrg brgb
+        _MM_TRANSPOSE4_PS(positionX, positionY, positionZ, size);
+
+        __m128 rg0 = _mm_unpacklo_ps(colorR, colorG); // r0 g0 r1 g1
+        __m128 rg1 = _mm_unpackhi_ps(colorR, colorG); // r2 g2 r3 g3
+        __m128 br0 = _mm_unpacklo_ps(colorB, colorR); // b0 r0 b1 r1
+        __m128 br1 = _mm_unpackhi_ps(colorB, colorR); // b2 r2 b3 r3
+        __m128 gb0 = _mm_unpacklo_ps(colorG, colorB); // g0 b0 g1 b1
+        __m128 gb1 = _mm_unpackhi_ps(colorG, colorB); // g2 b2 g3 b3
+
+        __m128 color0 = _mm_shuffle_ps(rg0, br0, _MM_SHUFFLE(3, 0, 1, 0)); // r0 g0 b0 r1
+        __m128 color1 = _mm_shuffle_ps(gb0, rg1, _MM_SHUFFLE(1, 0, 3, 2)); // g1 b1 r2 g2
+        __m128 color2 = _mm_shuffle_ps(br1, gb1, _MM_SHUFFLE(3, 2, 3, 0)); // b2 r3 g3 b3
+
+        if(mask == 0xF)
+        {
+            // Hot path, the four particles are alive
+            _mm_storeu_ps(pPositionOut + written * 4 +  0, positionX);
+            _mm_storeu_ps(pPositionOut + written * 4 +  4, positionY);
+            _mm_storeu_ps(pPositionOut + written * 4 +  8, positionZ);
+            _mm_storeu_ps(pPositionOut + written * 4 + 12, size);
+
+            _mm_storeu_ps(pColorOut + written * 3 + 0, color0);
+            _mm_storeu_ps(pColorOut + written * 3 + 4, color1);
+            _mm_storeu_ps(pColorOut + written * 3 + 8, color2);
+
+            written += 4;
+            continue;
+        }
+
+        // Some particles died, only the living ones are written
+        alignas(16) float positions[16];
+        alignas(16) float colors   [12];
+
+        _mm_store_ps(positions +  0, positionX);
+        _mm_store_ps(positions +  4, positionY);
+        _mm_store_ps(positions +  8, positionZ);
+        _mm_store_ps(positions + 12, size);
+        _mm_store_ps(colors + 0, color0);
+        _mm_store_ps(colors + 4, color1);
+        _mm_store_ps(colors + 8, color2);
+
+        for(int nLane = 0; nLane < 4; ++nLane)
+        {
+            if(mask & (1 << nLane))
+            {
+                pPositionOut[written * 4 + 0] = positions[nLane * 4 + 0];
+                pPositionOut[written * 4 + 1] = positions[nLane * 4 + 1];
+                pPositionOut[written * 4 + 2] = positions[nLane * 4 + 2];
+                pPositionOut[written * 4 + 3] = positions[nLane * 4 + 3];
+
+                pColorOut[written * 3 + 0] = colors[nLane * 3 + 0];
+                pColorOut[written * 3 + 1] = colors[nLane * 3 + 1];
+                pColorOut[written * 3 + 2] = colors[nLane * 3 + 2];
+
+                written++;
+            }
+        }
+    }
+
+    // Scalar tail
+    written += SimulateScalar(particles, simdEnd, end, gravity, dt,
+                              pPositionOut + written * 4, pColorOut + written * 3);
+
+    return written;
+#else
+    return SimulateScalar(particles, begin, end, gravity, dt, pPositionOut, pColorOut);
+#endif
+}
+
+/// \brief  Closes the gaps left in the billboard buffers by the jobs
+///         Job n wrote its billboards from the particle n * jobSize
+/// \param  pPositions The billboard position buffer
+/// \param  pColors The billboard color buffer
+/// \param  pJobWritten The number of billboards written by each job
+/// \param  jobCount The number of jobs
+/// \param  jobSize The number of particles simulated by each job
+/// \return The number of billboards, packed at the front
+/* static */ int ParticleSimulation::PackJobs(
+        float * pPositions, float * pColors,
+        int const * pJobWritten, int jobCount, int jobSize)
+{
+    int billboardCount = 0;
+    for(int nJob = 0; nJob < jobCount; ++nJob)
+    {
+        int begin = nJob * jobSize;
+        if(begin != billboardCount)
+        {
+            memmove(pPositions + billboardCount * 4, pPositions + begin * 4, pJobWritten[nJob] * 4 * sizeof(float));
+            memmove(pColors    + billboardCount * 3, pColors    + begin * 3, pJobWritten[nJob] * 3 * sizeof(float));
+        }
+
+        billboardCount += pJobWritten[nJob];
+    }
+
+    return billboardCount;
+}
+
+} // !namespace
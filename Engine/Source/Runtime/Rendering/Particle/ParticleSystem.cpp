@@ -21,10 +21,13 @@
 /// \package    Runtime/Rendering/Particle
 /// \author     Vincent STEHLY--CALISTO
 
+#include <algorithm>
+
 #include "ImGUI/Header/ImGUI/imgui.h"
 #include "Runtime/Core/Assertion/Assert.hh"
 #include "Runtime/Rendering/Debug/Debug.hpp"
 #include "Runtime/Rendering/Particle/ParticleSystem.hpp"
+#include "Runtime/Rendering/Particle/ParticleSimulation.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -33,10 +36,10 @@ namespace cardinal
 /// \brief Constructor
 ParticleSystem::ParticleSystem()
 {
-    m_pParticles       = nullptr;
     m_pEmissionShape   = nullptr;
     m_particleAmount   = 0;
-    m_lastUsedParticle = 0;
+    m_liveParticles    = 0;
+    m_simulatedParticles = 0;
     m_emissionRate     = 0;
     m_speed            = 1.0f;
     m_size             = 1.0f;
@@ -51,7 +54,7 @@ ParticleSystem::ParticleSystem()
 /// \brief Destructor
 ParticleSystem::~ParticleSystem() // NOLINT
 {
-    delete[] m_pParticles;
+    // None
 }
 
 /// \brief Initializes the particle system
@@ -66,7 +69,7 @@ ParticleSystem::~ParticleSystem() // NOLINT
 void ParticleSystem::Initialize(int maxParticles, int emissionRate, float lifeTime, float size,  float speed, glm::vec3 const& gravity, glm::vec3 const& color, EmissionShape * pEmissionShape)
 {
     m_particleAmount = maxParticles;
-    m_pParticles     = new Particle[m_particleAmount];
+    m_liveParticles  = 0;
     m_emissionRate   = emissionRate;
     m_lifeTime       = lifeTime;
     m_size           = size;
@@ -77,65 +80,105 @@ void ParticleSystem::Initialize(int maxParticles, int emissionRate, float lifeTi
 
     ASSERT_NOT_NULL(m_pEmissionShape);
 
-    for(int i = 0; i < m_particleAmount; ++i)
-    {
-        m_pParticles[i].lifeTime = 0.0f;
-    }
+    // All particles are dead after the allocation
+    m_particles.Allocate(m_particleAmount);
 
     m_renderer.Initialize(m_particleAmount);
     m_renderer.SetShader(&m_shader);
 }
 
-/// \brief Updates billboards
+/// \brief Updates billboards, on the calling thread only
 /// \param dt The elapsed time
 void ParticleSystem::Update(float dt)
 {
-    int particleToEmit = (int)(dt * (float)m_emissionRate); // NOLINT
+    Emit(dt);
 
-    // Emitting
-    for(int i = 0; i < particleToEmit; ++i)
+    int jobCount = GetJobCount();
+    for(int nJob = 0; nJob < jobCount; ++nJob)
     {
-        int index                 = GetNewParticle();
-        Particle& currentParticle = m_pParticles[index];
-
-        currentParticle.size     = m_size;
-        currentParticle.lifeTime = m_lifeTime;
-        currentParticle.position = m_pEmissionShape->GetStartPosition(m_position);
-        currentParticle.color    = m_color;
-        currentParticle.velocity = m_pEmissionShape->GetDirection(currentParticle.position, m_position) * m_speed;
+        SimulateJob(nJob, dt);
     }
 
-    // Simulate all particles
-    int particlesCount = 0;
-    for(int i = 0; i < m_particleAmount; i++)
-    {
-        Particle& currentParticle = m_pParticles[i];
+    EndUpdate();
+}
 
-        if(currentParticle.lifeTime > 0.0f)
+/// \brief Emits the new particles of the step
+///        Thread safe with the other systems
+/// \param dt The elapsed time
+void ParticleSystem::Emit(float dt)
+{
+    int particleToEmit = (int)(dt * (float)m_emissionRate); // NOLINT
+
+    // Emitting
+    for(int i = 0; i < particleToEmit; ++i)
+    {
+        int index = GetNewParticle();
+        if (index == -1)
         {
-            // Decrease life
-            currentParticle.lifeTime -= dt;
-            if (currentParticle.lifeTime > 0.0f)
-            {
-                // Simple physics : gravity only, no collisions
-                currentParticle.velocity += m_gravity * dt;
-                currentParticle.position += currentParticle.velocity * dt;
-
-                // Fill the GPU buffer
-                m_renderer.billboardPositionBuffer[particlesCount * 4 + 0] = currentParticle.position.x;
-                m_renderer.billboardPositionBuffer[particlesCount * 4 + 1] = currentParticle.position.y;
-                m_renderer.billboardPositionBuffer[particlesCount * 4 + 2] = currentParticle.position.z;
-                m_renderer.billboardPositionBuffer[particlesCount * 4 + 3] = currentParticle.size;
-
-                m_renderer.billboardColorBuffer[particlesCount * 3 + 0] = currentParticle.color.x;
-                m_renderer.billboardColorBuffer[particlesCount * 3 + 1] = currentParticle.color.y;
-                m_renderer.billboardColorBuffer[particlesCount * 3 + 2] = currentParticle.color.z;
-            }
-
-            particlesCount++;
+            // The pool is full, the emission resumes when particles die
+            break;
         }
+
+        glm::vec3 position = m_pEmissionShape->GetStartPosition(m_position, m_generator);
+        glm::vec3 velocity = m_pEmissionShape->GetDirection(position, m_position) * m_speed;
+
+        m_particles.size     [index] = m_size;
+        m_particles.lifeTime [index] = m_lifeTime;
+        m_particles.positionX[index] = position.x;
+        m_particles.positionY[index] = position.y;
+        m_particles.positionZ[index] = position.z;
+        m_particles.velocityX[index] = velocity.x;
+        m_particles.velocityY[index] = velocity.y;
+        m_particles.velocityZ[index] = velocity.z;
+        m_particles.colorR   [index] = m_color.x;
+        m_particles.colorG   [index] = m_color.y;
+        m_particles.colorB   [index] = m_color.z;
     }
 
+    // The living particles are split in fixed slices, the
+    // result does not depend on the number of threads
+    m_simulatedParticles = m_liveParticles;
+    m_jobWritten.assign(static_cast<size_t>(GetJobCount()), 0);
+}
+
+/// \brief Returns the number of simulation jobs of the step
+///        Only valid between Emit and EndUpdate
+int ParticleSystem::GetJobCount() const
+{
+    return (m_simulatedParticles + s_jobSize - 1) / s_jobSize;
+}
+
+/// \brief Simulates a slice of s_jobSize particles
+///        Thread safe with the other jobs of all systems
+/// \param nJob The index of the job
+/// \param dt The elapsed time
+void ParticleSystem::SimulateJob(int nJob, float dt)
+{
+    int begin = nJob * s_jobSize;
+    int end   = std::min(begin + s_jobSize, m_simulatedParticles);
+
+    // Each job writes its billboards from the beginning of its slice
+    m_jobWritten[nJob] = ParticleSimulation::Simulate(
+            m_particles, begin, end, m_gravity, dt,
+            m_renderer.billboardPositionBuffer + begin * 4,
+            m_renderer.billboardColorBuffer    + begin * 3);
+}
+
+/// \brief Packs the billboards and the particles of the jobs
+///        and uploads the billboards, on the main thread
+void ParticleSystem::EndUpdate()
+{
+    // Closes the gaps left by the particles that died in each slice
+    int particlesCount = ParticleSimulation::PackJobs(
+            m_renderer.billboardPositionBuffer,
+            m_renderer.billboardColorBuffer,
+            m_jobWritten.data(), GetJobCount(), s_jobSize);
+
+    // Packs the survivors for the next step
+    m_liveParticles      = m_particles.Compact(m_simulatedParticles);
+    m_simulatedParticles = 0;
+    ASSERT_EQ(m_liveParticles, particlesCount);
+
     // Update renderer
     m_renderer.SetElementCount(particlesCount);
     m_renderer.UpdateBuffer();
@@ -144,31 +187,18 @@ void ParticleSystem::Update(float dt)
         m_pEmissionShape->DrawGizmo(m_position);
 }
 
-/// \brief Finds and returns a new particle
+/// \brief  Returns a new particle, in O(1)
+///         Living particles are packed in [0, m_liveParticles)
+/// \return The index of the particle, -1 if the pool is full
 int ParticleSystem::GetNewParticle()
 {
-    for(int i = m_lastUsedParticle; i < m_particleAmount; i++)
+    if (m_liveParticles == m_particleAmount)
     {
-        if (m_pParticles[i].lifeTime <= 0.0f)
-        {
-            m_lastUsedParticle = i;
-            return i;
-        }
+        // Not enough particles ...
+        return -1;
     }
 
-    // The linear search failed from the last used particle index
-    // Restarting
-    for(int i = 0; i < m_lastUsedParticle; i++)
-    {
-        if (m_pParticles[i].lifeTime <= 0.0f)
-        {
-            m_lastUsedParticle = i;
-            return i;
-        }
-    }
-
-    // Not enough particles ...
-    return 0;
+    return m_liveParticles++;
 }
 
 /// \brief Sets the position of the particle system
@@ -178,6 +208,15 @@ void ParticleSystem::SetPosition(glm::vec3 const& position)
     m_position = position;
 }
 
+/// \brief Sets the seed of the emission
+///        The simulation is deterministic for a given seed,
+///        whatever the number of threads updating the systems
+/// \param seed The new seed
+void ParticleSystem::SetSeed(uint32_t seed)
+{
+    m_generator.seed(seed);
+}
+
 /// \brief Called when the object is inspected
 void ParticleSystem::OnInspectorGUI()
 {
@@ -201,7 +240,7 @@ void ParticleSystem::OnInspectorGUI()
     ImGui::InputFloat3("Position###Particle_position", &m_position[0], 3);
 
     // Debugs
-    ImGui::TextDisabled("\nLast index : %d", m_lastUsedParticle);
+    ImGui::TextDisabled("\nLive count : %d", m_liveParticles);
     ImGui::TextDisabled(  "Max amount : %d", m_particleAmount);
 
     // Components
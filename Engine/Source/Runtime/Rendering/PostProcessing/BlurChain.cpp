@@ -0,0 +1,231 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BlurChain.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/PostProcessing
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+
+#include "Glew/include/GL/glew.h"
+#include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/PostProcessing/BlurChain.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ constexpr float BlurChain::s_maxSpread;
+
+/// \brief Constructor
+BlurChain::BlurChain()
+: m_width(0)
+, m_height(0)
+, m_passCount(0)
+, m_quadVao(0)
+, m_fbo(0)
+, m_downsampleShaderID(0)
+, m_separableShaderID(0)
+, m_directionID(-1)
+, m_weightsID(-1)
+{
+    for(int nLevel = 0; nLevel < s_levelCount; ++nLevel)
+    {
+        m_textures[nLevel][0] = 0;
+        m_textures[nLevel][1] = 0;
+    }
+}
+
+/// \brief Selects the level and the tap step of a blur
+/* static */ int BlurChain::SelectLevel(float radius, float & spread)
+{
+    // The taps of level n are 2^(n+1) full resolution pixels apart
+    int level = 0;
+    spread    = radius / (s_kernelTaps * 2.0f);
+
+    while(spread > s_maxSpread && level < s_levelCount - 1)
+    {
+        level  += 1;
+        spread *= 0.5f;
+    }
+
+    // The largest radii undersample the last level
+    return level;
+}
+
+/// \brief Returns the size of a level on an axis
+/* static */ int BlurChain::GetLevelSize(int size, int level)
+{
+    return std::max(size >> (level + 1), 1);
+}
+
+/// \brief Blurs a texture
+uint BlurChain::Blur(uint sourceTexture, float radius, EKernel kernel)
+{
+    if(!(radius > 0.0f))
+    {
+        return sourceTexture;
+    }
+
+    float spread = 0.0f;
+    int   level  = SelectLevel(radius, spread);
+    uint  input  = Downsample(sourceTexture, level);
+
+    static const float gaussianWeights[s_kernelTaps + 1] = { 0.227027f, 0.1945946f, 0.1216216f, 0.054054f, 0.016216f };
+    static const float boxWeights     [s_kernelTaps + 1] = { 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f, 1.0f / 9.0f };
+
+    float levelWidth  = static_cast<float>(GetLevelSize(m_width,  level));
+    float levelHeight = static_cast<float>(GetLevelSize(m_height, level));
+
+    glUseProgram(m_separableShaderID);
+    glUniform1fv(m_weightsID, s_kernelTaps + 1, kernel == EKernel::Gaussian ? gaussianWeights : boxWeights);
+
+    // Horizontal then vertical
+    glUniform2f(m_directionID, spread / levelWidth, 0.0f);
+    RenderPass (input, m_textures[level][1], level);
+
+    glUniform2f(m_directionID, 0.0f, spread / levelHeight);
+    RenderPass (m_textures[level][1], m_textures[level][0], level);
+
+    return m_textures[level][0];
+}
+
+/// \brief Downsamples a texture without blurring it further
+uint BlurChain::Downsample(uint sourceTexture, int level)
+{
+    level = std::min(std::max(level, 0), s_levelCount - 1);
+
+    glUseProgram(m_downsampleShaderID);
+
+    uint input = sourceTexture;
+    for(int nLevel = 0; nLevel <= level; ++nLevel)
+    {
+        RenderPass(input, m_textures[nLevel][0], nLevel);
+        input = m_textures[nLevel][0];
+    }
+
+    return input;
+}
+
+/// \brief Returns the count of passes since the last reset
+int BlurChain::GetPassCount() const
+{
+    return m_passCount;
+}
+
+/// \brief Resets the count of passes
+void BlurChain::ResetPassCount()
+{
+    m_passCount = 0;
+}
+
+/// \brief Creates the targets and gets the programs
+void BlurChain::Initialize(int width, int height, uint quadVao)
+{
+    m_quadVao = quadVao;
+
+    m_downsampleShaderID = (uint)ShaderManager::GetShaderID("BlurDownsamplePostProcess");
+    m_separableShaderID  = (uint)ShaderManager::GetShaderID("BlurSeparablePostProcess");
+    m_directionID        = glGetUniformLocation(m_separableShaderID, "direction");
+    m_weightsID          = glGetUniformLocation(m_separableShaderID, "weights");
+
+    glUseProgram(m_downsampleShaderID);
+    glUniform1i (glGetUniformLocation(m_downsampleShaderID, "colorTexture"), 0);
+    glUseProgram(m_separableShaderID);
+    glUniform1i (glGetUniformLocation(m_separableShaderID,  "colorTexture"), 0);
+    glUseProgram(0);
+
+    glGenFramebuffers(1, &m_fbo);
+
+    for(int nLevel = 0; nLevel < s_levelCount; ++nLevel)
+    {
+        glGenTextures(2, m_textures[nLevel]);
+
+        for(int nTexture = 0; nTexture < 2; ++nTexture)
+        {
+            // Linear filtering, the taps and the upsampling read between texels
+            glBindTexture  (GL_TEXTURE_2D, m_textures[nLevel][nTexture]);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    Resize(width, height);
+}
+
+/// \brief Deletes the targets
+void BlurChain::Release()
+{
+    for(int nLevel = 0; nLevel < s_levelCount; ++nLevel)
+    {
+        glDeleteTextures(2, m_textures[nLevel]);
+        m_textures[nLevel][0] = 0;
+        m_textures[nLevel][1] = 0;
+    }
+
+    glDeleteFramebuffers(1, &m_fbo);
+    m_fbo = 0;
+}
+
+/// \brief Resizes the targets
+void BlurChain::Resize(int width, int height)
+{
+    m_width  = width;
+    m_height = height;
+
+    for(int nLevel = 0; nLevel < s_levelCount; ++nLevel)
+    {
+        int levelWidth  = GetLevelSize(width,  nLevel);
+        int levelHeight = GetLevelSize(height, nLevel);
+
+        for(int nTexture = 0; nTexture < 2; ++nTexture)
+        {
+            glBindTexture(GL_TEXTURE_2D, m_textures[nLevel][nTexture]);
+            glTexImage2D (GL_TEXTURE_2D, 0, GL_RGB, levelWidth, levelHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+        }
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+/// \brief Renders a texture into a target of a level with the bound program
+void BlurChain::RenderPass(uint sourceTexture, uint targetTexture, int level)
+{
+    glBindFramebuffer     (GL_FRAMEBUFFER, m_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, targetTexture, 0);
+    glViewport            (0, 0, GetLevelSize(m_width, level), GetLevelSize(m_height, level));
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture  (GL_TEXTURE_2D, sourceTexture);
+
+    glBindVertexArray(m_quadVao);
+    glEnableVertexAttribArray(0);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    glDisableVertexAttribArray(0);
+    glBindVertexArray(0);
+
+    m_passCount++;
+}
+
+} // !namespace
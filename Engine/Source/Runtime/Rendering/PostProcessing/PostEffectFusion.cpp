@@ -0,0 +1,142 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PostEffectFusion.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/PostProcessing
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Runtime/Rendering/PostProcessing/PostEffectFusion.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/// \brief Tells if an effect can be appended to a run
+/// \param run The current run
+/// \param pEffect The fusible effect to append
+/// \return True if the effect can be fused with the run
+/* static */ bool PostEffectFusion::CanAppend(std::vector<PostEffect *> const& run, PostEffect const* pEffect)
+{
+    if(pEffect->GetFusion() == PostEffect::EFusion::NotFused)
+    {
+        return false;
+    }
+
+    // A coordinate effect would also move the colors already computed
+    if(pEffect->GetFusion() == PostEffect::EFusion::CoordinateFusion)
+    {
+        for(PostEffect const* pFused : run)
+        {
+            if(pFused->GetFusion() == PostEffect::EFusion::ColorFusion)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/// \brief Returns the key identifying the program of a run
+/// \param run The run
+/// \return The names of the effects joined by '+'
+/* static */ std::string PostEffectFusion::GetKey(std::vector<PostEffect *> const& run)
+{
+    std::string key;
+    for(PostEffect const* pEffect : run)
+    {
+        if(!key.empty())
+        {
+            key += "+";
+        }
+
+        key += pEffect->GetName();
+    }
+
+    return key;
+}
+
+/// \brief Generates the fragment shader of a run
+/// \param run The run
+/// \return The GLSL source
+/* static */ std::string PostEffectFusion::GenerateFragmentShader(std::vector<PostEffect *> const& run)
+{
+    std::string source =
+        "#version 330 core\n"
+        "\n"
+        "// In\n"
+        "in vec2 textureUV;\n"
+        "\n"
+        "// Out\n"
+        "out vec3 color;\n"
+        "\n"
+        "// Uniform\n"
+        "uniform sampler2D colorTexture;\n"
+        "uniform sampler2D depthTexture;\n";
+
+    for(PostEffect const* pEffect : run)
+    {
+        source += pEffect->GetFusedSource();
+    }
+
+    source += "\nvoid main(void)\n{\n    vec2 coord = textureUV;\n";
+
+    // The last coordinate effect of the stack is the first to remap the coordinate
+    for(auto it = run.rbegin(); it != run.rend(); ++it)
+    {
+        if((*it)->GetFusion() == PostEffect::EFusion::CoordinateFusion)
+        {
+            source += "    coord = " + (*it)->GetName() + "Effect(coord);\n";
+        }
+    }
+
+    source += "    vec3 _color = texture(colorTexture, coord).rgb;\n";
+
+    for(PostEffect const* pEffect : run)
+    {
+        if(pEffect->GetFusion() == PostEffect::EFusion::ColorFusion)
+        {
+            source += "    _color = " + pEffect->GetName() + "Effect(_color, textureUV);\n";
+        }
+    }
+
+    source += "    color = _color;\n}\n";
+    return source;
+}
+
+/// \brief Returns the full screen vertex shader used by fused programs
+/* static */ const char * PostEffectFusion::GetVertexShader()
+{
+    return R"(#version 330 core
+
+// In
+layout(location = 0) in vec2 vertexCoord;
+
+// Out
+out vec2 textureUV;
+
+void main(void)
+{
+  gl_Position = vec4(vertexCoord, 0.0, 1.0);
+  textureUV   = (vertexCoord + 1.0) / 2.0;
+}
+)";
+}
+
+} // !namespace
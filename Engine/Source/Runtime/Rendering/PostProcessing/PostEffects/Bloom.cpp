@@ -38,16 +38,14 @@ Bloom::Bloom() : PostEffect(PostEffect::EType::Bloom, "Bloom")
     // Getting uniforms
     m_colorTextureID = glGetUniformLocation(m_shaderID, "colorTexture");
     m_colorID        = glGetUniformLocation(m_shaderID, "bloomColor");
-    m_qualityID      = glGetUniformLocation(m_shaderID, "quality"),
-    m_sampleCountID  = glGetUniformLocation(m_shaderID, "sampleCount");
+    m_blurTextureID  = glGetUniformLocation(m_shaderID, "blurTexture");
 
     m_color       = glm::vec3(0.8f);
     m_quality     = 2.5f;
     m_sampleCount = 5;
+    m_blurTexture = 0;
 
     glUseProgram(m_shaderID);
-    glUniform1f (m_qualityID, m_quality);
-    glUniform1i (m_sampleCountID, m_sampleCount);
     glUniform3f (m_colorID, m_color.x, m_color.y, m_color.z);
     glUseProgram(0);
 }
@@ -58,18 +56,33 @@ Bloom::~Bloom() // NOLINT
     // None
 }
 
+/// \brief Blurs the color texture with the blur chain
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void Bloom::PrepareEffect(BlurChain & blurChain, uint colorTexture, uint /* lightScatteringTexture */)
+{
+    // The samples were spaced by the quality around the pixel
+    float radius  = static_cast<float>((m_sampleCount - 1) / 2) * m_quality;
+    m_blurTexture = blurChain.Blur(colorTexture, radius, BlurChain::EKernel::Box);
+}
+
 /// \brief Applies the effect from the given textures
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Bloom::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                        uint shadowMapTexture)
+void Bloom::ApplyEffect(uint colorTexture, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                        uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture  (GL_TEXTURE_2D, colorTexture);
     glUniform1i    (m_colorTextureID, 0);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture  (GL_TEXTURE_2D, m_blurTexture);
+    glUniform1i    (m_blurTextureID, 1);
 }
 
 /// \brief Called to draw the GUI
@@ -78,12 +91,7 @@ void Bloom::OnGUI()
     ImGui::Checkbox("Enabled###Enabled_Bloom", &m_bIsActive);
 
     ImGui::Text("\nQuality");
-    if(ImGui::SliderFloat("###Quality_Bloom", &m_quality, 0.0f, 5.0f, "Quality = %.3f"))
-    {
-        glUseProgram(m_shaderID);
-        glUniform1f (m_qualityID, m_quality);
-        glUseProgram(0);
-    }
+    ImGui::SliderFloat("###Quality_Bloom", &m_quality, 0.0f, 5.0f, "Quality = %.3f");
 
     ImGui::Text("\nTone");
     if(ImGui::ColorEdit4("###Tone_Bloom", &m_color[0]))
@@ -94,12 +102,7 @@ void Bloom::OnGUI()
     }
 
     ImGui::Text("\nSamples");
-    if(ImGui::SliderInt("###Sample_Bloom", &m_sampleCount, 0, 10))
-    {
-        glUseProgram(m_shaderID);
-        glUniform1i (m_sampleCountID, m_sampleCount);
-        glUseProgram(0);
-    }
+    ImGui::SliderInt("###Sample_Bloom", &m_sampleCount, 0, 10);
 }
 
 } // !namespace
\ No newline at end of file
@@ -36,13 +36,9 @@ BoxBlur::BoxBlur() : PostEffect(PostEffect::EType::BoxBlur, "Box blur")
     m_shaderID = (uint)ShaderManager::GetShaderID("BoxBlurPostProcess");
 
     // Getting uniforms
-    m_colorTextureID = glGetUniformLocation(m_shaderID, "colorTexture");
-    m_intesityID     = glGetUniformLocation(m_shaderID, "intensity");
-    m_intensity      = 3;
-
-    glUseProgram(m_shaderID);
-    glUniform1i (m_intesityID, m_intensity);
-    glUseProgram(0);
+    m_blurTextureID = glGetUniformLocation(m_shaderID, "blurTexture");
+    m_intensity     = 3;
+    m_blurTexture   = 0;
 }
 
 /// \brief Destructor
@@ -51,18 +47,27 @@ BoxBlur::~BoxBlur() // NOLINT
     // None
 }
 
+/// \brief Blurs the color texture with the blur chain
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void BoxBlur::PrepareEffect(BlurChain & blurChain, uint colorTexture, uint /* lightScatteringTexture */)
+{
+    m_blurTexture = blurChain.Blur(colorTexture, m_intensity * 0.5f, BlurChain::EKernel::Box);
+}
+
 /// \brief Applies the effect from the given textures
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void BoxBlur::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                          uint shadowMapTexture)
+void BoxBlur::ApplyEffect(uint /* colorTexture */, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                          uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture  (GL_TEXTURE_2D, colorTexture);
-    glUniform1i    (m_colorTextureID, 0);
+    glBindTexture  (GL_TEXTURE_2D, m_blurTexture);
+    glUniform1i    (m_blurTextureID, 0);
 }
 
 /// \brief Called to display the GUI
@@ -71,18 +76,7 @@ void BoxBlur::OnGUI()
     ImGui::Checkbox("Enabled###Enabled_BoxBlur", &m_bIsActive);
 
     ImGui::Text("\nIntensity");
-    if(ImGui::SliderInt("###Slider_BoxBlurIntensity", &m_intensity, 3, 20))
-    {
-        int _intensity = m_intensity;
-        if((_intensity & 1) == 0)
-        {
-            _intensity++;
-        }
-
-        glUseProgram(m_shaderID);
-        glUniform1i (m_intesityID, _intensity);
-        glUseProgram(0);
-    }
+    ImGui::SliderInt("###Slider_BoxBlurIntensity", &m_intensity, 3, 20);
 }
 
 } // !namespace
\ No newline at end of file
@@ -39,15 +39,15 @@ DepthOfField::DepthOfField() : PostEffect(PostEffect::EType::DepthOfField, "Dept
     m_colorTextureID = glGetUniformLocation(m_shaderID, "colorTexture");
     m_depthTextureID = glGetUniformLocation(m_shaderID, "depthTexture");
 
-    m_intensityID    = glGetUniformLocation(m_shaderID, "intensity");
+    m_blurTextureID  = glGetUniformLocation(m_shaderID, "blurTexture");
     m_blurPlaneID    = glGetUniformLocation(m_shaderID, "blurPlane");
 
-    m_blurPlane = 200.0f;
-    m_intensity = 20;
+    m_blurPlane   = 200.0f;
+    m_intensity   = 20;
+    m_blurTexture = 0;
 
     glUseProgram(m_shaderID);
     glUniform1f (m_blurPlaneID, m_blurPlane);
-    glUniform1i (m_intensityID, m_intensity);
     glUseProgram(0);
 }
 
@@ -57,11 +57,20 @@ DepthOfField::~DepthOfField() // NOLINT
     // None
 }
 
+/// \brief Blurs the color texture with the blur chain
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void DepthOfField::PrepareEffect(BlurChain & blurChain, uint colorTexture, uint /* lightScatteringTexture */)
+{
+    m_blurTexture = blurChain.Blur(colorTexture, m_intensity * 0.5f, BlurChain::EKernel::Box);
+}
+
 /// \brief Applies the effect from the given textures
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void DepthOfField::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture, uint shadowMapTexture)
+void DepthOfField::ApplyEffect(uint colorTexture, uint depthTexture, uint /* lightScatteringTexture */, uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -72,6 +81,10 @@ void DepthOfField::ApplyEffect(uint colorTexture, uint depthTexture, uint lightS
     glActiveTexture(GL_TEXTURE1);
     glBindTexture  (GL_TEXTURE_2D, depthTexture);
     glUniform1i    (m_depthTextureID, 1);
+
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture  (GL_TEXTURE_2D, m_blurTexture);
+    glUniform1i    (m_blurTextureID, 2);
 }
 
 /// \brief Called to display the GUI
@@ -88,12 +101,7 @@ void DepthOfField::OnGUI()
     }
 
     ImGui::Text("\nIntensity");
-    if(ImGui::SliderInt("###Intensity_dop", &m_intensity, 1, 20))
-    {
-        glUseProgram(m_shaderID);
-        glUniform1i (m_intensityID, m_intensity);
-        glUseProgram(0);
-    }
+    ImGui::SliderInt("###Intensity_dop", &m_intensity, 1, 20);
 }
 
 } // !namespace
\ No newline at end of file
@@ -61,7 +61,7 @@ Fog::~Fog() // NOLINT
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Fog::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture, uint shadowMapTexture)
+void Fog::ApplyEffect(uint colorTexture, uint depthTexture, uint /* lightScatteringTexture */, uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -96,4 +96,47 @@ void Fog::OnGUI()
     }
 }
 
+/// \brief Tells how the effect can be fused with its neighbors
+PostEffect::EFusion Fog::GetFusion() const
+{
+    return EFusion::ColorFusion;
+}
+
+/// \brief Returns the GLSL uniforms and function of the effect
+const char * Fog::GetFusedSource() const
+{
+    return R"(
+uniform vec3  fogColor;
+uniform float fogDensity;
+
+vec3 FogEffect(vec3 color, vec2 uv)
+{
+    float zNear = 0.1f;
+    float zFar  = 2000.0f;
+    float depth = texture(depthTexture, uv).x;
+    float fragmentDepth = (2.0f * zNear) / (zFar + zNear - depth * (zFar - zNear));
+
+    float fogFactor = exp2(-fogDensity * fogDensity * fragmentDepth * fragmentDepth * 1.442695f);
+    return mix(fogColor, color, clamp(fogFactor, 0.0f, 1.0f));
+}
+)";
+}
+
+/// \brief Queries the locations of the uniforms of the effect in a fused program
+/// \param program The linked fused program
+/// \param uniformIDs The locations to append to
+void Fog::GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const
+{
+    uniformIDs.push_back(glGetUniformLocation(program, "fogColor"));
+    uniformIDs.push_back(glGetUniformLocation(program, "fogDensity"));
+}
+
+/// \brief Uploads the uniforms of the effect to the bound fused program
+/// \param pUniformIDs The locations appended by GetFusedUniformIDs
+void Fog::SetFusedUniforms(int const* pUniformIDs) const
+{
+    glUniform3f(pUniformIDs[0], m_fogColor.x, m_fogColor.y, m_fogColor.z);
+    glUniform1f(pUniformIDs[1], m_fogDensity);
+}
+
 } // !namespace
\ No newline at end of file
@@ -36,14 +36,10 @@ GaussianBlur::GaussianBlur() : PostEffect(PostEffect::EType::GaussianBlur, "Gaus
     m_shaderID = (uint)ShaderManager::GetShaderID("GaussianBlurPostProcess");
 
     // Getting uniforms
-    m_intensityID    = glGetUniformLocation(m_shaderID, "intensity");
-    m_colorTextureID = glGetUniformLocation(m_shaderID, "colorTexture");
+    m_blurTextureID = glGetUniformLocation(m_shaderID, "blurTexture");
 
-    m_intensity = 1.0f;
-
-    glUseProgram(m_shaderID);
-    glUniform1f (m_intensityID, m_intensity);
-    glUseProgram(0);
+    m_intensity   = 1.0f;
+    m_blurTexture = 0;
 }
 
 /// \brief Destructor
@@ -52,18 +48,28 @@ GaussianBlur::~GaussianBlur() // NOLINT
     // None
 }
 
+/// \brief Blurs the color texture with the blur chain
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void GaussianBlur::PrepareEffect(BlurChain & blurChain, uint colorTexture, uint /* lightScatteringTexture */)
+{
+    // Three deviations hold most of the weight of the gaussian
+    m_blurTexture = blurChain.Blur(colorTexture, 3.0f * m_intensity, BlurChain::EKernel::Gaussian);
+}
+
 /// \brief Applies the effect from the given textures
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void GaussianBlur::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                               uint shadowMapTexture)
+void GaussianBlur::ApplyEffect(uint /* colorTexture */, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                               uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
     glActiveTexture(GL_TEXTURE0);
-    glBindTexture  (GL_TEXTURE_2D, colorTexture);
-    glUniform1i    (m_colorTextureID, 0);
+    glBindTexture  (GL_TEXTURE_2D, m_blurTexture);
+    glUniform1i    (m_blurTextureID, 0);
 }
 
 /// \brief Called to draw the GUI
@@ -72,12 +78,7 @@ void GaussianBlur::OnGUI()
     ImGui::Checkbox("Enabled###Enabled_GaussianBlur", &m_bIsActive);
 
     ImGui::Text("\nIntensity");
-    if(ImGui::SliderFloat("###Slider_GaussianBlurIntensity", &m_intensity, 0.0f, 10.0f))
-    {
-        glUseProgram(m_shaderID);
-        glUniform1f (m_intensityID, m_intensity);
-        glUseProgram(0);
-    }
+    ImGui::SliderFloat("###Slider_GaussianBlurIntensity", &m_intensity, 0.0f, 10.0f);
 }
 
 } // !namespace
\ No newline at end of file
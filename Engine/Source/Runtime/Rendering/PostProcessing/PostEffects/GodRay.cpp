@@ -58,6 +58,8 @@ GodRay::GodRay() : PostEffect(PostEffect::EType::GodRay, "God ray")
     m_exposure    = 0.2f;
     m_sampleCount = 128;
 
+    m_scatteringTexture = 0;
+
     glUseProgram(m_shaderID);
     glUniform1f (m_decayID, m_decay);
     glUniform1f (m_weightID, m_weight);
@@ -74,12 +76,22 @@ GodRay::~GodRay() // NOLINT
     // None
 }
 
+/// \brief Downsamples the light scattering texture with the blur chain
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void GodRay::PrepareEffect(BlurChain & blurChain, uint /* colorTexture */, uint lightScatteringTexture)
+{
+    // The rays are smooth, the radial samples read a quarter of the texels
+    m_scatteringTexture = blurChain.Downsample(lightScatteringTexture, 1);
+}
+
 /// \brief Applies the effect from the given textures
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void GodRay::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                         uint shadowMapTexture)
+void GodRay::ApplyEffect(uint colorTexture, uint depthTexture, uint /* lightScatteringTexture */,
+                         uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -92,7 +104,7 @@ void GodRay::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatter
     glUniform1i    (m_depthTextureID, 1);
 
     glActiveTexture(GL_TEXTURE2);
-    glBindTexture  (GL_TEXTURE_2D, lightScatteringTexture);
+    glBindTexture  (GL_TEXTURE_2D, m_scatteringTexture);
     glUniform1i    (m_lightScatteringTextureID, 2);
 
     if(LightManager::GetDirectionalLight() != nullptr)
@@ -107,9 +119,9 @@ void GodRay::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatter
 
         glm::vec3 ndcSpacePos    = subClip / clipSpacePos.w;
         glm::vec2 subNdc         = glm::vec2(ndcSpacePos.x, ndcSpacePos.y);
-        glm::vec2 windowSpacePos = ((subNdc + glm::vec2(1.0f, 1.0f)) / 2.0f) * glm::vec2(1600.0f, 900.0f) + glm::vec2(0.0f, 0.0f);
+        glm::vec2 textureSpacePos = (subNdc + glm::vec2(1.0f, 1.0f)) / 2.0f;
 
-        glUniform2f(m_lightPosition2DID, windowSpacePos.x / 1600.0f, windowSpacePos.y / 900.0f);
+        glUniform2f(m_lightPosition2DID, textureSpacePos.x, textureSpacePos.y);
     }
 }
 
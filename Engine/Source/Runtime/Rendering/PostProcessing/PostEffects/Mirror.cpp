@@ -59,8 +59,8 @@ Mirror::~Mirror() // NOLINT
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Mirror::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                         uint shadowMapTexture)
+void Mirror::ApplyEffect(uint colorTexture, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                         uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -89,4 +89,43 @@ void Mirror::OnGUI()
     }
 }
 
+/// \brief Tells how the effect can be fused with its neighbors
+PostEffect::EFusion Mirror::GetFusion() const
+{
+    return EFusion::CoordinateFusion;
+}
+
+/// \brief Returns the GLSL uniforms and function of the effect
+const char * Mirror::GetFusedSource() const
+{
+    return R"(
+uniform bool mirrorX;
+uniform bool mirrorY;
+
+vec2 MirrorEffect(vec2 uv)
+{
+    if(mirrorX && uv.x > 0.5) uv.x = 1 - uv.x;
+    if(mirrorY && uv.y > 0.5) uv.y = 1 - uv.y;
+    return uv;
+}
+)";
+}
+
+/// \brief Queries the locations of the uniforms of the effect in a fused program
+/// \param program The linked fused program
+/// \param uniformIDs The locations to append to
+void Mirror::GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const
+{
+    uniformIDs.push_back(glGetUniformLocation(program, "mirrorX"));
+    uniformIDs.push_back(glGetUniformLocation(program, "mirrorY"));
+}
+
+/// \brief Uploads the uniforms of the effect to the bound fused program
+/// \param pUniformIDs The locations appended by GetFusedUniformIDs
+void Mirror::SetFusedUniforms(int const* pUniformIDs) const
+{
+    glUniform1i(pUniformIDs[0], m_mirrorX ? 1 : 0);
+    glUniform1i(pUniformIDs[1], m_mirrorY ? 1 : 0);
+}
+
 } // !namespace
\ No newline at end of file
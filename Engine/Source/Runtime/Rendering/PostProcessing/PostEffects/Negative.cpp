@@ -49,8 +49,8 @@ Negative::~Negative() // NOLINT
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Negative::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                           uint shadowMapTexture)
+void Negative::ApplyEffect(uint colorTexture, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                           uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -65,4 +65,21 @@ void Negative::OnGUI()
     ImGui::Checkbox("Enabled###Enabled_Negative", &m_bIsActive);
 }
 
+/// \brief Tells how the effect can be fused with its neighbors
+PostEffect::EFusion Negative::GetFusion() const
+{
+    return EFusion::ColorFusion;
+}
+
+/// \brief Returns the GLSL function of the effect
+const char * Negative::GetFusedSource() const
+{
+    return R"(
+vec3 NegativeEffect(vec3 color, vec2 uv)
+{
+    return vec3(1.0) - color;
+}
+)";
+}
+
 } // !namespace
\ No newline at end of file
@@ -61,4 +61,42 @@ bool PostEffect::IsActive() const
     return m_bIsActive;
 }
 
+/// \brief Renders the intermediate passes of the effect, before its target is bound
+/// \param blurChain The downsampled targets shared by the effects
+/// \param colorTexture The color texture
+/// \param lightScatteringTexture The result of the light scattering pass
+void PostEffect::PrepareEffect(BlurChain & /* blurChain */, uint /* colorTexture */, uint /* lightScatteringTexture */)
+{
+    // None
+}
+
+/// \brief Tells how the effect can be fused with its neighbors
+/// \return NotFused by default
+PostEffect::EFusion PostEffect::GetFusion() const
+{
+    return EFusion::NotFused;
+}
+
+/// \brief Returns the GLSL uniforms and function of the effect
+/// \return The source or nullptr if the effect is not fusible
+const char * PostEffect::GetFusedSource() const
+{
+    return nullptr;
+}
+
+/// \brief Queries the locations of the uniforms of the effect in a fused program
+/// \param program The linked fused program
+/// \param uniformIDs The locations to append to, in the order SetFusedUniforms reads them
+void PostEffect::GetFusedUniformIDs(uint /* program */, std::vector<int> & /* uniformIDs */) const
+{
+    // None
+}
+
+/// \brief Uploads the uniforms of the effect to the bound fused program
+/// \param pUniformIDs The locations appended by GetFusedUniformIDs
+void PostEffect::SetFusedUniforms(int const* /* pUniformIDs */) const
+{
+    // None
+}
+
 } // !namespace
\ No newline at end of file
@@ -60,8 +60,8 @@ Sepia::~Sepia() // NOLINT
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Sepia::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                        uint shadowMapTexture)
+void Sepia::ApplyEffect(uint colorTexture, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                        uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -92,4 +92,47 @@ void Sepia::OnGUI()
     }
 }
 
+/// \brief Tells how the effect can be fused with its neighbors
+PostEffect::EFusion Sepia::GetFusion() const
+{
+    return EFusion::ColorFusion;
+}
+
+/// \brief Returns the GLSL uniforms and function of the effect
+const char * Sepia::GetFusedSource() const
+{
+    return R"(
+uniform float sepiaThreshold;
+uniform vec3  sepiaTone;
+
+vec3 SepiaEffect(vec3 color, vec2 uv)
+{
+    float gray = dot(color, vec3(0.299, 0.587, 0.114));
+    if(gray < sepiaThreshold)
+    {
+        return (gray / sepiaThreshold) * sepiaTone;
+    }
+
+    return gray * (vec3(1.0) - sepiaTone) + sepiaTone;
+}
+)";
+}
+
+/// \brief Queries the locations of the uniforms of the effect in a fused program
+/// \param program The linked fused program
+/// \param uniformIDs The locations to append to
+void Sepia::GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const
+{
+    uniformIDs.push_back(glGetUniformLocation(program, "sepiaThreshold"));
+    uniformIDs.push_back(glGetUniformLocation(program, "sepiaTone"));
+}
+
+/// \brief Uploads the uniforms of the effect to the bound fused program
+/// \param pUniformIDs The locations appended by GetFusedUniformIDs
+void Sepia::SetFusedUniforms(int const* pUniformIDs) const
+{
+    glUniform1f(pUniformIDs[0], m_threshold);
+    glUniform3f(pUniformIDs[1], m_tone.x, m_tone.y, m_tone.z);
+}
+
 } // !namespace
\ No newline at end of file
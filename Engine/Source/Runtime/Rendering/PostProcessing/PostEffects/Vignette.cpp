@@ -65,8 +65,8 @@ Vignette::~Vignette() // NOLINT
 /// \param colorTexture The color texture
 /// \param depthTexture The depth buffer texture
 /// \param lightScatteringTexture The result of the light scattering pass
-void Vignette::ApplyEffect(uint colorTexture, uint depthTexture, uint lightScatteringTexture,
-                           uint shadowMapTexture)
+void Vignette::ApplyEffect(uint colorTexture, uint /* depthTexture */, uint /* lightScatteringTexture */,
+                           uint /* shadowMapTexture */)
 {
     glUseProgram   (m_shaderID);
 
@@ -84,7 +84,7 @@ void Vignette::OnGUI()
     if(ImGui::SliderFloat("###Radius_Vignette", &m_radius, 0.0f, 1.0f, "Radius = %.3f"))
     {
         glUseProgram(m_shaderID);
-        glUniform1f (m_radiusID,   1 - m_radius);
+        glUniform1f (m_radiusID,   m_radius);
         glUseProgram(0);
     }
 
@@ -113,4 +113,49 @@ void Vignette::OnGUI()
     }
 }
 
+/// \brief Tells how the effect can be fused with its neighbors
+PostEffect::EFusion Vignette::GetFusion() const
+{
+    return EFusion::ColorFusion;
+}
+
+/// \brief Returns the GLSL uniforms and function of the effect
+const char * Vignette::GetFusedSource() const
+{
+    return R"(
+uniform float vignetteRadius;
+uniform float vignetteSoftness;
+uniform vec2  vignetteCenter;
+uniform float vignetteOpacity;
+
+vec3 VignetteEffect(vec3 color, vec2 uv)
+{
+    float len      = length(uv - vignetteCenter);
+    float vignette = smoothstep(vignetteRadius, vignetteRadius - vignetteSoftness, len);
+    return mix(color, color * vignette, vignetteOpacity);
+}
+)";
+}
+
+/// \brief Queries the locations of the uniforms of the effect in a fused program
+/// \param program The linked fused program
+/// \param uniformIDs The locations to append to
+void Vignette::GetFusedUniformIDs(uint program, std::vector<int> & uniformIDs) const
+{
+    uniformIDs.push_back(glGetUniformLocation(program, "vignetteRadius"));
+    uniformIDs.push_back(glGetUniformLocation(program, "vignetteSoftness"));
+    uniformIDs.push_back(glGetUniformLocation(program, "vignetteOpacity"));
+    uniformIDs.push_back(glGetUniformLocation(program, "vignetteCenter"));
+}
+
+/// \brief Uploads the uniforms of the effect to the bound fused program
+/// \param pUniformIDs The locations appended by GetFusedUniformIDs
+void Vignette::SetFusedUniforms(int const* pUniformIDs) const
+{
+    glUniform1f(pUniformIDs[0], m_radius);
+    glUniform1f(pUniformIDs[1], m_softness);
+    glUniform1f(pUniformIDs[2], m_opacity);
+    glUniform2f(pUniformIDs[3], m_center.x, m_center.y);
+}
+
 } // !namespace
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include "Glew/include/GL/glew.h"
 
 #include "Runtime/Core/Debug/Logger.hpp"
+#include "Runtime/Rendering/Shader/ShaderCompiler.hpp"
+#include "Runtime/Rendering/PostProcessing/PostEffectFusion.hpp"
 #include "Runtime/Rendering/PostProcessing/PostProcessingStack.hpp"
 
 #include "ImGUI/imgui.h"
@@ -45,6 +47,10 @@ PostProcessingStack::PostProcessingStack()
     m_postProcessTexture      = 0;
     m_postProcessDepthTexture = 0;
     m_shadowMapTextureID      = 0;
+    m_bSwapped                = true;
+    m_passCount               = 0;
+    m_width                   = 0;
+    m_height                  = 0;
 }
 
 /// \brief Initializes the post processing stack
@@ -54,31 +60,34 @@ PostProcessingStack::~PostProcessingStack() // NOLINT
 }
 
 /// \brief Destructor
-void PostProcessingStack::Initialize()
+void PostProcessingStack::Initialize(int width, int height)
 {
     Logger::LogInfo("Initializing the post-processing stack");
 
+    m_width  = width;
+    m_height = height;
+
     // Generating the frame buffer object
     glGenFramebuffers(1, &m_postProcessFbo);
     glBindFramebuffer(GL_FRAMEBUFFER, m_postProcessFbo);
 
     glGenTextures  (1, &m_postProcessTexture);
     glBindTexture  (GL_TEXTURE_2D, m_postProcessTexture);
-    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, 1600, 900, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
     // FBO to render the depth buffer
     m_postProcessRbo = 0;
     glGenRenderbuffers       (1, &m_postProcessRbo);
     glBindRenderbuffer       (GL_RENDERBUFFER, m_postProcessRbo);
-    glRenderbufferStorage    (GL_RENDERBUFFER, GL_DEPTH_COMPONENT, 1600, 900);
+    glRenderbufferStorage    (GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_postProcessRbo);
 
     // Texture for the depth texture
     glGenTextures(1, &m_postProcessDepthTexture);
     glBindTexture(GL_TEXTURE_2D, m_postProcessDepthTexture);
-    glTexImage2D (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, 1600, 900, 0,GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0,GL_DEPTH_COMPONENT, GL_FLOAT, 0);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -117,15 +126,17 @@ void PostProcessingStack::Initialize()
     // Unbind vao
     glBindVertexArray(0);
 
+    m_blurChain.Initialize(width, height, m_postProcessVao);
+
     // Generating the frame buffer object buffer
     glGenFramebuffers(1, &m_postProcessFboBuffer);
     glBindFramebuffer(GL_FRAMEBUFFER, m_postProcessFboBuffer);
 
     glGenTextures  (1, &m_postProcessTextureBuffer);
     glBindTexture  (GL_TEXTURE_2D, m_postProcessTextureBuffer);
-    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, 1600, 900, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
     // Binding buffer
     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_postProcessTextureBuffer, 0);
@@ -167,7 +178,44 @@ void PostProcessingStack::Initialize()
 /// \brief Release the post processing stack
 void PostProcessingStack::Release()
 {
-    // None
+    for(auto const& program : m_fusedPrograms)
+    {
+        glDeleteProgram(program.second.m_program);
+    }
+
+    m_fusedPrograms.clear();
+    m_blurChain.Release();
+}
+
+/// \brief Resizes the render targets
+/// \param width The new width
+/// \param height The new height
+void PostProcessingStack::Resize(int width, int height)
+{
+    if(width == m_width && height == m_height)
+    {
+        return;
+    }
+
+    m_width  = width;
+    m_height = height;
+
+    // The textures keep their names, the frame buffers stay complete
+    glBindTexture(GL_TEXTURE_2D, m_postProcessTexture);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindTexture(GL_TEXTURE_2D, m_postProcessTextureBuffer);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindTexture(GL_TEXTURE_2D, m_postProcessDepthTexture);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindRenderbuffer   (GL_RENDERBUFFER, m_postProcessRbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
+    glBindRenderbuffer   (GL_RENDERBUFFER, 0);
+
+    m_blurChain.Resize(width, height);
 }
 
 /// \brief Called at the beginning of the frame
@@ -177,56 +225,56 @@ void PostProcessingStack::OnPostProcessingBegin(uint lightScatteringTextureID, u
     m_shadowMapTextureID       = shadowMapTextureID;
 
     glBindFramebuffer(GL_FRAMEBUFFER, m_postProcessFbo);
-    glViewport(0, 0, 1600, 900);
+    glViewport(0, 0, m_width, m_height);
 }
 
 /// \brief Called to render effects
-void PostProcessingStack::OnPostProcessingRender()
+/// \param outputWidth The width of the window
+/// \param outputHeight The height of the window
+/// \param bApplyEffects False to only upscale the frame to the window
+void PostProcessingStack::OnPostProcessingRender(int outputWidth, int outputHeight, bool bApplyEffects)
 {
-    bool bSwapped = true;
-
-    glBindFramebuffer     (GL_FRAMEBUFFER, m_postProcessFboBuffer);
-    glViewport            (0, 0, 1600, 900);
-    glFramebufferTexture2D(GL_FRAMEBUFFER , GL_COLOR_ATTACHMENT0 , GL_TEXTURE_2D, m_postProcessTextureBuffer, 0);
+    m_bSwapped  = true;
+    m_passCount = 0;
+    m_blurChain.ResetPassCount();
 
-    // Processing the stack
+    // Processing the stack, consecutive per-pixel effects share a pass
     int effectCount = static_cast<int>(m_stack.size());    // NOLINT
     for(int nEffect = 0; nEffect < effectCount; ++nEffect) // NOLINT
     {
-        if(m_stack[nEffect]->IsActive())
+        PostEffect * pEffect = m_stack[nEffect];
+        if(!bApplyEffects || !pEffect->IsActive())
         {
-            if(bSwapped)
-            {
-                glFramebufferTexture2D(GL_FRAMEBUFFER , GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_postProcessTextureBuffer, 0);
-                m_stack[nEffect]->ApplyEffect(m_postProcessTexture, m_postProcessDepthTexture, m_lightScatteringTextureID, m_shadowMapTextureID);
-                bSwapped = false;
-            }
-            else
+            continue;
+        }
+
+        if(pEffect->GetFusion() != PostEffect::EFusion::NotFused)
+        {
+            if(!PostEffectFusion::CanAppend(m_fusedRun, pEffect))
             {
-                glFramebufferTexture2D(GL_FRAMEBUFFER , GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_postProcessTexture, 0);
-                m_stack[nEffect]->ApplyEffect(m_postProcessTextureBuffer, m_postProcessDepthTexture, m_lightScatteringTextureID, m_shadowMapTextureID);
-                bSwapped = true;
+                RenderFusedRun();
             }
 
-            glBindVertexArray(m_postProcessVao);
-            glEnableVertexAttribArray(0);
-
-            glDrawArrays(GL_TRIANGLES, 0, 6);
-
-            glDisableVertexAttribArray(0);
-            glBindVertexArray(0);
+            m_fusedRun.push_back(pEffect);
+        }
+        else
+        {
+            RenderFusedRun();
+            RenderEffect(pEffect);
         }
     }
 
+    RenderFusedRun();
+
     // Render the texture on the physical frame buffer
     // Binding physical buffer
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glViewport(0, 0, 1600, 900);
+    glViewport(0, 0, outputWidth, outputHeight);
 
     // Clears the buffer
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    if(bSwapped)
+    if(m_bSwapped)
         m_stack[0]->ApplyEffect(m_postProcessTexture, m_postProcessDepthTexture, m_lightScatteringTextureID, m_shadowMapTextureID);
     else
         m_stack[0]->ApplyEffect(m_postProcessTextureBuffer, m_postProcessDepthTexture, m_lightScatteringTextureID, m_shadowMapTextureID);
@@ -238,6 +286,166 @@ void PostProcessingStack::OnPostProcessingRender()
     glDisableVertexAttribArray(0);
 }
 
+/// \brief Returns the texture the next pass reads from
+uint PostProcessingStack::GetPassSource() const
+{
+    return m_bSwapped ? m_postProcessTexture : m_postProcessTextureBuffer;
+}
+
+/// \brief Binds and attaches the next ping-pong target
+void PostProcessingStack::BeginPass()
+{
+    uint target = m_bSwapped ? m_postProcessTextureBuffer : m_postProcessTexture;
+
+    // The blur chain may have bound its own targets
+    glBindFramebuffer     (GL_FRAMEBUFFER, m_postProcessFboBuffer);
+    glViewport            (0, 0, m_width, m_height);
+    glFramebufferTexture2D(GL_FRAMEBUFFER , GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target, 0);
+
+    m_bSwapped = !m_bSwapped;
+    m_passCount++;
+}
+
+/// \brief Draws the full screen quad
+void PostProcessingStack::DrawQuad()
+{
+    glBindVertexArray(m_postProcessVao);
+    glEnableVertexAttribArray(0);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    glDisableVertexAttribArray(0);
+    glBindVertexArray(0);
+}
+
+/// \brief Renders a single effect in its own pass
+/// \param pEffect The effect to render
+void PostProcessingStack::RenderEffect(PostEffect * pEffect)
+{
+    uint source = GetPassSource();
+    pEffect->PrepareEffect(m_blurChain, source, m_lightScatteringTextureID);
+
+    BeginPass();
+    pEffect->ApplyEffect(source, m_postProcessDepthTexture, m_lightScatteringTextureID, m_shadowMapTextureID);
+    DrawQuad();
+}
+
+/// \brief Renders the pending run of fusible effects in one pass
+void PostProcessingStack::RenderFusedRun()
+{
+    if(m_fusedRun.empty())
+    {
+        return;
+    }
+
+    FusedProgram const* pProgram = nullptr;
+    if(m_fusedRun.size() > 1)
+    {
+        pProgram = GetFusedProgram();
+    }
+
+    // A single effect or a failed fusion falls back to the effect shaders
+    if(pProgram == nullptr)
+    {
+        for(PostEffect * pEffect : m_fusedRun)
+        {
+            RenderEffect(pEffect);
+        }
+
+        m_fusedRun.clear();
+        return;
+    }
+
+    uint source = GetPassSource();
+    BeginPass();
+
+    glUseProgram   (pProgram->m_program);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture  (GL_TEXTURE_2D, source);
+    glUniform1i    (pProgram->m_colorTextureID, 0);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture  (GL_TEXTURE_2D, m_postProcessDepthTexture);
+    glUniform1i    (pProgram->m_depthTextureID, 1);
+
+    size_t effectCount = m_fusedRun.size();
+    for(size_t nEffect = 0; nEffect < effectCount; ++nEffect)
+    {
+        m_fusedRun[nEffect]->SetFusedUniforms(pProgram->m_uniformIDs.data() + pProgram->m_effectOffsets[nEffect]);
+    }
+
+    DrawQuad();
+    m_fusedRun.clear();
+}
+
+/// \brief Returns the program of the pending run, compiling it if needed
+///        The uniform locations are queried once, when the program is ready
+/// \return The program or nullptr if it could not be built or is still building
+PostProcessingStack::FusedProgram const* PostProcessingStack::GetFusedProgram()
+{
+    std::string key = PostEffectFusion::GetKey(m_fusedRun);
+
+    auto it = m_fusedPrograms.find(key);
+    if(it == m_fusedPrograms.end())
+    {
+        Logger::LogInfo("Fusing post-effects : %s", key.c_str());
+
+        std::string fragmentShader = PostEffectFusion::GenerateFragmentShader(m_fusedRun);
+        uint program = (uint)ShaderCompiler::CompileShaders(
+                PostEffectFusion::GetVertexShader(), fragmentShader.c_str(), "FusedPostProcess", key.c_str());
+
+        FusedProgram fused;
+        fused.m_program        = program;
+        fused.m_bResolved      = false;
+        fused.m_colorTextureID = -1;
+        fused.m_depthTextureID = -1;
+
+        it = m_fusedPrograms.emplace(key, fused).first;
+    }
+
+    FusedProgram & fused   = it->second;
+    uint           program = fused.m_program;
+    if(program != 0 && ShaderCompiler::IsProgramPending(program))
+    {
+        // Separate passes are used while the driver builds the program
+        if(!ShaderCompiler::IsProgramReady(program))
+        {
+            return nullptr;
+        }
+
+        if(!ShaderCompiler::FinalizeProgram(program))
+        {
+            Logger::LogError("Cannot fuse post-effects %s, using separate passes", key.c_str());
+            glDeleteProgram(program);
+
+            // Failures are cached too to avoid recompiling every frame
+            fused.m_program = 0;
+            program         = 0;
+        }
+    }
+
+    if(program == 0)
+    {
+        return nullptr;
+    }
+
+    // The run of a key is always the same, the locations are resolved once
+    if(!fused.m_bResolved)
+    {
+        fused.m_colorTextureID = glGetUniformLocation(program, "colorTexture");
+        fused.m_depthTextureID = glGetUniformLocation(program, "depthTexture");
+
+        for(PostEffect const* pEffect : m_fusedRun)
+        {
+            fused.m_effectOffsets.push_back(fused.m_uniformIDs.size());
+            pEffect->GetFusedUniformIDs(program, fused.m_uniformIDs);
+        }
+
+        fused.m_bResolved = true;
+    }
+
+    return &fused;
+}
+
 /// \brief Called at the end of the frame
 void PostProcessingStack::OnPostProcessingEnd()
 {
@@ -309,4 +517,11 @@ int PostProcessingStack::GetActivePostProcessShaders() const
     return sum;
 }
 
+/// \brief Returns the count of full screen passes of the last frame
+/// \return The count of passes
+int PostProcessingStack::GetPassCount() const
+{
+    return m_passCount + m_blurChain.GetPassCount();
+}
+
 } // !namespace
@@ -21,6 +21,7 @@
 /// \package    Runtime/Rendering/Renderer
 /// \author     Vincent STEHLY--CALISTO
 
+#include "Glew/include/GL/glew.h"
 #include "Runtime/Rendering/Renderer/IRenderer.hpp"
 
 /// \namespace cardinal
@@ -35,6 +36,7 @@ IRenderer::IRenderer()
 {
     m_model          = glm::mat4(1.0f);
     m_isIndexed      = true;
+    m_indexType      = GL_UNSIGNED_SHORT;
     m_isInstantiated = false;
 }
 
@@ -50,4 +52,11 @@ int IRenderer::GetElementCount() const
     return m_elementsCount;
 }
 
+/// \brief  Returns the world space bounds of the renderer
+/// \return The bounds, empty if the renderer can't be culled
+BoundingBox IRenderer::GetBounds() const
+{
+    return m_bounds.Transform(m_model);
+}
+
 } // !namespace
\ No newline at end of file
@@ -21,11 +21,16 @@
 /// \package    Rendering/Renderer
 /// \author     Vincent STEHLY--CALISTO
 
+#include <cstring>
+#include <algorithm>
+
 #include "Glew/include/GL/glew.h"
 #include "ImGUI/Header/ImGUI/imgui.h"
 
 #include "Runtime/Rendering/Renderer/LineRenderer.hpp"
 #include "Runtime/Rendering/Texture/TextureManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
+#include "Runtime/Rendering/Buffer/GLRingBufferStorage.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -34,18 +39,17 @@ namespace cardinal
 /// \brief Default constructor
 LineRenderer::LineRenderer() : IRenderer()
 {
-    m_verticesObject = 0;
     m_elementsCount  = 0;
-    m_maxElement     = 1048576;
+    m_bDirty         = false;
 
     inspectorName = "Line Renderer";
 
     glGenVertexArrays(1, &m_vao);
     glBindVertexArray(m_vao);
 
-    glGenBuffers(1, &m_verticesObject);
-    glBindBuffer(GL_ARRAY_BUFFER, m_verticesObject);
-    glBufferData(GL_ARRAY_BUFFER, m_maxElement * sizeof(glm::vec3), nullptr, GL_STREAM_DRAW);
+    // Grows with the lines, see UpdateBuffer
+    m_verticesRing.Initialize(new GLRingBufferStorage(GL_ARRAY_BUFFER), 4096 * sizeof(glm::vec3));
+    glBindBuffer(GL_ARRAY_BUFFER, m_verticesRing.GetBufferID());
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
 
     glEnableVertexAttribArray(0);
@@ -58,7 +62,7 @@ LineRenderer::LineRenderer() : IRenderer()
 /// \brief Destructor
 LineRenderer::~LineRenderer() // NOLINT
 {
-    // TODO
+    m_verticesRing.Release();
 }
 
 /// \brief Sets the renderer shader
@@ -88,6 +92,7 @@ void LineRenderer::Clear()
 {
     m_lines.clear();
     m_elementsCount = 0;
+    m_bDirty        = true;
 }
 
 /// \brief Adds a line to the renderer
@@ -98,14 +103,32 @@ void LineRenderer::AddLine(glm::vec3 const &start, glm::vec3 const &end)
     m_lines.push_back(start);
     m_lines.push_back(end);
     m_elementsCount += 2;
+    m_bDirty         = true;
+}
 
-    // Quick buffer updates
-    glBindVertexArray(m_vao);
+/// \brief Streams the lines in the next region of the ring
+void LineRenderer::UpdateBuffer()
+{
+    const size_t size = m_lines.size() * sizeof(glm::vec3);
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_verticesObject);
-    glBufferSubData(GL_ARRAY_BUFFER, (m_elementsCount - 2) * sizeof(glm::vec3), 2 * sizeof(glm::vec3), &m_lines[m_elementsCount - 2]);
+    // Grows geometrically, the ring waits for the GPU before reallocating
+    if (size > m_verticesRing.GetRegionSize())
+    {
+        m_verticesRing.Reserve(std::max(size, m_verticesRing.GetRegionSize() * 2));
+    }
 
-    glBindVertexArray(0);
+    memcpy(m_verticesRing.Map(size), m_lines.data(), size);
+    m_verticesRing.Unmap();
+
+    // Called while drawing, the bind must go through the state cache
+    StateCache::BindVertexArray(m_vao);
+
+    glBindBuffer         (GL_ARRAY_BUFFER, m_verticesRing.GetBufferID());
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void *)m_verticesRing.GetOffset());
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_bDirty = false;
 }
 
 /// \brief Base method implementation
@@ -118,9 +141,15 @@ void LineRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 const&
         return;
     }
 
+    // A single upload per frame, whatever the amount of lines added
+    if (m_bDirty)
+    {
+        UpdateBuffer();
+    }
+
     m_pShader->Begin(P * V * m_model, P, V, m_model, light, pointLights);
 
-    glBindVertexArray(m_vao);
+    StateCache::BindVertexArray(m_vao);
     glEnableVertexAttribArray(0);
 
     glDrawArrays(GL_LINES, 0, m_elementsCount);
@@ -149,13 +178,7 @@ void LineRenderer::OnInspectorGUI()
             std::string id = "Vertex " + std::to_string(i) + "###LineRenderer_Input" + std::to_string(i);
             if(ImGui::InputFloat3(id.c_str(), &m_lines[i][0]))
             {
-                // Quick buffer updates
-                glBindVertexArray(m_vao);
-
-                glBindBuffer   (GL_ARRAY_BUFFER, m_verticesObject);
-                glBufferSubData(GL_ARRAY_BUFFER, i * sizeof(glm::vec3), sizeof(glm::vec3), &m_lines[i]);
-
-                glBindVertexArray(0);
+                m_bDirty = true;
             }
         }
 
@@ -175,11 +198,13 @@ void LineRenderer::OnInspectorGUI()
 
                 // Updating
                 m_elementsCount -= 2;
+                m_bDirty         = true;
             }
         }
 
         ImGui::TextDisabled("\nVao : %u", m_vao);
-        ImGui::TextDisabled("Vertex buffer ID  : %u", m_verticesObject);
+        ImGui::TextDisabled("Vertex buffer ID  : %u", m_verticesRing.GetBufferID());
+        ImGui::TextDisabled("Ring waits        : %llu", m_verticesRing.GetWaitCount());
     }
 
     m_pShader->OnInspectorGUI();
@@ -26,6 +26,7 @@
 
 #include "Runtime/Rendering/Renderer/MeshRenderer.hpp"
 #include "Runtime/Rendering/Texture/TextureManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -59,6 +60,33 @@ void MeshRenderer::Initialize(
         std::vector<glm::vec3>      const &vertices,
         std::vector<glm::vec3>      const &normals,
         std::vector<glm::vec2>      const &uvs)
+{
+    InitializeBuffers(&indexes[0], indexes.size(), GL_UNSIGNED_SHORT, vertices, normals, uvs);
+}
+
+/// \brief Initializes the mesh with 32 bits indexes
+/// \param indexes The indexes of the mesh
+/// \param vertices The vertices of the mesh
+/// \param normals The normals of the mesh
+/// \param colors The uvs of the mesh
+void MeshRenderer::Initialize(
+        std::vector<unsigned int>   const &indexes,
+        std::vector<glm::vec3>      const &vertices,
+        std::vector<glm::vec3>      const &normals,
+        std::vector<glm::vec2>      const &uvs)
+{
+    InitializeBuffers(&indexes[0], indexes.size(), GL_UNSIGNED_INT, vertices, normals, uvs);
+}
+
+/// \brief Creates the buffers of the mesh
+/// \param pIndexes The indexes of the mesh
+/// \param indexCount The number of indexes
+/// \param indexType The GL type of the indexes
+void MeshRenderer::InitializeBuffers(
+        void const * pIndexes, size_t indexCount, uint indexType,
+        std::vector<glm::vec3> const &vertices,
+        std::vector<glm::vec3> const &normals,
+        std::vector<glm::vec2> const &uvs)
 {
     if (m_vao != 0)
     {
@@ -82,7 +110,7 @@ void MeshRenderer::Initialize(
 
     glGenBuffers(1, &m_indexesObject);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexesObject);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexes.size() * sizeof(unsigned short), &indexes[0], GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * (indexType == GL_UNSIGNED_INT ? sizeof(unsigned int) : sizeof(unsigned short)), pIndexes, GL_STATIC_DRAW);
 
     glGenBuffers(1, &m_verticesObject);
     glBindBuffer(GL_ARRAY_BUFFER, m_verticesObject);
@@ -102,7 +130,11 @@ void MeshRenderer::Initialize(
     glEnableVertexAttribArray(0);
     glBindVertexArray(0);
 
-    m_elementsCount = static_cast<GLsizei>(indexes.size());
+    m_indexType     = indexType;
+    m_elementsCount = static_cast<GLsizei>(indexCount);
+
+    m_bounds.Reset();
+    m_bounds.Enclose(vertices);
 }
 
 /// \brief Updates the mesh
@@ -122,7 +154,7 @@ void MeshRenderer::Update(
         return;
     }
 
-    if (m_elementsCount < indexes.size())
+    if (m_elementsCount < indexes.size() || m_indexType != GL_UNSIGNED_SHORT)
     {
         // The buffer is too small, we need to
         // recreates buffers
@@ -146,9 +178,35 @@ void MeshRenderer::Update(
 
     m_elementsCount = static_cast<GLsizei>(indexes.size());
 
+    m_bounds.Reset();
+    m_bounds.Enclose(vertices);
+
     glBindVertexArray(0);
 }
 
+/// \brief Releases the buffers of the mesh, nothing is drawn
+///        until the next initialization
+void MeshRenderer::Clear()
+{
+    if (m_vao == 0)
+    {
+        return;
+    }
+
+    glDeleteBuffers(1, &m_indexesObject);
+    glDeleteBuffers(1, &m_verticesObject);
+    glDeleteBuffers(1, &m_normalsObject);
+    glDeleteBuffers(1, &m_uvsObject);
+
+    m_indexesObject  = 0;
+    m_verticesObject = 0;
+    m_normalsObject  = 0;
+    m_uvsObject      = 0;
+    m_elementsCount  = 0;
+
+    m_bounds.Reset();
+}
+
 /// \brief Sets the renderer shader
 /// \param pShader The pointer on the shader
 void MeshRenderer::SetShader(IShader * pShader)
@@ -177,12 +235,12 @@ void MeshRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 const&
 {
     m_pShader->Begin(P * V * m_model, P, V, m_model, light, pointLights);
 
-    glBindVertexArray(m_vao);
+    StateCache::BindVertexArray(m_vao);
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
     glEnableVertexAttribArray(2);
 
-    glDrawElements(GL_TRIANGLES, m_elementsCount, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, m_elementsCount, m_indexType, nullptr);
 
     m_pShader->End();
 }
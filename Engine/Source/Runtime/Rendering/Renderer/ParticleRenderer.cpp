@@ -21,9 +21,13 @@
 /// \package    Rendering/Renderer
 /// \author     Vincent STEHLY--CALISTO
 
+#include <cstring>
+
 #include "Glew/include/GL/glew.h"
 #include "ImGUI/Header/ImGUI/imgui.h"
 #include "Runtime/Rendering/Renderer/ParticleRenderer.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
+#include "Runtime/Rendering/Buffer/GLRingBufferStorage.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -33,8 +37,6 @@ namespace cardinal
 ParticleRenderer::ParticleRenderer() : IRenderer()
 {
     m_billboardVertexBuffer   = 0;
-    m_billboardPositionBuffer = 0;
-    m_billboardColorBuffer    = 0;
     m_elementsCount           = 0;
     m_maxParticleAmount       = 0;
 
@@ -50,6 +52,9 @@ ParticleRenderer::ParticleRenderer() : IRenderer()
 /// \brief Destructor
 ParticleRenderer::~ParticleRenderer() // NOLINT
 {
+    m_billboardPositionRing.Release();
+    m_billboardColorRing.Release();
+
     delete[] billboardColorBuffer;
     delete[] billboardPositionBuffer;
 }
@@ -80,17 +85,14 @@ void ParticleRenderer::Initialize(int maxParticleAmount)
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
     glVertexAttribDivisor(0, 0);
 
-    m_billboardPositionBuffer = 0;
-    glGenBuffers(1, &m_billboardPositionBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, m_billboardPositionBuffer);
-    glBufferData(GL_ARRAY_BUFFER, maxParticleAmount * 4 * sizeof(GLfloat), nullptr, GL_STREAM_DRAW);
+    // Streamed every frame, the pointers are set by UpdateBuffer
+    m_billboardPositionRing.Initialize(new GLRingBufferStorage(GL_ARRAY_BUFFER), maxParticleAmount * 4 * sizeof(GLfloat));
+    glBindBuffer(GL_ARRAY_BUFFER, m_billboardPositionRing.GetBufferID());
     glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE,0, (void*)0);
     glVertexAttribDivisor(1, 1);
 
-    m_billboardColorBuffer = 0;
-    glGenBuffers(1, &m_billboardColorBuffer);
-    glBindBuffer(GL_ARRAY_BUFFER, m_billboardColorBuffer);
-    glBufferData(GL_ARRAY_BUFFER, maxParticleAmount * sizeof(glm::vec3), nullptr, GL_STREAM_DRAW);
+    m_billboardColorRing.Initialize(new GLRingBufferStorage(GL_ARRAY_BUFFER), maxParticleAmount * sizeof(glm::vec3));
+    glBindBuffer(GL_ARRAY_BUFFER, m_billboardColorRing.GetBufferID());
     glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
     glVertexAttribDivisor(2, 1);
 
@@ -117,7 +119,7 @@ void ParticleRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 co
 {
     m_pShader->Begin(P * V * m_model, P, V, m_model, light, pointLights);
 
-    glBindVertexArray(m_vao);
+    StateCache::BindVertexArray(m_vao);
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
     glEnableVertexAttribArray(2);
@@ -127,19 +129,29 @@ void ParticleRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 co
     m_pShader->End();
 }
 
-/// \brief Updates positions and color buffers
+/// \brief Streams positions and colors in the next region of the rings
+///        No reallocation, the region written was released by the GPU
 void ParticleRenderer::UpdateBuffer()
 {
+    const size_t positionSize = m_elementsCount * sizeof(GLfloat) * 4;
+    const size_t colorSize    = m_elementsCount * sizeof(glm::vec3);
+
+    memcpy(m_billboardPositionRing.Map(positionSize), billboardPositionBuffer, positionSize);
+    m_billboardPositionRing.Unmap();
+
+    memcpy(m_billboardColorRing.Map(colorSize), billboardColorBuffer, colorSize);
+    m_billboardColorRing.Unmap();
+
+    // The instances start at the current regions
     glBindVertexArray(m_vao);
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_billboardPositionBuffer);
-    glBufferData   (GL_ARRAY_BUFFER, m_maxParticleAmount * 4 * sizeof(GLfloat), nullptr, GL_STREAM_DRAW);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, m_elementsCount * sizeof(GLfloat) * 4, billboardPositionBuffer);
+    glBindBuffer         (GL_ARRAY_BUFFER, m_billboardPositionRing.GetBufferID());
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, (void *)m_billboardPositionRing.GetOffset());
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_billboardColorBuffer);
-    glBufferData   (GL_ARRAY_BUFFER, m_maxParticleAmount * sizeof(glm::vec3), nullptr, GL_STREAM_DRAW);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, m_elementsCount * sizeof(glm::vec3), billboardColorBuffer);
+    glBindBuffer         (GL_ARRAY_BUFFER, m_billboardColorRing.GetBufferID());
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, (void *)m_billboardColorRing.GetOffset());
 
+    glBindBuffer     (GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 }
 
@@ -150,8 +162,9 @@ void ParticleRenderer::OnInspectorGUI()
     {
         ImGui::TextDisabled("Vao : %u", m_vao);
         ImGui::TextDisabled("Vertex buffer     : %u", m_billboardVertexBuffer);
-        ImGui::TextDisabled("Position buffer   : %u", m_billboardPositionBuffer);
-        ImGui::TextDisabled("Color buffer      : %u", m_billboardColorBuffer);
+        ImGui::TextDisabled("Position buffer   : %u", m_billboardPositionRing.GetBufferID());
+        ImGui::TextDisabled("Color buffer      : %u", m_billboardColorRing.GetBufferID());
+        ImGui::TextDisabled("Ring waits        : %llu", m_billboardPositionRing.GetWaitCount() + m_billboardColorRing.GetWaitCount());
         ImGui::TextDisabled("Max particle      : %u", m_maxParticleAmount);
         ImGui::TextDisabled("Currently batched : %u", m_elementsCount);
     }
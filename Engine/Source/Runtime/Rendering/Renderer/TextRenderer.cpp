@@ -26,6 +26,7 @@
 
 #include "Runtime/Rendering/Renderer/TextRenderer.hpp"
 #include "Runtime/Rendering/Texture/TextureManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Text/TextShader.hpp"
 
 /// \namespace cardinal
@@ -158,7 +159,7 @@ void TextRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 const&
 {
     m_pShader->Begin(P * V * glm::mat4(1.0f), P, V, glm::mat4(1.0f), light, pointLights);
 
-    glBindVertexArray(m_vao);
+    StateCache::BindVertexArray(m_vao);
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
 
@@ -52,6 +52,8 @@
 #include "Runtime/Rendering/Texture/TextureManager.hpp"
 #include "Runtime/Rendering/Particle/ParticleSystem.hpp"
 #include "Runtime/Rendering/Lighting/LightManager.hpp"
+#include "Runtime/Rendering/Optimization/Frustum.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Lighting/Lights/PointLight.hpp"
 #include "Runtime/Rendering/Lighting/Lights/DirectionalLight.hpp"
 
@@ -180,6 +182,14 @@ bool RenderingEngine::Initialize(int width, int height, const char *szTitle,
             "Resources/Shaders/Utils/LightScatteringVertexShader.glsl",
             "Resources/Shaders/Utils/LightScatteringFragmentShader.glsl"));
 
+    ShaderManager::Register("BlurDownsamplePostProcess", ShaderCompiler::LoadShaders(
+            "Resources/Shaders/PostProcessing/BlurDownsampleVertexShader.glsl",
+            "Resources/Shaders/PostProcessing/BlurDownsampleFragmentShader.glsl"));
+
+    ShaderManager::Register("BlurSeparablePostProcess", ShaderCompiler::LoadShaders(
+            "Resources/Shaders/PostProcessing/BlurSeparableVertexShader.glsl",
+            "Resources/Shaders/PostProcessing/BlurSeparableFragmentShader.glsl"));
+
     ShaderManager::Register("BloomPostProcess", ShaderCompiler::LoadShaders(
             "Resources/Shaders/PostProcessing/BloomVertexShader.glsl",
             "Resources/Shaders/PostProcessing/BloomFragmentShader.glsl"));
@@ -240,9 +250,14 @@ bool RenderingEngine::Initialize(int width, int height, const char *szTitle,
     m_clearColor = glm::vec3(0.51f, 0.56, 0.60f);
     glClearColor(m_clearColor.x, m_clearColor.y, m_clearColor.z, 1.0f);
 
+    // The render targets follow the frame buffer of the window
+    m_window.GetFramebufferSize(m_windowWidth, m_windowHeight);
+    m_targetWidth  = m_windowWidth;
+    m_targetHeight = m_windowHeight;
+
     // TODO : Removes magic values
-    m_projectionMatrix = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 2000.0f);
-    // m_projectionMatrix = glm::ortho(0.0f, 1600.0f, 0.0f, 900.0f, -0.1f, 1000.0f);
+    m_projectionMatrix = glm::perspective(glm::radians(45.0f),
+            static_cast<float>(m_windowWidth) / static_cast<float>(m_windowHeight), 0.1f, 2000.0f);
 
     m_frameDelta   = 1.0 / fps;
     m_frameTime    = 0.0;
@@ -259,11 +274,20 @@ bool RenderingEngine::Initialize(int width, int height, const char *szTitle,
     m_triangleCounter = 0;
     m_triangleSecond  = 0;
     m_currentTriangle = 0;
+    m_culledRenderers     = 0;
+    m_culledShadowCasters = 0;
     m_bIsPostProcessingEnabled = false;
     m_bStereoscopicRendering   = false;
+    m_bClusteredLighting       = false;
+    m_bDynamicResolution       = false;
+    m_gpuFrameTime             = 0.0f;
     m_pHMD                     = nullptr;
 
-    m_postProcessingStack.Initialize();
+    m_postProcessingStack.Initialize(m_targetWidth, m_targetHeight);
+    m_gpuTimer.Initialize();
+
+    // One thread per hardware thread to update the particles and the world
+    m_workerPool.Initialize(0);
 
     // Initializing light scattering frame buffer
     glGenFramebuffers(1, &m_lightScatteringFbo);
@@ -271,9 +295,9 @@ bool RenderingEngine::Initialize(int width, int height, const char *szTitle,
 
     glGenTextures  (1, &m_lightScatteringTexture);
     glBindTexture  (GL_TEXTURE_2D, m_lightScatteringTexture);
-    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, 1600, 900, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D   (GL_TEXTURE_2D, 0, GL_RGB, m_targetWidth, m_targetHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 
     glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, m_lightScatteringTexture, 0);
 
@@ -287,31 +311,17 @@ bool RenderingEngine::Initialize(int width, int height, const char *szTitle,
     // Shadow mapping
     m_shadowMapFbo = 0;
     glGenFramebuffers(1, &m_shadowMapFbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowMapFbo);
 
-    // Depth texture
-    m_shadowMapTexture = 0;
-    glGenTextures  (1, &m_shadowMapTexture);
-    glBindTexture  (GL_TEXTURE_2D, m_shadowMapTexture);
-    glTexImage2D   (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, 1024, 1024, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_shadowMapTexture, 0);
-    glDrawBuffer(GL_NONE);
-    glReadBuffer(GL_NONE);
+    for (int nCascade = 0; nCascade < ShadowCascades::s_maxCascades; ++nCascade)
+    {
+        m_shadowMapTextures[nCascade] = 0;
+    }
 
-    if(glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    if(!CreateShadowMaps())
     {
-        Logger::LogError("Unable to create the shadow maps");
         return false;
     }
 
-    // Re-bind physical buffer
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
     // Initializes ImGUI
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO(); (void)io;
@@ -593,10 +603,34 @@ void RenderingEngine::RenderFrame(float step)
     m_pPluginManager->OnGUI();
     m_postProcessingStack.OnGUI();
 
+    // Measures the GPU time of the frame, the scale is applied from the next frame
+    float gpuFrameTime = 0.0f;
+    if(m_gpuTimer.Read(gpuFrameTime))
+    {
+        m_gpuFrameTime = gpuFrameTime;
+        if(m_bDynamicResolution)
+        {
+            m_dynamicResolution.Update(gpuFrameTime);
+        }
+    }
+
+    UpdateResolution();
+    m_gpuTimer.Begin();
+
+    // Offscreen rendering, required by the post-processing and the dynamic resolution
+    bool bOffscreen = m_bIsPostProcessingEnabled || (m_bDynamicResolution && !m_bStereoscopicRendering);
+
     // Gets the projection matrix
     glm::mat4 Projection     = m_projectionMatrix;
     glm::mat4 View           = m_pCamera->GetViewMatrix();
     glm::mat4 ProjectionView = Projection * View;
+    Frustum   viewFrustum(ProjectionView);
+
+    // Per frame culling statistics
+    m_culledRenderers     = 0;
+    m_culledShadowCasters = 0;
+    IShader::ResetAvoidedUniformCount();
+    StateCache::ResetAvoidedBindCount();
 
     DirectionalLight * pLight                = LightManager::GetDirectionalLight();
     std::vector<PointLight *> const& pLights = LightManager::GetPointLights();
@@ -604,47 +638,7 @@ void RenderingEngine::RenderFrame(float step)
     // Shadow mapping
     if(pLight != nullptr)
     {
-        glm::mat4 depthProjectionMatrix  = glm::ortho(-100.0f, 100.0f, -100.0f, 100.0f, 0.1f, 5000.0f);
-        glm::mat4 depthViewMatrix        = glm::lookAt(-pLight->GetDirection(), glm::vec3(0,0,0), glm::vec3(0, 0, 1));
-        glm::mat4 depthModelMatrix       = glm::mat4(1.0);
-        glm::mat4 depthMVP               = depthProjectionMatrix * depthViewMatrix * depthModelMatrix;
-
-        uint shadowMapShader = (uint)ShaderManager::GetShaderID("ShadowMap");
-        int  shadowMVPID     = glGetUniformLocation(shadowMapShader, "depthMVP");
-
-        // Shader start
-        glUseProgram(shadowMapShader);
-        glUniformMatrix4fv(shadowMVPID, 1, GL_FALSE, &depthMVP[0][0]);
-
-        // FBO start
-        glBindFramebuffer(GL_FRAMEBUFFER, m_shadowMapFbo);
-        glViewport(0, 0, 1024, 1024);
-        glClear(GL_DEPTH_BUFFER_BIT);
-
-        size_t rendererCount = m_renderers.size();
-        for (int nRenderer = 0; nRenderer < rendererCount; ++nRenderer)
-        {
-            m_triangleCounter += m_renderers[nRenderer]->GetElementCount();
-            m_currentTriangle += m_renderers[nRenderer]->GetElementCount();
-
-            glBindVertexArray(m_renderers[nRenderer]->m_vao);
-            glEnableVertexAttribArray(0);
-
-            if(m_renderers[nRenderer]->m_isInstantiated)
-                glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, m_renderers[nRenderer]->m_elementsCount);
-            else if(m_renderers[nRenderer]->m_isIndexed)
-                glDrawElements(GL_TRIANGLES, m_renderers[nRenderer]->m_elementsCount, GL_UNSIGNED_SHORT, nullptr);
-            else
-                glDrawArrays(GL_TRIANGLES, 0, m_renderers[nRenderer]->m_elementsCount);
-
-            glBindVertexArray(0);
-        }
-
-        // FBO end
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-        // Shader end
-        glUseProgram(0);
+        RenderShadowMaps(Projection, View, pLight->GetDirection());
     }
 
     // Post-processing begin
@@ -663,7 +657,7 @@ void RenderingEngine::RenderFrame(float step)
         glClear(GL_COLOR_BUFFER_BIT);
         glClearColor(m_clearColor.x, m_clearColor.y, m_clearColor.z, 1.0f);
 
-        glViewport(0, 0, 1600, 900);
+        glViewport(0, 0, m_targetWidth, m_targetHeight);
 
         // Light scattering pass
         if(pLight != nullptr)
@@ -687,6 +681,11 @@ void RenderingEngine::RenderFrame(float step)
         size_t rendererCount = m_renderers.size();
         for (int nRenderer = 0; nRenderer < rendererCount; ++nRenderer)
         {
+            if (!viewFrustum.IsVisible(m_renderers[nRenderer]->GetBounds()))
+            {
+                continue;
+            }
+
             m_triangleCounter += m_renderers[nRenderer]->GetElementCount();
             m_currentTriangle += m_renderers[nRenderer]->GetElementCount();
 
@@ -700,7 +699,7 @@ void RenderingEngine::RenderFrame(float step)
             if(m_renderers[nRenderer]->m_isInstantiated)
                 glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, m_renderers[nRenderer]->m_elementsCount);
             else if(m_renderers[nRenderer]->m_isIndexed)
-                glDrawElements(GL_TRIANGLES, m_renderers[nRenderer]->m_elementsCount, GL_UNSIGNED_SHORT, nullptr);
+                glDrawElements(GL_TRIANGLES, m_renderers[nRenderer]->m_elementsCount, m_renderers[nRenderer]->m_indexType, nullptr);
             else
                 glDrawArrays(GL_TRIANGLES, 0, m_renderers[nRenderer]->m_elementsCount);
 
@@ -709,20 +708,26 @@ void RenderingEngine::RenderFrame(float step)
 
         // Light scattering pass end
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
 
-        m_postProcessingStack.OnPostProcessingBegin(m_lightScatteringTexture, m_shadowMapTexture);
+    if(bOffscreen)
+    {
+        m_postProcessingStack.OnPostProcessingBegin(m_lightScatteringTexture, m_shadowMapTextures[0]);
     }
     else
     {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glViewport(0, 0, 1600, 900);
+        glViewport(0, 0, m_windowWidth, m_windowHeight);
     }
 
     // Clearing buffer
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // Lighting
-    LightManager::OnRenderBegin();
+    // The clusters are built for the main camera only
+    int viewportWidth  = bOffscreen ? m_targetWidth  : m_windowWidth;
+    int viewportHeight = bOffscreen ? m_targetHeight : m_windowHeight;
+    LightManager::OnRenderBegin(Projection, View, viewportWidth, viewportHeight, m_bClusteredLighting && !m_bStereoscopicRendering);
 
     if(m_bStereoscopicRendering)
     {
@@ -735,7 +740,7 @@ void RenderingEngine::RenderFrame(float step)
         // vr::VRCompositor()->ShowMirrorWindow(); (No need anymore)
 
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glViewport(0, 0, 1600, 900);
+        glViewport(0, 0, m_windowWidth, m_windowHeight);
 
         // Clears the buffer
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -765,13 +770,7 @@ void RenderingEngine::RenderFrame(float step)
     else
     {
         // Draw
-        size_t rendererCount = m_renderers.size();
-        for (int nRenderer = 0; nRenderer < rendererCount; ++nRenderer)
-        {
-            m_triangleCounter += m_renderers[nRenderer]->GetElementCount();
-            m_currentTriangle += m_renderers[nRenderer]->GetElementCount();
-            m_renderers[nRenderer]->Draw(Projection, View, glm::vec3(0.0f, 0.0f, 0.0f), LightManager::GetNearestPointLights(m_renderers[nRenderer]->GetPosition()));
-        }
+        DrawRenderers(Projection, View, viewFrustum);
     }
 
     // Cleanup
@@ -783,12 +782,14 @@ void RenderingEngine::RenderFrame(float step)
     DebugManager::Draw(ProjectionView);
 #endif
 
-    if(m_bIsPostProcessingEnabled)
+    if(bOffscreen)
     {
-        m_postProcessingStack.OnPostProcessingRender();
+        m_postProcessingStack.OnPostProcessingRender(m_windowWidth, m_windowHeight, m_bIsPostProcessingEnabled);
         m_postProcessingStack.OnPostProcessingEnd();
     }
 
+    m_gpuTimer.End();
+
     DisplayDebugWindow(step);
     m_currentTriangle = 0;
 
@@ -903,18 +904,235 @@ void RenderingEngine::RenderScene(vr::Hmd_Eye nEye)
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glEnable(GL_DEPTH_TEST);
 
+    // The eye matrices are the same for all renderers
+    glm::mat4 hmdProjectionMatrix = GetHMDMatrixProjectionEye(nEye);
+    glm::mat4 hmdViewMatrix       = GetHMDMatrixPoseEye(nEye) * glm::translate(m_mat4HMDPose, glm::vec3(-200.0f, -300.0f, 200.0f));
+    hmdViewMatrix                 = glm::rotate(hmdViewMatrix, -(float)M_PI_2,   glm::vec3(1.0f, 0.0f, 0.0f));
+    Frustum eyeFrustum(hmdProjectionMatrix * hmdViewMatrix);
+
     // Draw
+    DrawRenderers(hmdProjectionMatrix, hmdViewMatrix, eyeFrustum);
+}
+
+/// \brief Draws the visible renderers sorted by states
+/// \param P The projection matrix
+/// \param V The view matrix
+/// \param frustum The view volume of the pass
+void RenderingEngine::DrawRenderers(glm::mat4 const& P, glm::mat4 const& V, Frustum const& frustum)
+{
+    m_renderQueue.Clear();
+
     size_t rendererCount = m_renderers.size();
     for (int nRenderer = 0; nRenderer < rendererCount; ++nRenderer)
     {
-        m_triangleCounter += m_renderers[nRenderer]->GetElementCount();
-        m_currentTriangle += m_renderers[nRenderer]->GetElementCount();
+        IRenderer * pRenderer = m_renderers[nRenderer];
+        if (!frustum.IsVisible(pRenderer->GetBounds()))
+        {
+            ++m_culledRenderers;
+            continue;
+        }
+
+        const IShader * pShader = pRenderer->m_pShader;
+        const uint      program = pShader ? static_cast<uint>(pShader->m_shaderID) : 0;
+        const uint      texture = pShader ? pShader->GetTexture() : 0;
+        const float     depth   = -(V * glm::vec4(pRenderer->GetPosition(), 1.0f)).z;
+
+        m_renderQueue.Submit(RenderQueue::MakeKey(program, texture, pRenderer->m_vao, depth), pRenderer);
+    }
+
+    m_renderQueue.Sort();
+
+    // Only the draws of the queue go through the cache, the binds outside are unknown
+    StateCache::Invalidate();
+
+    for (RenderQueue::Item const& item : m_renderQueue.GetItems())
+    {
+        m_triangleCounter += item.pRenderer->GetElementCount();
+        m_currentTriangle += item.pRenderer->GetElementCount();
+        item.pRenderer->Draw(P, V, glm::vec3(0.0f, 0.0f, 0.0f), FindNearestPointLights(item.pRenderer->GetPosition()));
+    }
+
+    StateCache::Invalidate();
+}
+
+/// \brief Follows the window size and the dynamic resolution scale
+void RenderingEngine::UpdateResolution()
+{
+    int width  = 0;
+    int height = 0;
+    m_window.GetFramebufferSize(width, height);
+
+    // Minimized, keeps the last targets
+    if(width <= 0 || height <= 0)
+    {
+        return;
+    }
+
+    if(width != m_windowWidth || height != m_windowHeight)
+    {
+        m_windowWidth  = width;
+        m_windowHeight = height;
+
+        m_projectionMatrix = glm::perspective(glm::radians(45.0f),
+                static_cast<float>(width) / static_cast<float>(height), 0.1f, 2000.0f);
+    }
+
+    float scale = m_bDynamicResolution ? m_dynamicResolution.GetScale() : 1.0f;
+    int targetWidth  = DynamicResolution::ComputeRenderSize(m_windowWidth,  scale);
+    int targetHeight = DynamicResolution::ComputeRenderSize(m_windowHeight, scale);
+
+    if(targetWidth != m_targetWidth || targetHeight != m_targetHeight)
+    {
+        ResizeRenderTargets(targetWidth, targetHeight);
+    }
+}
+
+/// \brief Resizes the offscreen render targets
+/// \param width The new width
+/// \param height The new height
+void RenderingEngine::ResizeRenderTargets(int width, int height)
+{
+    m_targetWidth  = width;
+    m_targetHeight = height;
+
+    glBindTexture(GL_TEXTURE_2D, m_lightScatteringTexture);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    m_postProcessingStack.Resize(width, height);
+}
+
+/// \brief  Creates a depth map per shadow cascade
+/// \return False if the maps can't be attached
+bool RenderingEngine::CreateShadowMaps()
+{
+    const int resolution = m_shadowCascades.GetResolution();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowMapFbo);
+
+    for (int nCascade = 0; nCascade < m_shadowCascades.GetCascadeCount(); ++nCascade)
+    {
+        glGenTextures  (1, &m_shadowMapTextures[nCascade]);
+        glBindTexture  (GL_TEXTURE_2D, m_shadowMapTextures[nCascade]);
+        glTexImage2D   (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, resolution, resolution, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // The maps are attached in turn to the same FBO
+    glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_shadowMapTextures[0], 0);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+
+    const bool bComplete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    // Re-bind physical buffer
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if(!bComplete)
+    {
+        Logger::LogError("Unable to create the shadow maps");
+        return false;
+    }
+
+    Logger::LogInfo("Shadow maps created : %d cascades of %dx%d", m_shadowCascades.GetCascadeCount(), resolution, resolution);
+    return true;
+}
+
+/// \brief Deletes the depth maps of the shadow cascades
+void RenderingEngine::ReleaseShadowMaps()
+{
+    for (int nCascade = 0; nCascade < ShadowCascades::s_maxCascades; ++nCascade)
+    {
+        if (m_shadowMapTextures[nCascade] != 0)
+        {
+            glDeleteTextures(1, &m_shadowMapTextures[nCascade]);
+            m_shadowMapTextures[nCascade] = 0;
+        }
+    }
+}
+
+/// \brief Renders the casters of each shadow cascade in its map
+/// \param P The projection matrix of the camera
+/// \param V The view matrix of the camera
+/// \param lightDirection The direction of the directional light
+void RenderingEngine::RenderShadowMaps(glm::mat4 const& P, glm::mat4 const& V, glm::vec3 const& lightDirection)
+{
+    m_shadowCascades.Update(P, V, lightDirection);
+
+    uint shadowMapShader = (uint)ShaderManager::GetShaderID("ShadowMap");
+    int  shadowMVPID     = glGetUniformLocation(shadowMapShader, "depthMVP");
+
+    // Shader start
+    glUseProgram(shadowMapShader);
+
+    // FBO start
+    const int resolution = m_shadowCascades.GetResolution();
+    glBindFramebuffer(GL_FRAMEBUFFER, m_shadowMapFbo);
+    glViewport(0, 0, resolution, resolution);
+
+    size_t rendererCount = m_renderers.size();
+    for (int nCascade = 0; nCascade < m_shadowCascades.GetCascadeCount(); ++nCascade)
+    {
+        glm::mat4 const& lightMatrix = m_shadowCascades.GetMatrix(nCascade);
+        Frustum          cascadeFrustum(lightMatrix);
+
+        glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, m_shadowMapTextures[nCascade], 0);
+        glClear(GL_DEPTH_BUFFER_BIT);
+
+        // Only the casters of the slice and between the slice and the light
+        for (int nRenderer = 0; nRenderer < rendererCount; ++nRenderer)
+        {
+            IRenderer * pRenderer = m_renderers[nRenderer];
+            if (!cascadeFrustum.IsVisible(pRenderer->GetBounds()))
+            {
+                ++m_culledShadowCasters;
+                continue;
+            }
+
+            m_triangleCounter += pRenderer->GetElementCount();
+            m_currentTriangle += pRenderer->GetElementCount();
+
+            glm::mat4 depthMVP = lightMatrix * pRenderer->m_model;
+            glUniformMatrix4fv(shadowMVPID, 1, GL_FALSE, &depthMVP[0][0]);
+
+            glBindVertexArray(pRenderer->m_vao);
+            glEnableVertexAttribArray(0);
+
+            if(pRenderer->m_isInstantiated)
+                glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, pRenderer->m_elementsCount);
+            else if(pRenderer->m_isIndexed)
+                glDrawElements(GL_TRIANGLES, pRenderer->m_elementsCount, pRenderer->m_indexType, nullptr);
+            else
+                glDrawArrays(GL_TRIANGLES, 0, pRenderer->m_elementsCount);
 
-        // Hot code
-        glm::mat4 hmdViewMatrix = GetHMDMatrixPoseEye(nEye) * glm::translate(m_mat4HMDPose, glm::vec3(-200.0f, -300.0f, 200.0f));
-        hmdViewMatrix           = glm::rotate(hmdViewMatrix, -(float)M_PI_2,   glm::vec3(1.0f, 0.0f, 0.0f));
-        m_renderers[nRenderer]->Draw(GetHMDMatrixProjectionEye(nEye), hmdViewMatrix, glm::vec3(0.0f, 0.0f, 0.0f), LightManager::GetNearestPointLights(m_renderers[nRenderer]->GetPosition()));
+            glBindVertexArray(0);
+        }
     }
+
+    // FBO end
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Shader end
+    glUseProgram(0);
+}
+
+/// \brief  Searches the nearest point lights of a renderer
+/// \param  position The position of the renderer
+/// \return The lights, valid until the next call
+std::vector<PointLightStructure> const& RenderingEngine::FindNearestPointLights(glm::vec3 const& position)
+{
+    // Resizing within the capacity, no allocation after the first call
+    m_nearestLights.resize(LightManager::s_nearestLightCount);
+
+    int count = LightManager::GetNearestPointLights(position, m_nearestLights.data(), LightManager::s_nearestLightCount);
+    m_nearestLights.resize(static_cast<size_t>(count));
+
+    return m_nearestLights;
 }
 
 /// \brief Sets the current camera
@@ -934,6 +1152,13 @@ void RenderingEngine::SetPluginManager(PluginManager * pManager)
 /// \brief Shutdown the engine
 void RenderingEngine::Shutdown()
 {
+    m_workerPool.Shutdown();
+
+    ReleaseShadowMaps();
+    glDeleteFramebuffers(1, &m_shadowMapFbo);
+    m_postProcessingStack.Release();
+    m_gpuTimer.Release();
+
     LightManager::Shutdown();
     ShaderManager::Shutdown();
     TextureManager::Shutdown();
@@ -1085,6 +1310,56 @@ LineRenderer * RenderingEngine::AllocateLineRenderer()
     pSystem = nullptr;
 }
 
+/// \brief  Returns the number of renderers culled by the camera frustum
+///         during the last frame (both eyes in stereoscopic rendering)
+/// \return The number of culled renderers
+/* static */ uint64_t RenderingEngine::GetCulledRendererCount()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_culledRenderers;
+}
+
+/// \brief  Returns the number of renderers culled by the light frustum
+///         of the shadow pass during the last frame
+/// \return The number of culled shadow casters
+/* static */ uint64_t RenderingEngine::GetCulledShadowCasterCount()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_culledShadowCasters;
+}
+
+/// \brief  Sets the number of shadow cascades and the size of their maps
+/// \param  cascadeCount The number of cascades, from 1 to ShadowCascades::s_maxCascades
+/// \param  resolution The width and height of each map in texels
+/// \return False if the maps can't be created
+/* static */ bool RenderingEngine::SetShadowCascades(int cascadeCount, int resolution)
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+
+    s_pInstance->ReleaseShadowMaps();
+    s_pInstance->m_shadowCascades.Configure(cascadeCount, resolution);
+
+    return s_pInstance->CreateShadowMaps();
+}
+
+/// \brief  Returns the shadow cascades of the directional light
+/// \return The cascades, fitted to the main camera of the last frame
+/* static */ ShadowCascades const& RenderingEngine::GetShadowCascades()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_shadowCascades;
+}
+
+/// \brief  Returns the depth map of a shadow cascade
+/// \param  cascade The index of the cascade
+/// \return The texture
+/* static */ uint RenderingEngine::GetShadowMapTexture(int cascade)
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    ASSERT_LT(cascade, s_pInstance->m_shadowCascades.GetCascadeCount());
+    return s_pInstance->m_shadowMapTextures[cascade];
+}
+
 /// \brief Returns the main camera
 /// \return A pointer on the main camera
 /* static */ Camera *RenderingEngine::GetMainCamera()
@@ -1116,6 +1391,50 @@ LineRenderer * RenderingEngine::AllocateLineRenderer()
     return s_pInstance->m_bIsPostProcessingEnabled;
 }
 
+/// \brief Sets the state of the clustered lighting
+/// \param bActive The new state
+/* static */ void RenderingEngine::SetClusteredLightingActive(bool bActive)
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    s_pInstance->m_bClusteredLighting = bActive;
+}
+
+/// \brief Tells if the clustered lighting is active or not
+/// \return True or false
+/* static */ bool RenderingEngine::IsClusteredLightingActive()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_bClusteredLighting;
+}
+
+/// \brief Sets the state of the dynamic resolution
+/// \param bActive The new state
+/* static */ void RenderingEngine::SetDynamicResolutionActive(bool bActive)
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    s_pInstance->m_bDynamicResolution = bActive;
+    s_pInstance->m_dynamicResolution.Reset();
+}
+
+/// \brief Tells if the dynamic resolution is active or not
+/// \return True or false
+/* static */ bool RenderingEngine::IsDynamicResolutionActive()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_bDynamicResolution;
+}
+
+/// \brief Sets the frame rate the dynamic resolution holds and the range of the scale
+/// \param targetFrameRate The GPU frame rate to hold
+/// \param minScale The lowest scale of each axis
+/// \param maxScale The highest scale of each axis
+/* static */ void RenderingEngine::ConfigureDynamicResolution(float targetFrameRate, float minScale, float maxScale)
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    ASSERT_GT(targetFrameRate, 0.0f);
+    s_pInstance->m_dynamicResolution.Configure(1000.0f / targetFrameRate, minScale, maxScale);
+}
+
 /// \brief Returns a pointer on the post-processing stack
 /// \return A pointer on the post-processing stack
 /* static */ PostProcessingStack *RenderingEngine::GetPostProcessingStack()
@@ -1124,6 +1443,16 @@ LineRenderer * RenderingEngine::AllocateLineRenderer()
     return &(s_pInstance->m_postProcessingStack);
 }
 
+/// \brief Returns the worker pool of the engine, one thread per hardware thread
+///        Shared by the particle update and the world generation and batching,
+///        it must only be used from the main thread
+/// \return A reference on the worker pool
+/* static */ WorkerPool &RenderingEngine::GetWorkerPool()
+{
+    ASSERT_NOT_NULL(RenderingEngine::s_pInstance);
+    return s_pInstance->m_workerPool;
+}
+
 /// \brief Displays a window with debug information
 /// \param step The current step
 void RenderingEngine::DisplayDebugWindow(float step)
@@ -1132,7 +1461,7 @@ void RenderingEngine::DisplayDebugWindow(float step)
     {
         ImGui::Begin        ("Cardinal debug", &m_debugWindow);
         ImGui::SetWindowPos ("Cardinal debug", ImVec2(10.0f, 10.0f));
-        ImGui::SetWindowSize("Cardinal debug", ImVec2(250.0f, 455.0f));
+        ImGui::SetWindowSize("Cardinal debug", ImVec2(250.0f, 620.0f));
 
         // Header
         ImGuiContext & context = *ImGui::GetCurrentContext();
@@ -1176,10 +1505,22 @@ void RenderingEngine::DisplayDebugWindow(float step)
         ImGui::Text("Lerp  : %lf",  step);
         ImGui::Text("Tri/f : %llu", m_currentTriangle);
         ImGui::Text("Tri/s : %llu", m_triangleSecond);
+        ImGui::Text("Culled renderers : %llu", m_culledRenderers);
+        ImGui::Text("Culled casters   : %llu", m_culledShadowCasters);
+        ImGui::Text("Avoided uniforms : %llu", IShader::GetAvoidedUniformCount());
+        ImGui::Text("Avoided binds    : %llu", StateCache::GetAvoidedBindCount());
+        ImGui::Checkbox("Clustered lights", &m_bClusteredLighting);
+        ImGui::Text("GPU frame        : %4.2lf ms", m_gpuFrameTime);
+        ImGui::Text("Resolution       : %dx%d", m_targetWidth, m_targetHeight);
+        if(ImGui::Checkbox("Dynamic resolution", &m_bDynamicResolution))
+        {
+            m_dynamicResolution.Reset();
+        }
 
         // Post-processing
         ImGui::Text("\nPost-processing");
         ImGui::Text("Active shaders : %d", m_postProcessingStack.GetActivePostProcessShaders());
+        ImGui::Text("Passes         : %d", m_postProcessingStack.GetPassCount());
 
         // Camera
         glm::vec3 const& position  = m_pCamera->GetPosition();
@@ -1237,9 +1578,32 @@ void RenderingEngine::Update(float dt)
         debug::DrawPointLight(pPointLight->GetPosition(), glm::vec3(1.0f), 32, pPointLight->GetRange(), 1.0f);
     }
 
+    // Emission, the systems are independent
+    m_workerPool.ParallelFor(static_cast<int>(m_paricleSystems.size()), [this, dt](int nSystem)
+    {
+        m_paricleSystems[nSystem]->Emit(dt);
+    });
+
+    // Simulation, the particles of all systems are split in jobs
+    m_particleJobs.clear();
+    for(ParticleSystem * pSystem : m_paricleSystems)
+    {
+        int jobCount = pSystem->GetJobCount();
+        for(int nJob = 0; nJob < jobCount; ++nJob)
+        {
+            m_particleJobs.emplace_back(pSystem, nJob);
+        }
+    }
+
+    m_workerPool.ParallelFor(static_cast<int>(m_particleJobs.size()), [this, dt](int nJob)
+    {
+        m_particleJobs[nJob].first->SimulateJob(m_particleJobs[nJob].second, dt);
+    });
+
+    // Upload, GL calls stay on the main thread
     for(ParticleSystem * pSystem : m_paricleSystems)
     {
-        pSystem->Update(dt);
+        pSystem->EndUpdate();
     }
 }
 
@@ -25,18 +25,15 @@
 #include <ThirdParty/Glm/glm/ext.hpp>
 #include "Glew/include/GL/glew.h"
 
+#include "Runtime/Rendering/Lighting/LightBuffer.hpp"
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Lit/LitTextureShader.hpp"
 
 /// \namespace cardinal
 namespace cardinal
 {
 
-/* static */ int LitTextureShader::s_lightDirection   = -1;
-/* static */ int LitTextureShader::s_lightIntensity   = -1;
-/* static */ int LitTextureShader::s_ambientIntensity = -1;
-/* static */ int LitTextureShader::s_lightColor       = -1;
-
 /// \brief Constructor
 LitTextureShader::LitTextureShader()
 {
@@ -55,18 +52,12 @@ LitTextureShader::LitTextureShader()
     m_matrixID       = glGetUniformLocation((GLuint)m_shaderID, "MVP");
     m_textureSampler = glGetUniformLocation((GLuint)m_shaderID, "textureSampler");
 
-    s_lightDirection   = glGetUniformLocation((GLuint)m_shaderID, "lightDirection");
-    s_lightIntensity   = glGetUniformLocation((GLuint)m_shaderID, "lightIntensity");
-    s_ambientIntensity = glGetUniformLocation((GLuint)m_shaderID, "ambientIntensity");
-    s_lightColor       = glGetUniformLocation((GLuint)m_shaderID, "lightColor");
+    // Lighting, uploaded once per frame by the light manager
+    BindUniformBlock("Lights", LightBuffer::s_bindingPoint);
 
    /* ASSERT_NE(m_modelID,  -1);
     ASSERT_NE(m_viewID,   -1);
-    ASSERT_NE(m_matrixID, -1);
-    ASSERT_NE(s_lightDirection,   -1);
-    ASSERT_NE(s_lightIntensity,   -1);
-    ASSERT_NE(s_ambientIntensity, -1);
-    ASSERT_NE(s_lightColor,       -1);*/
+    ASSERT_NE(m_matrixID, -1);*/
 }
 
 /// \brief Sets the texture of the shader
@@ -79,14 +70,19 @@ void LitTextureShader::SetTexture(uint textureID)
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void LitTextureShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
-    glUseProgram      ((GLuint)m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
     glUniformMatrix4fv(m_projection,  1, GL_FALSE,   &P[0][0]);
     glUniformMatrix4fv(m_modelID,     1, GL_FALSE,   &M[0][0]);
     glUniformMatrix4fv(m_viewID,      1, GL_FALSE,   &V[0][0]);
     glUniformMatrix4fv(m_matrixID,    1, GL_FALSE, &MVP[0][0]);
 
-    glActiveTexture (GL_TEXTURE0);
-    glBindTexture   (GL_TEXTURE_2D, m_textureID);
+    StateCache::BindTexture(0, m_textureID);
+}
+
+/// \brief Returns the texture bound by Begin
+uint LitTextureShader::GetTexture() const
+{
+    return m_textureID;
 }
 
 /// \brief Restore the pipeline state
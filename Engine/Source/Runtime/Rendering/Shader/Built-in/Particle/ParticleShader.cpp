@@ -25,6 +25,7 @@
 #include "ImGUI/Header/ImGUI/imgui.h"
 
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Particle/ParticleShader.hpp"
 
 /// \namespace cardinal
@@ -47,7 +48,7 @@ ParticleShader::ParticleShader()
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void ParticleShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
-    glUseProgram      ((uint)m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
 
     glm::vec3 right = glm::vec3(V[0][0], V[1][0], V[2][0]);
     glm::vec3 up    = glm::vec3(V[0][1], V[1][1], V[2][1]);
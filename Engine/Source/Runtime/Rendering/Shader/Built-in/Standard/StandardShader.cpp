@@ -21,22 +21,21 @@
 /// \package    Runtime/Rendering/Shader/Built-in/Lit
 /// \author     Vincent STEHLY--CALISTO
 
+#include <algorithm>
 #include <Header/Runtime/Core/Assertion/Assert.hh>
 #include <ThirdParty/Glm/glm/ext.hpp>
 #include "Glew/include/GL/glew.h"
 
+#include "Runtime/Rendering/Lighting/LightBuffer.hpp"
+#include "Runtime/Rendering/Lighting/LightManager.hpp"
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Standard/StandardShader.hpp"
 
 /// \namespace cardinal
 namespace cardinal
 {
 
-/* static */ int StandardShader::s_lightDirection   = -1;
-/* static */ int StandardShader::s_lightIntensity   = -1;
-/* static */ int StandardShader::s_ambientIntensity = -1;
-/* static */ int StandardShader::s_lightColor       = -1;
-
 /// \brief Constructor
 StandardShader::StandardShader()
 {
@@ -45,24 +44,28 @@ StandardShader::StandardShader()
     m_textureID      =  0;
     m_textureSampler = -1;
     m_lightCountID   = -1;
+    m_lightIndicesID = -1;
+    m_clusterCellsID  = -1;
+    m_clusterLightsID = -1;
+    m_atlasTileStep  = 0.0f;
 
     m_shaderID       = ShaderManager::GetShaderID("Standard");
 
     ASSERT_NE(m_shaderID, -1);
 
-    m_projection     = glGetUniformLocation((GLuint)m_shaderID, "PR");
-    m_modelID        = glGetUniformLocation((GLuint)m_shaderID, "M");
-    m_viewID         = glGetUniformLocation((GLuint)m_shaderID, "V");
-    m_matrixID       = glGetUniformLocation((GLuint)m_shaderID, "MVP");
-    m_textureSampler = glGetUniformLocation((GLuint)m_shaderID, "textureSampler");
-
-    s_lightDirection   = glGetUniformLocation((GLuint)m_shaderID, "lightDirection");
-    s_lightIntensity   = glGetUniformLocation((GLuint)m_shaderID, "lightIntensity");
-    s_ambientIntensity = glGetUniformLocation((GLuint)m_shaderID, "ambientIntensity");
-    s_lightColor       = glGetUniformLocation((GLuint)m_shaderID, "lightColor");
-
-    // Lighting
-    m_lightCountID = glGetUniformLocation((GLuint)m_shaderID, "lightCount");
+    m_projection      = GetUniformLocation("PR");
+    m_modelID         = GetUniformLocation("M");
+    m_viewID          = GetUniformLocation("V");
+    m_matrixID        = GetUniformLocation("MVP");
+    m_textureSampler  = GetUniformLocation("textureSampler");
+    m_atlasTileStepID = GetUniformLocation("atlasTileStep");
+
+    // Lighting, the lights are uploaded once per frame by the light manager
+    m_lightCountID   = GetUniformLocation("lightCount");
+    m_lightIndicesID = GetUniformLocation("lightIndices");
+    m_clusterCellsID  = GetUniformLocation("clusterCells");
+    m_clusterLightsID = GetUniformLocation("clusterLights");
+    BindUniformBlock("Lights", LightBuffer::s_bindingPoint);
 }
 
 /// \brief Sets the texture of the shader
@@ -71,43 +74,49 @@ void StandardShader::SetTexture(uint textureID)
     m_textureID = textureID;
 }
 
+/// \brief Enables the tiling of packed atlas UVs
+/// \param tileStep The size of an atlas tile in UV space, 0 to disable
+void StandardShader::SetAtlasTiling(float tileStep)
+{
+    m_atlasTileStep = tileStep;
+}
+
 /// \brief Sets up the pipeline for the shader
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void StandardShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
     glEnable(GL_MULTISAMPLE);
 
-    glUseProgram      ((GLuint)m_shaderID);
-    glUniformMatrix4fv(m_projection,  1, GL_FALSE,   &P[0][0]);
-    glUniformMatrix4fv(m_modelID,     1, GL_FALSE,   &M[0][0]);
-    glUniformMatrix4fv(m_viewID,      1, GL_FALSE,   &V[0][0]);
-    glUniformMatrix4fv(m_matrixID,    1, GL_FALSE, &MVP[0][0]);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
+    SetMatrix4  (m_projection, P);
+    SetMatrix4  (m_modelID,    M);
+    SetMatrix4  (m_viewID,     V);
+    SetMatrix4  (m_matrixID,   MVP);
+    SetFloat    (m_atlasTileStepID, m_atlasTileStep);
 
-    // Lighting
-    glUniform1i(m_lightCountID, static_cast<GLint>(pointLights.size()));
+    // Lighting, only the indices of the lights in the lights block
+    const size_t lightCount = std::min(pointLights.size(), static_cast<size_t>(s_maxPointLights));
 
-    // Setting uniforms
-    for(size_t nLight = 0; nLight < pointLights.size(); ++nLight)
+    glm::ivec4 lightIndices(0);
+    for(size_t nLight = 0; nLight < lightCount; ++nLight)
     {
-        std::string index = std::to_string(nLight);
-        std::string range      = "lights[" + index + "].range";
-        std::string intensity  = "lights[" + index + "].intensity";
-        std::string color      = "lights[" + index + "].color";
-        std::string position   = "lights[" + index + "].position";
-
-        int locRange     = glGetUniformLocation((GLuint)m_shaderID, range.c_str());
-        int locIntensity = glGetUniformLocation((GLuint)m_shaderID, intensity.c_str());
-        int locColor     = glGetUniformLocation((GLuint)m_shaderID, color.c_str());
-        int locPosition  = glGetUniformLocation((GLuint)m_shaderID, position.c_str());
-
-        glUniform1f(locRange,     pointLights[nLight].range);
-        glUniform1f(locIntensity, pointLights[nLight].intensity);
-        glUniform3f(locColor,     pointLights[nLight].color.x,    pointLights[nLight].color.y,    pointLights[nLight].color.z);
-        glUniform3f(locPosition,  pointLights[nLight].position.x, pointLights[nLight].position.y, pointLights[nLight].position.z);
+        lightIndices[static_cast<int>(nLight)] = pointLights[nLight].index;
     }
 
-    glActiveTexture (GL_TEXTURE0);
-    glBindTexture   (GL_TEXTURE_2D, m_textureID);
+    SetInt (m_lightCountID,   static_cast<int>(lightCount));
+    SetInt4(m_lightIndicesID, lightIndices);
+
+    // Clustered lighting, the buffers are bound by the light manager
+    SetInt(m_clusterCellsID,  LightManager::s_clusterCellsUnit);
+    SetInt(m_clusterLightsID, LightManager::s_clusterLightsUnit);
+
+    StateCache::BindTexture(0, m_textureID);
+}
+
+/// \brief Returns the texture bound by Begin
+uint StandardShader::GetTexture() const
+{
+    return m_textureID;
 }
 
 /// \brief Restore the pipeline state
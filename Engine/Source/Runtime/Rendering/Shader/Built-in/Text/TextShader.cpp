@@ -24,6 +24,7 @@
 #include "Glew/include/GL/glew.h"
 
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Texture/TextureManager.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Text/TextShader.hpp"
 
@@ -44,15 +45,20 @@ TextShader::TextShader()
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void TextShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
-    glUseProgram      (m_shaderID);
-    glActiveTexture   (GL_TEXTURE0);
-    glBindTexture     (GL_TEXTURE_2D, m_texture);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
+    StateCache::BindTexture(0, m_texture);
     glUniform1i       (m_textureSampler, 0);
     SetFloat4         (m_textColor, m_color.x, m_color.y, m_color.z, m_color.a);
 
     glDisable(GL_CULL_FACE);
 }
 
+/// \brief Returns the texture bound by Begin
+uint TextShader::GetTexture() const
+{
+    return m_texture;
+}
+
 /// \brief Restore the pipeline state
 void TextShader::End()
 {
@@ -24,6 +24,7 @@
 #include "Glew/include/GL/glew.h"
 
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Unlit/UnlitColorShader.hpp"
 
 /// \namespace cardinal
@@ -41,7 +42,7 @@ UnlitColorShader::UnlitColorShader()
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void UnlitColorShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
-    glUseProgram      (m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
     glUniformMatrix4fv(m_matrixID, 1, GL_FALSE, &MVP[0][0]);
 }
 
@@ -26,6 +26,7 @@
 
 #include "ImGUI/Header/ImGUI/imgui.h"
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Unlit/UnlitLineShader.hpp"
 
 /// \namespace cardinal
@@ -47,7 +48,7 @@ UnlitLineShader::UnlitLineShader()
 void UnlitLineShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
     glEnable(GL_MULTISAMPLE);
-    glUseProgram      ((uint)m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
     glUniformMatrix4fv(m_matrixID, 1, GL_FALSE, &MVP[0][0]);
     glUniform3f       (m_colorID,  m_color.x, m_color.y, m_color.z);
     glDisable(GL_MULTISAMPLE);
@@ -24,6 +24,7 @@
 #include "Glew/include/GL/glew.h"
 
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Unlit/UnlitTextureShader.hpp"
 
 /// \namespace cardinal
@@ -51,15 +52,20 @@ void UnlitTextureShader::SetTexture(uint textureID)
 /// \param MVP The Projection-View-Model matrix to pass to the shader
 void UnlitTextureShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
-    glUseProgram      (m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
     glUniformMatrix4fv(m_matrixID, 1, GL_FALSE, &MVP[0][0]);
 
-    glActiveTexture   (GL_TEXTURE0);
-    glBindTexture     (GL_TEXTURE_2D, m_textureID);
+    StateCache::BindTexture(0, m_textureID);
 
     glDisable(GL_MULTISAMPLE);
 }
 
+/// \brief Returns the texture bound by Begin
+uint UnlitTextureShader::GetTexture() const
+{
+    return m_textureID;
+}
+
 /// \brief Restore the pipeline state
 void UnlitTextureShader::End()
 {
@@ -24,6 +24,7 @@
 #include "Glew/include/GL/glew.h"
 
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 #include "Runtime/Rendering/Shader/Built-in/Unlit/UnlitTransparentShader.hpp"
 
 /// \namespace cardinal
@@ -43,16 +44,21 @@ UnlitTransparentShader::UnlitTransparentShader()
 void UnlitTransparentShader::Begin(glm::mat4 const& MVP, glm::mat4 const& P, glm::mat4 const& V, glm::mat4 const& M, glm::vec3 const& light, std::vector<PointLightStructure> const& pointLights)
 {
     // Pre-condition
-    glUseProgram      ((uint)m_shaderID);
+    StateCache::UseProgram(static_cast<uint>(m_shaderID));
     glUniformMatrix4fv(m_matrixID, 1, GL_FALSE, &MVP[0][0]);
 
     glDisable      (GL_CULL_FACE);
     glDisable      (GL_MULTISAMPLE);
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture  (GL_TEXTURE_2D, (uint)m_texture);
+    StateCache::BindTexture(0, static_cast<uint>(m_texture));
     glUniform1i    (m_textureID, 0);
 }
 
+/// \brief Returns the texture bound by Begin
+uint UnlitTransparentShader::GetTexture() const
+{
+    return static_cast<uint>(m_texture);
+}
+
 /// \brief Restore the pipeline state
 void UnlitTransparentShader::End()
 {
@@ -21,6 +21,8 @@
 /// \package    Runtime/Rendering/Shader
 /// \author     Vincent STEHLY--CALISTO
 
+#include <cstring>
+
 #include "Glew/include/GL/glew.h"
 #include "Runtime/Rendering/Shader/IShader.hpp"
 
@@ -28,10 +30,208 @@
 namespace cardinal
 {
 
+/* static */ std::unordered_map<int, IShader::ProgramUniforms> IShader::s_programs;
+/* static */ uint64                                            IShader::s_avoidedUniforms = 0;
+
+/// \brief Resolves and caches the active uniforms of a linked program
+/// \param program The program
+/* static */ void IShader::ResolveUniforms(int program)
+{
+    ProgramUniforms & uniforms = s_programs[program];
+    uniforms.m_locations.clear();
+    uniforms.m_values.clear();
+
+    GLint count     = 0;
+    GLint maxLength = 0;
+    glGetProgramiv((GLuint)program, GL_ACTIVE_UNIFORMS,           &count);
+    glGetProgramiv((GLuint)program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::vector<char> name(static_cast<size_t>(maxLength) + 1);
+    for (GLint nUniform = 0; nUniform < count; ++nUniform)
+    {
+        GLint   size   = 0;
+        GLenum  type   = 0;
+        GLsizei length = 0;
+        glGetActiveUniform((GLuint)program, (GLuint)nUniform, maxLength, &length, &size, &type, name.data());
+
+        std::string uniformName(name.data(), static_cast<size_t>(length));
+        int location = glGetUniformLocation((GLuint)program, uniformName.c_str());
+        uniforms.m_locations[uniformName] = location;
+
+        // Arrays are reported as "name[0]", also accessible as "name"
+        if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0)
+        {
+            uniforms.m_locations[uniformName.substr(0, uniformName.size() - 3)] = location;
+        }
+    }
+}
+
+/// \brief Forgets the uniforms of a program, before deleting or relinking it
+/// \param program The program
+/* static */ void IShader::ReleaseUniforms(int program)
+{
+    // The entry is kept, shaders may still point to it
+    auto it = s_programs.find(program);
+    if (it != s_programs.end())
+    {
+        it->second.m_locations.clear();
+        it->second.m_values.clear();
+    }
+}
+
+/// \brief Returns the number of uniform uploads skipped since the last reset
+/* static */ uint64 IShader::GetAvoidedUniformCount()
+{
+    return s_avoidedUniforms;
+}
+
+/// \brief Resets the number of skipped uniform uploads
+/* static */ void IShader::ResetAvoidedUniformCount()
+{
+    s_avoidedUniforms = 0;
+}
+
+/// \brief  Returns the location of a uniform of the shader program
+/// \param  name The name of the uniform
+/// \return The location, -1 if the uniform is not active
+int IShader::GetUniformLocation(const char * name)
+{
+    ProgramUniforms & uniforms = GetProgramUniforms();
+
+    auto it = uniforms.m_locations.find(name);
+    if (it != uniforms.m_locations.end())
+    {
+        return it->second;
+    }
+
+    // Not enumerated (e.g. an array element), resolved once
+    int location = glGetUniformLocation((GLuint)m_shaderID, name);
+    uniforms.m_locations.emplace(name, location);
+    return location;
+}
+
+/// \brief  Returns the texture bound by Begin, used to sort the draws
+/// \return The texture, 0 if the shader has none
+uint IShader::GetTexture() const
+{
+    return 0;
+}
+
+/// \brief Binds a uniform block of the shader program to a buffer binding point
+/// \param name The name of the block
+/// \param binding The binding point
+void IShader::BindUniformBlock(const char * name, uint binding)
+{
+    GLuint index = glGetUniformBlockIndex((GLuint)m_shaderID, name);
+    if (index != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding((GLuint)m_shaderID, index, binding);
+    }
+}
+
+/// \brief Sets an integer in the shader
+void IShader::SetInt(int uniform, int value)
+{
+    if (UpdateValue(uniform, &value, 1))
+    {
+        glUniform1i(uniform, value);
+    }
+}
+
+/// \brief Sets 4 integers in the shader
+void IShader::SetInt4(int uniform, glm::ivec4 const& value)
+{
+    if (UpdateValue(uniform, &value[0], 4))
+    {
+        glUniform4i(uniform, value.x, value.y, value.z, value.w);
+    }
+}
+
+/// \brief Sets a float in the shader
+void IShader::SetFloat(int uniform, float value)
+{
+    if (UpdateValue(uniform, &value, 1))
+    {
+        glUniform1f(uniform, value);
+    }
+}
+
+/// \brief Sets 3 floats in the shader
+void IShader::SetFloat3(int uniform, glm::vec3 const& value)
+{
+    if (UpdateValue(uniform, &value[0], 3))
+    {
+        glUniform3f(uniform, value.x, value.y, value.z);
+    }
+}
+
 /// \brief Sets 4 floats in the shader
 void IShader::SetFloat4(int uniform, float x, float y, float z, float w)
 {
-    glUniform4f(uniform, x, y, z, w);
+    const float value[4] = { x, y, z, w };
+    if (UpdateValue(uniform, value, 4))
+    {
+        glUniform4f(uniform, x, y, z, w);
+    }
+}
+
+/// \brief Sets a 4x4 matrix in the shader
+void IShader::SetMatrix4(int uniform, glm::mat4 const& value)
+{
+    if (UpdateValue(uniform, &value[0][0], 16))
+    {
+        glUniformMatrix4fv(uniform, 1, GL_FALSE, &value[0][0]);
+    }
+}
+
+/// \brief  Returns the uniforms of the shader program
+IShader::ProgramUniforms & IShader::GetProgramUniforms()
+{
+    if (m_pUniforms == nullptr || m_uniformsProgram != m_shaderID)
+    {
+        auto it = s_programs.find(m_shaderID);
+        if (it == s_programs.end())
+        {
+            // The program was not registered after its link
+            ResolveUniforms(m_shaderID);
+            it = s_programs.find(m_shaderID);
+        }
+
+        m_pUniforms       = &it->second;
+        m_uniformsProgram = m_shaderID;
+    }
+
+    return *m_pUniforms;
+}
+
+/// \brief  Records the value of a uniform
+/// \return False if the uniform already had this value
+bool IShader::UpdateValue(int uniform, const void * pData, int size)
+{
+    if (uniform < 0)
+    {
+        // Inactive uniform, GL would ignore the call anyway
+        return false;
+    }
+
+    std::vector<UniformValue> & values = GetProgramUniforms().m_values;
+    if (static_cast<size_t>(uniform) >= values.size())
+    {
+        values.resize(static_cast<size_t>(uniform) + 1, UniformValue { {}, 0 });
+    }
+
+    const size_t bytes = size * sizeof(float);
+    UniformValue & cached = values[static_cast<size_t>(uniform)];
+
+    if (cached.m_size == size && memcmp(cached.m_data, pData, bytes) == 0)
+    {
+        ++s_avoidedUniforms;
+        return false;
+    }
+
+    memcpy(cached.m_data, pData, bytes);
+    cached.m_size = size;
+    return true;
 }
 
-} // !namespace
\ No newline at end of file
+} // !namespace
@@ -0,0 +1,160 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ProgramCache.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    Runtime/Rendering/Shader
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstdio>
+#include <fstream>
+
+#ifdef CARDINAL_WINDOWS
+#   include <direct.h>
+#else
+#   include <sys/stat.h>
+#endif
+
+#include "Runtime/Rendering/Shader/ProgramCache.hpp"
+
+/// \namespace cardinal
+namespace cardinal
+{
+
+/* static */ const uint32 ProgramCache::s_magic;
+/* static */ const uint32 ProgramCache::s_version;
+/* static */ const uint64 ProgramCache::s_seed;
+
+/* static */ bool        ProgramCache::s_bEnabled  = true;
+/* static */ std::string ProgramCache::s_directory = "ShaderCache";
+
+/// \brief Hashes a string with FNV-1a
+/* static */ uint64 ProgramCache::Hash(const char * szData, uint64 seed)
+{
+    uint64 hash = seed;
+    for(const char * pChar = szData; *pChar != '\0'; ++pChar)
+    {
+        hash ^= static_cast<uchar>(*pChar);
+        hash *= 0x100000001b3ull;
+    }
+
+    // Separates consecutive strings, "ab" + "c" and "a" + "bc" differ
+    hash ^= 0xFF;
+    hash *= 0x100000001b3ull;
+
+    return hash;
+}
+
+/// \brief Sets the directory of the cache files
+/* static */ void ProgramCache::SetDirectory(std::string const& directory)
+{
+    s_directory = directory;
+}
+
+/// \brief Enables or disables the cache
+/* static */ void ProgramCache::SetEnabled(bool bEnabled)
+{
+    s_bEnabled = bEnabled;
+}
+
+/// \brief Tells if the cache is enabled
+/* static */ bool ProgramCache::IsEnabled()
+{
+    return s_bEnabled;
+}
+
+/// \brief Returns the file of a program
+/* static */ std::string ProgramCache::GetPath(const char * szName)
+{
+    char szFile[32];
+    snprintf(szFile, sizeof(szFile), "%016llx.bin", Hash(szName, s_seed));
+
+    return s_directory + "/" + szFile;
+}
+
+/// \brief Reads an entry
+/* static */ bool ProgramCache::ReadEntry(std::string const& path, uint64 key, uint32 & format, std::vector<char> & binary)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    if(!stream.is_open())
+    {
+        return false;
+    }
+
+    Header header = {};
+    if(!stream.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    {
+        return false;
+    }
+
+    if(header.magic != s_magic || header.version != s_version || header.key != key || header.binarySize == 0)
+    {
+        return false;
+    }
+
+    binary.resize(header.binarySize);
+    if(!stream.read(binary.data(), header.binarySize))
+    {
+        return false;
+    }
+
+    // Trailing bytes mean a truncated or mixed write
+    if(stream.peek() != std::ifstream::traits_type::eof())
+    {
+        return false;
+    }
+
+    format = header.format;
+    return true;
+}
+
+/// \brief Writes an entry, replacing the previous one
+/* static */ bool ProgramCache::WriteEntry(std::string const& path, uint64 key, uint32 format, std::vector<char> const& binary)
+{
+#ifdef CARDINAL_WINDOWS
+    _mkdir(s_directory.c_str());
+#else
+    mkdir(s_directory.c_str(), 0755);
+#endif
+
+    std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!stream.is_open())
+    {
+        return false;
+    }
+
+    Header header = {};
+    header.magic      = s_magic;
+    header.version    = s_version;
+    header.key        = key;
+    header.format     = format;
+    header.binarySize = static_cast<uint32>(binary.size());
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    stream.write(binary.data(), binary.size());
+
+    return static_cast<bool>(stream);
+}
+
+/// \brief Deletes an entry
+/* static */ void ProgramCache::RemoveEntry(std::string const& path)
+{
+    std::remove(path.c_str());
+}
+
+} // !namespace
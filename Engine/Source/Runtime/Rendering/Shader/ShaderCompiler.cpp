@@ -22,6 +22,7 @@
 /// \author     Vincent STEHLY--CALISTO
 
 #include <vector>
+#include <cstring>
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -29,11 +30,25 @@
 #include "Glew/include/GL/glew.h"
 #include "Runtime/Core/Debug/Logger.hpp"
 #include "Runtime/Rendering/Shader/ShaderCompiler.hpp"
+#include "Runtime/Rendering/Shader/ProgramCache.hpp"
 
 /// \namespace cardinal
 namespace cardinal
 {
 
+/* static */ std::unordered_map<uint, ShaderCompiler::PendingProgram> ShaderCompiler::s_pendingPrograms;
+
+/// \brief Lets the driver compile on its own threads when it can
+/* static */ void ShaderCompiler::Initialize()
+{
+    if(GLEW_KHR_parallel_shader_compile)
+    {
+        // 0xFFFFFFFF lets the driver pick the number of threads
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+        Logger::LogInfo("Parallel shader compilation enabled");
+    }
+}
+
 /// \brief Loads a shader from the given paths
 /// \param czVertexShader The path to the vertex shader
 /// \param csFragmentShader The path to the fragment shader
@@ -41,255 +56,342 @@ int ShaderCompiler::LoadShaders(
         const char * czVertexShader,
         const char * csFragmentShader)
 {
-    GLuint VertexShaderID   = glCreateShader(GL_VERTEX_SHADER);
-    GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-
     std::string VertexShaderCode;
     std::string FragmentShaderCode;
 
-    std::ifstream VertexShaderStream(czVertexShader, std::ios::in);
-    if(VertexShaderStream.is_open())
+    if(!ReadSource(czVertexShader, VertexShaderCode) || !ReadSource(csFragmentShader, FragmentShaderCode))
     {
-        std::stringstream sstr;
-        sstr << VertexShaderStream.rdbuf();
-
-        VertexShaderCode = sstr.str();
-        VertexShaderStream.close();
-    }
-    else
-    {
-        Logger::LogError("Impossible to open %s. Are you in the right directory ?", czVertexShader);
-        getchar();
         return 0;
     }
 
-    // Read the Fragment IShader code from the file
-    std::ifstream FragmentShaderStream(csFragmentShader, std::ios::in);
-    if(FragmentShaderStream.is_open())
-    {
-        std::stringstream sstr;
-        sstr << FragmentShaderStream.rdbuf();
+    return CompileShaders(VertexShaderCode.c_str(), FragmentShaderCode.c_str(), czVertexShader, csFragmentShader);
+}
 
-        FragmentShaderCode = sstr.str();
-        FragmentShaderStream.close();
-    }
-    else
+/// \brief Compiles and links a program from sources
+/// \param szVertexCode The source of the vertex shader
+/// \param szFragmentCode The source of the fragment shader
+/// \param szVertexName The name of the vertex shader in the logs
+/// \param szFragmentName The name of the fragment shader in the logs
+int ShaderCompiler::CompileShaders(
+        const char * szVertexCode,
+        const char * szFragmentCode,
+        const char * szVertexName,
+        const char * szFragmentName)
+{
+    const uint         stages[2] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    const char * const codes [2] = { szVertexCode, szFragmentCode };
+    const char * const names [2] = { szVertexName, szFragmentName };
+
+    return SubmitProgram(2, stages, codes, names);
+}
+
+/// \brief Loads a shader from the given paths
+/// \param czVertexShader The path to the vertex shader
+/// \param szGeometryShader The path to the geometry shader
+/// \param csFragmentShader The path to the fragment shader
+int ShaderCompiler::LoadShaders(
+        const char * czVertexShader,
+        const char * szGeometryShader,
+        const char * csFragmentShader)
+{
+    std::string VertexShaderCode;
+    std::string GeometryShaderCode;
+    std::string FragmentShaderCode;
+
+    if(!ReadSource(czVertexShader,   VertexShaderCode)
+    || !ReadSource(szGeometryShader, GeometryShaderCode)
+    || !ReadSource(csFragmentShader, FragmentShaderCode))
     {
-        Logger::LogError("Impossible to open %s. Are you in the right directory ?", csFragmentShader);
-        getchar();
         return 0;
     }
 
-    GLint Result = GL_FALSE;
-    int InfoLogLength;
+    const uint         stages[3] = { GL_VERTEX_SHADER, GL_GEOMETRY_SHADER, GL_FRAGMENT_SHADER };
+    const char * const codes [3] = { VertexShaderCode.c_str(), GeometryShaderCode.c_str(), FragmentShaderCode.c_str() };
+    const char * const names [3] = { czVertexShader, szGeometryShader, csFragmentShader };
 
-    // Compile Vertex IShader
-    Logger::LogInfo("Compiling shader : %s", czVertexShader);
-    char const * VertexSourcePointer = VertexShaderCode.c_str();
-    glShaderSource (VertexShaderID, 1, &VertexSourcePointer , nullptr);
-    glCompileShader(VertexShaderID);
+    return SubmitProgram(3, stages, codes, names);
+}
 
-    // Check Vertex IShader
-    glGetShaderiv(VertexShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(VertexShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+/// \brief Tells if the program is still waiting for its status check
+/* static */ bool ShaderCompiler::IsProgramPending(uint program)
+{
+    return s_pendingPrograms.find(program) != s_pendingPrograms.end();
+}
 
-    if ( InfoLogLength > 0 )
+/// \brief Tells if the driver finished to build the program
+/* static */ bool ShaderCompiler::IsProgramReady(uint program)
+{
+    if(!GLEW_KHR_parallel_shader_compile || !IsProgramPending(program))
     {
-        std::vector<char> VertexShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(VertexShaderID, InfoLogLength, nullptr, &VertexShaderErrorMessage[0]);
-        Logger::LogError("%s", &VertexShaderErrorMessage[0]);
+        return true;
     }
 
-    // Compile Fragment IShader
-    Logger::LogInfo("Compiling shader : %s", csFragmentShader);
-    char const * FragmentSourcePointer = FragmentShaderCode.c_str();
-    glShaderSource (FragmentShaderID, 1, &FragmentSourcePointer , nullptr);
-    glCompileShader(FragmentShaderID);
+    GLint Completed = GL_FALSE;
+    glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &Completed);
+
+    return Completed == GL_TRUE;
+}
 
-    // Check Fragment IShader
-    glGetShaderiv(FragmentShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(FragmentShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-    if ( InfoLogLength > 0 )
+/// \brief Waits for the program, reports its errors and releases its shaders
+/* static */ bool ShaderCompiler::FinalizeProgram(uint program)
+{
+    if(program == 0)
     {
-        std::vector<char> FragmentShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(FragmentShaderID, InfoLogLength, nullptr, &FragmentShaderErrorMessage[0]);
-        Logger::LogError("%s", &FragmentShaderErrorMessage[0]);
+        return false;
     }
 
-    // Link the program
-    GLuint ProgramID = glCreateProgram();
+    GLint Result = GL_FALSE;
+    int InfoLogLength;
+
+    auto it = s_pendingPrograms.find(program);
+    if(it == s_pendingPrograms.end())
+    {
+        // Restored from the cache or already finalized
+        glGetProgramiv(program, GL_LINK_STATUS, &Result);
+        return Result == GL_TRUE;
+    }
 
-    glAttachShader(ProgramID, VertexShaderID);
-    glAttachShader(ProgramID, FragmentShaderID);
-    glLinkProgram (ProgramID);
+    PendingProgram const& pending = it->second;
+
+    // Check shaders
+    for(size_t nShader = 0; nShader < pending.m_shaders.size(); ++nShader)
+    {
+        GLuint ShaderID = pending.m_shaders[nShader];
+
+        glGetShaderiv(ShaderID, GL_COMPILE_STATUS, &Result);
+        glGetShaderiv(ShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+
+        if(Result != GL_TRUE)
+        {
+            Logger::LogError("Cannot compile shader : %s", pending.m_names[nShader].c_str());
+        }
+
+        if ( InfoLogLength > 1 )
+        {
+            std::vector<char> ShaderErrorMessage(InfoLogLength+1);
+            glGetShaderInfoLog(ShaderID, InfoLogLength, nullptr, &ShaderErrorMessage[0]);
+            LogInfoLog(ShaderErrorMessage);
+        }
+    }
 
     // Check the program
-    glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
-    glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+    glGetProgramiv(program, GL_LINK_STATUS, &Result);
+    glGetProgramiv(program, GL_INFO_LOG_LENGTH, &InfoLogLength);
 
-    if ( InfoLogLength > 0 )
+    bool bLinked = Result == GL_TRUE;
+    if(!bLinked)
+    {
+        std::string name = pending.m_names.front();
+        for(size_t nName = 1; nName < pending.m_names.size(); ++nName)
+        {
+            name += "|";
+            name += pending.m_names[nName];
+        }
+
+        Logger::LogError("Cannot link program : %s", name.c_str());
+    }
+
+    if ( InfoLogLength > 1 )
     {
         std::vector<char> ProgramErrorMessage(InfoLogLength+1);
-        glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
-        Logger::LogError("%s\n", &ProgramErrorMessage[0]);
+        glGetProgramInfoLog(program, InfoLogLength, nullptr, &ProgramErrorMessage[0]);
+        LogInfoLog(ProgramErrorMessage);
     }
 
-    glDetachShader(ProgramID, VertexShaderID);
-    glDetachShader(ProgramID, FragmentShaderID);
+    for(uint ShaderID : pending.m_shaders)
+    {
+        glDetachShader(program, ShaderID);
+        glDeleteShader(ShaderID);
+    }
 
-    glDeleteShader(VertexShaderID);
-    glDeleteShader(FragmentShaderID);
+    if(bLinked && pending.m_bCache)
+    {
+        StoreCachedProgram(pending.m_cachePath, pending.m_cacheKey, program);
+    }
 
-    return ProgramID;
+    s_pendingPrograms.erase(it);
+    return bLinked;
 }
 
-/// \brief Loads a shader from the given paths
-/// \param czVertexShader The path to the vertex shader
-/// \param csFragmentShader The path to the fragment shader
-int ShaderCompiler::LoadShaders(
-        const char * czVertexShader,
-        const char * szGeometryShader,
-        const char * csFragmentShader)
+/// \brief Logs the info log of a shader or a program
+/* static */ void ShaderCompiler::LogInfoLog(std::vector<char> & log)
 {
-    GLuint VertexShaderID   = glCreateShader(GL_VERTEX_SHADER);
-    GLuint GeometryShaderID  = glCreateShader(GL_GEOMETRY_SHADER);
-    GLuint FragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-
-    std::string VertexShaderCode;
-    std::string GeometryShaderCode;
-    std::string FragmentShaderCode;
-
-    std::ifstream VertexShaderStream(czVertexShader, std::ios::in);
-    if(VertexShaderStream.is_open())
+    // The logger ends the line itself
+    size_t length = strlen(log.data());
+    while(length > 0 && (log[length - 1] == '\n' || log[length - 1] == '\r'))
     {
-        std::stringstream sstr;
-        sstr << VertexShaderStream.rdbuf();
-
-        VertexShaderCode = sstr.str();
-        VertexShaderStream.close();
+        log[--length] = '\0';
     }
-    else
+
+    if(length > 0)
     {
-        Logger::LogError("Impossible to open %s. Are you in the right directory ?", czVertexShader);
-        getchar();
-        return 0;
+        Logger::LogError("%s", log.data());
     }
+}
 
-    // Read the Fragment IShader code from the file
-    std::ifstream GeometryShaderStream(szGeometryShader, std::ios::in);
-    if(GeometryShaderStream.is_open())
+/// \brief Reads the source of a shader
+/* static */ bool ShaderCompiler::ReadSource(const char * szPath, std::string & code)
+{
+    std::ifstream stream(szPath, std::ios::in);
+    if(!stream.is_open())
     {
-        std::stringstream sstr;
-        sstr << GeometryShaderStream.rdbuf();
-
-        GeometryShaderCode = sstr.str();
-        GeometryShaderStream.close();
+        Logger::LogError("Impossible to open %s. Are you in the right directory ?", szPath);
+        return false;
     }
-    else
+
+    std::stringstream sstr;
+    sstr << stream.rdbuf();
+    code = sstr.str();
+
+    return true;
+}
+
+/// \brief Submits the compilation and the link of a program
+/* static */ uint ShaderCompiler::SubmitProgram(uint stageCount, const uint * pStages, const char * const * pCodes, const char * const * pNames)
+{
+    PendingProgram pending;
+    pending.m_cacheKey = 0;
+    pending.m_bCache   = ProgramCache::IsEnabled() && IsBinarySupported();
+
+    // The entry is named after the shaders and only valid for these exact sources
+    if(pending.m_bCache)
     {
-        Logger::LogError("Impossible to open %s. Are you in the right directory ?", csFragmentShader);
-        getchar();
-        return 0;
+        std::string name = pNames[0];
+        pending.m_cacheKey = ProgramCache::Hash(pCodes[0], ProgramCache::s_seed);
+
+        for(uint nStage = 1; nStage < stageCount; ++nStage)
+        {
+            name += "|";
+            name += pNames[nStage];
+            pending.m_cacheKey = ProgramCache::Hash(pCodes[nStage], pending.m_cacheKey);
+        }
+
+        pending.m_cachePath = ProgramCache::GetPath(name.c_str());
+        pending.m_cacheKey  = ProgramCache::Hash(GetDriverString().c_str(), pending.m_cacheKey);
+
+        GLuint CachedProgramID = LoadCachedProgram(pending.m_cachePath, pending.m_cacheKey);
+        if(CachedProgramID != 0)
+        {
+            Logger::LogInfo("Loaded cached program : %s", name.c_str());
+            return CachedProgramID;
+        }
     }
 
-    // Read the Fragment IShader code from the file
-    std::ifstream FragmentShaderStream(csFragmentShader, std::ios::in);
-    if(FragmentShaderStream.is_open())
+    // Nothing is queried here, the driver may work in background until FinalizeProgram
+    for(uint nStage = 0; nStage < stageCount; ++nStage)
     {
-        std::stringstream sstr;
-        sstr << FragmentShaderStream.rdbuf();
+        GLuint ShaderID = glCreateShader(pStages[nStage]);
+
+        Logger::LogInfo("Compiling shader : %s", pNames[nStage]);
+        glShaderSource (ShaderID, 1, &pCodes[nStage], nullptr);
+        glCompileShader(ShaderID);
 
-        FragmentShaderCode = sstr.str();
-        FragmentShaderStream.close();
+        pending.m_shaders.push_back(ShaderID);
+        pending.m_names.emplace_back(pNames[nStage]);
     }
-    else
+
+    // Link the program
+    GLuint ProgramID = glCreateProgram();
+
+    if(pending.m_bCache)
     {
-        Logger::LogError("Impossible to open %s. Are you in the right directory ?", csFragmentShader);
-        getchar();
-        return 0;
+        glProgramParameteri(ProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     }
 
-    GLint Result = GL_FALSE;
-    int InfoLogLength;
+    for(uint ShaderID : pending.m_shaders)
+    {
+        glAttachShader(ProgramID, ShaderID);
+    }
 
-    // Compile Vertex IShader
-    Logger::LogInfo("Compiling shader : %s", czVertexShader);
-    char const * VertexSourcePointer = VertexShaderCode.c_str();
-    glShaderSource (VertexShaderID, 1, &VertexSourcePointer , nullptr);
-    glCompileShader(VertexShaderID);
+    glLinkProgram(ProgramID);
+
+    s_pendingPrograms.emplace(ProgramID, std::move(pending));
+    return ProgramID;
+}
 
-    // Check Vertex IShader
-    glGetShaderiv(VertexShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(VertexShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
+/// \brief Returns the identification string of the driver
+/* static */ std::string const& ShaderCompiler::GetDriverString()
+{
+    static std::string driver;
 
-    if ( InfoLogLength > 0 )
+    if(driver.empty())
     {
-        std::vector<char> VertexShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(VertexShaderID, InfoLogLength, nullptr, &VertexShaderErrorMessage[0]);
-        Logger::LogError("%s", &VertexShaderErrorMessage[0]);
+        const GLubyte * pVendor   = glGetString(GL_VENDOR);
+        const GLubyte * pRenderer = glGetString(GL_RENDERER);
+        const GLubyte * pVersion  = glGetString(GL_VERSION);
+
+        driver  = pVendor   ? reinterpret_cast<const char *>(pVendor)   : "";
+        driver += "|";
+        driver += pRenderer ? reinterpret_cast<const char *>(pRenderer) : "";
+        driver += "|";
+        driver += pVersion  ? reinterpret_cast<const char *>(pVersion)  : "";
     }
 
-    // Compile Geometry IShader
-    Logger::LogInfo("Compiling shader : %s", szGeometryShader);
-    char const * GeometrySourcePointer = GeometryShaderCode.c_str();
-    glShaderSource (GeometryShaderID, 1, &GeometrySourcePointer , nullptr);
-    glCompileShader(GeometryShaderID);
+    return driver;
+}
 
-    // Check Fragment IShader
-    glGetShaderiv(GeometryShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(GeometryShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-    if ( InfoLogLength > 0 )
+/// \brief Tells if the driver can save and restore program binaries
+/* static */ bool ShaderCompiler::IsBinarySupported()
+{
+    if(!GLEW_ARB_get_program_binary)
     {
-        std::vector<char> GeometryShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(GeometryShaderID, InfoLogLength, nullptr, &GeometryShaderErrorMessage[0]);
-        Logger::LogError("%s", &GeometryShaderErrorMessage[0]);
+        return false;
     }
 
+    // Some drivers expose the extension without any format
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
 
-    // Compile Fragment IShader
-    Logger::LogInfo("Compiling shader : %s", csFragmentShader);
-    char const * FragmentSourcePointer = FragmentShaderCode.c_str();
-    glShaderSource (FragmentShaderID, 1, &FragmentSourcePointer , nullptr);
-    glCompileShader(FragmentShaderID);
+    return formatCount > 0;
+}
+
+/// \brief Creates a program from a cached binary
+/* static */ uint ShaderCompiler::LoadCachedProgram(std::string const& path, uint64 key)
+{
+    uint32            format = 0;
+    std::vector<char> binary;
 
-    // Check Fragment IShader
-    glGetShaderiv(FragmentShaderID, GL_COMPILE_STATUS, &Result);
-    glGetShaderiv(FragmentShaderID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-    if ( InfoLogLength > 0 )
+    if(!ProgramCache::ReadEntry(path, key, format, binary))
     {
-        std::vector<char> FragmentShaderErrorMessage(InfoLogLength+1);
-        glGetShaderInfoLog(FragmentShaderID, InfoLogLength, nullptr, &FragmentShaderErrorMessage[0]);
-        Logger::LogError("%s", &FragmentShaderErrorMessage[0]);
+        return 0;
     }
 
-    // Link the program
     GLuint ProgramID = glCreateProgram();
+    glProgramBinary(ProgramID, format, binary.data(), static_cast<GLsizei>(binary.size()));
 
-    glAttachShader(ProgramID, VertexShaderID);
-    glAttachShader(ProgramID, GeometryShaderID);
-    glAttachShader(ProgramID, FragmentShaderID);
-    glLinkProgram (ProgramID);
-
-    // Check the program
+    // The driver may reject a binary it produced, e.g. after an update
+    GLint Result = GL_FALSE;
     glGetProgramiv(ProgramID, GL_LINK_STATUS, &Result);
-    glGetProgramiv(ProgramID, GL_INFO_LOG_LENGTH, &InfoLogLength);
-
-    if ( InfoLogLength > 0 )
+    if(Result != GL_TRUE)
     {
-        std::vector<char> ProgramErrorMessage(InfoLogLength+1);
-        glGetProgramInfoLog(ProgramID, InfoLogLength, NULL, &ProgramErrorMessage[0]);
-        Logger::LogError("%s\n", &ProgramErrorMessage[0]);
+        Logger::LogWaring("Rejected cached program %s, recompiling", path.c_str());
+
+        glDeleteProgram(ProgramID);
+        ProgramCache::RemoveEntry(path);
+        return 0;
     }
 
-    glDetachShader(ProgramID, VertexShaderID);
-    glDetachShader(ProgramID, GeometryShaderID);
-    glDetachShader(ProgramID, FragmentShaderID);
+    return ProgramID;
+}
+
+/// \brief Saves the binary of a linked program in the cache
+/* static */ void ShaderCompiler::StoreCachedProgram(std::string const& path, uint64 key, uint program)
+{
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if(binaryLength <= 0)
+    {
+        return;
+    }
 
-    glDeleteShader(VertexShaderID);
-    glDeleteShader(GeometryShaderID);
-    glDeleteShader(FragmentShaderID);
+    GLenum            format = 0;
+    std::vector<char> binary(static_cast<size_t>(binaryLength));
+    glGetProgramBinary(program, binaryLength, nullptr, &format, binary.data());
 
-    return ProgramID;
+    if(!ProgramCache::WriteEntry(path, key, format, binary))
+    {
+        Logger::LogWaring("Cannot write the cached program %s", path.c_str());
+    }
 }
 
 } // !namespace
@@ -23,7 +23,9 @@
 
 #include "Runtime/Core/Debug/Logger.hpp"
 #include "Runtime/Core/Assertion/Assert.hh"
+#include "Runtime/Rendering/Shader/IShader.hpp"
 #include "Runtime/Rendering/Shader/ShaderManager.hpp"
+#include "Runtime/Rendering/Shader/ShaderCompiler.hpp"
 
 /// \namespace cardinal
 namespace cardinal
@@ -44,6 +46,7 @@ ShaderManager::ShaderManager()
     if(ShaderManager::s_pInstance == nullptr)
     {
         ShaderManager::s_pInstance = new ShaderManager();
+        ShaderCompiler::Initialize();
         Logger::LogInfo("Shader manager successfully initialized");
     }
     else
@@ -78,7 +81,9 @@ ShaderManager::ShaderManager()
     ASSERT_NE      (shaderKey, "");
     ASSERT_NOT_NULL(ShaderManager::s_pInstance);
 
-    ShaderManager::s_pInstance->m_textureIDs.emplace(shaderKey, shaderID);
+    // The program may still be building, it is finalized on its first use
+    ShaderEntry entry = { shaderID, false };
+    ShaderManager::s_pInstance->m_textureIDs.emplace(shaderKey, entry);
 }
 
 /// \brief Unregisters a shader in the manager
@@ -92,6 +97,16 @@ ShaderManager::ShaderManager()
     auto it = ShaderManager::s_pInstance->m_textureIDs.find(shaderKey);
     if(it != ShaderManager::s_pInstance->m_textureIDs.end())
     {
+        if(it->second.m_bFinalized)
+        {
+            IShader::ReleaseUniforms(it->second.m_shaderID);
+        }
+        else
+        {
+            // Releases the shaders of the program
+            ShaderCompiler::FinalizeProgram((uint)it->second.m_shaderID);
+        }
+
         ShaderManager::s_pInstance->m_textureIDs.erase(it);
     }
 }
@@ -108,7 +123,23 @@ ShaderManager::ShaderManager()
 
     if(it != ShaderManager::s_pInstance->m_textureIDs.end())
     {
-        id = it->second;
+        ShaderEntry & entry = it->second;
+        if(!entry.m_bFinalized)
+        {
+            entry.m_bFinalized = true;
+
+            // The program is linked, its uniforms are resolved once and for all
+            if(ShaderCompiler::FinalizeProgram((uint)entry.m_shaderID))
+            {
+                IShader::ResolveUniforms(entry.m_shaderID);
+            }
+            else
+            {
+                Logger::LogError("The shader %s failed to build", shaderKey.c_str());
+            }
+        }
+
+        id = entry.m_shaderID;
     }
     else
     {
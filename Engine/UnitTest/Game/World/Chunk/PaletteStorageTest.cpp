@@ -0,0 +1,218 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PaletteStorageTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Game/World/Chunk
+/// \author     Vincent STEHLY--CALISTO
+
+#include <random>
+#include <vector>
+
+#include "World/Chunk/PaletteStorage.hpp"
+
+#include "gtest/gtest.h"
+
+namespace
+{
+
+const uint s_size = WorldSettings::s_chunkSize;
+
+/// \brief The dense cubes of a chunk, like Chunk::m_cubes
+typedef ByteCube DenseCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+
+/// \brief Returns the storage index of the cube, like Chunk::GetCube
+uint GetIndex(uint x, uint y, uint z)
+{
+    return (x * s_size + y) * s_size + z;
+}
+
+/// \brief Returns a cube among the given number of distinct cubes
+ByteCube GetCube(uint kind)
+{
+    ByteCube cube;
+    cube.SetType(static_cast<ByteCube::EType>((kind / 2) << 1));
+    if(kind % 2 == 1)
+    {
+        cube.Disable();
+    }
+
+    return cube;
+}
+
+/// \brief Fills the dense cubes with random cubes among the given number of distinct cubes
+void FillRandom(DenseCubes & cubes, uint kindCount, uint32_t seed)
+{
+    std::mt19937 random(seed);
+    for(uint x = 0; x < s_size; ++x)
+        for(uint y = 0; y < s_size; ++y)
+            for(uint z = 0; z < s_size; ++z)
+                cubes[x][y][z] = GetCube(random() % kindCount);
+}
+
+/// \brief A terrain like chunk : rock, dirt, grass and air layers
+void FillLayers(DenseCubes & cubes)
+{
+    for(uint x = 0; x < s_size; ++x)
+        for(uint y = 0; y < s_size; ++y)
+            for(uint z = 0; z < s_size; ++z)
+            {
+                ByteCube::EType type = z < 6 ? ByteCube::EType::Rock : z < 9 ? ByteCube::EType::Dirt : ByteCube::EType::Air;
+                cubes[x][y][z].SetType(z == 9 && (x + y) % 3 == 0 ? ByteCube::EType::Grass1 : type);
+            }
+}
+
+const uint s_kindCounts[] = { 1, 2, 3, 5, 17, 60 };
+
+}
+
+TEST(PaletteStorage, IsUniformAfterConstruction)
+{
+    PaletteStorage storage;
+    EXPECT_TRUE(storage.IsUniform());
+
+    for(uint nCube = 0; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+    {
+        ASSERT_EQ(ByteCube(), storage.Get(nCube));
+    }
+}
+
+TEST(PaletteStorage, SetCubeGetCubeMatchTheDenseCubes)
+{
+    for(uint kindCount : s_kindCounts)
+    {
+        DenseCubes    dense;
+        PaletteStorage storage;
+        std::mt19937  random(kindCount);
+
+        // Starts uniform, then grows the palette one cube at a time
+        for(int nSet = 0; nSet < 20000; ++nSet)
+        {
+            uint     x    = random() % s_size;
+            uint     y    = random() % s_size;
+            uint     z    = random() % s_size;
+            ByteCube cube = GetCube(random() % kindCount);
+
+            dense[x][y][z] = cube;
+            storage.Set(GetIndex(x, y, z), cube);
+        }
+
+        for(uint x = 0; x < s_size; ++x)
+            for(uint y = 0; y < s_size; ++y)
+                for(uint z = 0; z < s_size; ++z)
+                    ASSERT_EQ(dense[x][y][z], storage.Get(GetIndex(x, y, z))) << kindCount << " kinds";
+
+        EXPECT_EQ(kindCount == 1, storage.IsUniform());
+    }
+}
+
+TEST(PaletteStorage, CompressDecompressRoundTrip)
+{
+    for(uint kindCount : s_kindCounts)
+    {
+        DenseCubes dense;
+        FillRandom(dense, kindCount, 7 + kindCount);
+
+        // Chunk::Compress then Chunk::Decompress
+        PaletteStorage storage;
+        storage.Assign(&dense[0][0][0]);
+
+        DenseCubes extracted;
+        storage.Extract(&extracted[0][0][0]);
+
+        for(uint x = 0; x < s_size; ++x)
+            for(uint y = 0; y < s_size; ++y)
+                for(uint z = 0; z < s_size; ++z)
+                {
+                    ASSERT_EQ(dense[x][y][z], extracted[x][y][z])                << kindCount << " kinds";
+                    ASSERT_EQ(dense[x][y][z], storage.Get(GetIndex(x, y, z)))    << kindCount << " kinds";
+                }
+    }
+}
+
+TEST(PaletteStorage, EditAfterCompress)
+{
+    DenseCubes dense;
+    FillLayers(dense);
+
+    PaletteStorage storage;
+    storage.Assign(&dense[0][0][0]);
+
+    // New kinds of cubes repack the indexes without losing the others
+    dense[3][4][5] = GetCube(40);
+    dense[0][0][0] = GetCube(25);
+    dense[15][15][15] = GetCube(7);
+    storage.Set(GetIndex(3, 4, 5), dense[3][4][5]);
+    storage.Set(GetIndex(0, 0, 0), dense[0][0][0]);
+    storage.Set(GetIndex(15, 15, 15), dense[15][15][15]);
+
+    DenseCubes extracted;
+    storage.Extract(&extracted[0][0][0]);
+    for(uint nCube = 0; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+    {
+        ASSERT_EQ((&dense[0][0][0])[nCube], (&extracted[0][0][0])[nCube]);
+    }
+}
+
+TEST(PaletteStorage, FillMakesTheStorageUniform)
+{
+    DenseCubes dense;
+    FillRandom(dense, 17, 3);
+
+    PaletteStorage storage;
+    storage.Assign(&dense[0][0][0]);
+    EXPECT_FALSE(storage.IsUniform());
+
+    ByteCube air = GetCube(1);
+    storage.Fill(air);
+    EXPECT_TRUE(storage.IsUniform());
+    EXPECT_EQ(sizeof(PaletteStorage) + sizeof(ByteCube), storage.GetMemoryFootprint());
+
+    for(uint nCube = 0; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+    {
+        ASSERT_EQ(air, storage.Get(nCube));
+    }
+
+    // Uniform dense cubes are stored uniform
+    DenseCubes uniform;
+    storage.Assign(&uniform[0][0][0]);
+    EXPECT_TRUE(storage.IsUniform());
+}
+
+TEST(PaletteStorage, FootprintAgainstDenseCubes)
+{
+    const size_t denseSize = sizeof(DenseCubes);
+    EXPECT_EQ(WorldSettings::s_chunkBlockCount * sizeof(ByteCube), denseSize);
+
+    // Air or solid chunks only store one cube
+    PaletteStorage storage;
+    EXPECT_LE(storage.GetMemoryFootprint(), sizeof(PaletteStorage) + sizeof(ByteCube));
+
+    // Four kinds of cubes use 2 bits per cube
+    DenseCubes layers;
+    FillLayers(layers);
+    storage.Assign(&layers[0][0][0]);
+    EXPECT_LE(storage.GetMemoryFootprint(), sizeof(PaletteStorage) + 4 * sizeof(ByteCube) + WorldSettings::s_chunkBlockCount * 2 / 8);
+    EXPECT_LT(storage.GetMemoryFootprint(), denseSize / 2);
+
+    // The worst case, every kind of cube, is 16 bits per cube
+    DenseCubes noise;
+    FillRandom(noise, 60, 11);
+    storage.Assign(&noise[0][0][0]);
+    EXPECT_LE(storage.GetMemoryFootprint(), sizeof(PaletteStorage) + 64 * sizeof(ByteCube) + WorldSettings::s_chunkBlockCount * 16 / 8);
+}
@@ -0,0 +1,405 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainMesherTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Game/World/Chunk/Renderer
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "World/Chunk/Renderer/TerrainMesher.hpp"
+
+#include "gtest/gtest.h"
+
+namespace
+{
+
+const uint s_size = WorldSettings::s_chunkSize;
+
+/// \brief The dense cubes of a chunk, like Chunk::m_cubes
+typedef ByteCube DenseCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+
+/// \brief A unit face of the terrain, with the atlas tile drawn on it
+struct Face
+{
+    int normal[3]; ///< -1, 0 or 1 on each axis
+    int cube  [3]; ///< The cube owning the face
+    int tile  [2]; ///< The atlas tile
+
+    bool operator<(Face const& other) const
+    {
+        return std::lexicographical_compare(normal, normal + 8, other.normal, other.normal + 8);
+    }
+
+    bool operator==(Face const& other) const
+    {
+        return std::equal(normal, normal + 8, other.normal);
+    }
+};
+
+/// \brief Returns a visible cube of the given type
+ByteCube GetCube(ByteCube::EType type)
+{
+    ByteCube cube;
+    cube.SetType(type);
+    cube.Enable();
+    return cube;
+}
+
+/// \brief Returns an air cube, like World::Clean
+ByteCube GetAir()
+{
+    ByteCube air;
+    air.SetType(ByteCube::EType::Air);
+    air.Disable();
+    return air;
+}
+
+/// \brief Fills the cubes with hills of grass over dirt and rock
+void FillHills(DenseCubes & cubes)
+{
+    for(uint x = 0; x < s_size; ++x)
+    {
+        for(uint y = 0; y < s_size; ++y)
+        {
+            float wave   = std::sin(x * 0.4f) + std::cos(y * 0.3f);
+            int   height = 8 + static_cast<int>(std::lround(wave * 2.5f));
+
+            for(uint z = 0; z < s_size; ++z)
+            {
+                int depth = height - static_cast<int>(z);
+                cubes[x][y][z] = depth <  0 ? GetAir()                        :
+                                 depth == 0 ? GetCube(ByteCube::EType::Grass) :
+                                 depth <  3 ? GetCube(ByteCube::EType::Dirt)  :
+                                              GetCube(ByteCube::EType::Rock);
+            }
+        }
+    }
+}
+
+/// \brief Fills the cubes with random cubes, half of them air
+void FillRandom(DenseCubes & cubes, uint32_t seed)
+{
+    const ByteCube::EType types[] = { ByteCube::EType::Dirt, ByteCube::EType::Rock, ByteCube::EType::Sand };
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 5);
+
+    for(uint x = 0; x < s_size; ++x)
+    {
+        for(uint y = 0; y < s_size; ++y)
+        {
+            for(uint z = 0; z < s_size; ++z)
+            {
+                int value = distribution(generator);
+                cubes[x][y][z] = value < 3 ? GetAir() : GetCube(types[value - 3]);
+            }
+        }
+    }
+}
+
+/// \brief Fills the whole chunk with the given cube
+void FillUniform(DenseCubes & cubes, ByteCube const& cube)
+{
+    std::fill(&cubes[0][0][0], &cubes[0][0][0] + WorldSettings::s_chunkBlockCount, cube);
+}
+
+/// \brief Returns borders without neighbor chunks
+TerrainMesher::Borders GetNoBorders()
+{
+    TerrainMesher::Borders borders;
+    std::fill(borders.m_bNeighbor, borders.m_bNeighbor + 6, false);
+    return borders;
+}
+
+/// \brief Returns borders whose six neighbors are made of the given cube
+TerrainMesher::Borders GetUniformBorders(ByteCube const& cube)
+{
+    TerrainMesher::Borders borders;
+    std::fill(borders.m_bNeighbor, borders.m_bNeighbor + 6, true);
+    std::fill(&borders.m_cubes[0][0][0], &borders.m_cubes[0][0][0] + 6 * s_size * s_size, cube);
+    return borders;
+}
+
+/// \brief  Splits the emitted quads into unit faces
+///         Both meshers emit 6 vertices per quad, the atlas tile is the
+///         lowest UV corner, scaled by the UV layout of each mesher
+/// \return The sorted faces
+std::vector<Face> GetFaces(WorldBuffers const& buffers, size_t vertexCount, float tileScale)
+{
+    const float cubeSize = static_cast<float>(ByteCube::s_cubeSize);
+    const float half     = cubeSize / 2.0f;
+
+    std::vector<Face> faces;
+    for(size_t nQuad = 0; nQuad < vertexCount; nQuad += 6)
+    {
+        glm::vec3 normal = buffers.m_chunkNormalBuffer[nQuad];
+        glm::vec3 low    = buffers.m_chunkVertexBuffer[nQuad];
+        glm::vec3 high   = buffers.m_chunkVertexBuffer[nQuad];
+        glm::vec2 uv     = buffers.m_chunkUVsBuffer   [nQuad];
+
+        for(size_t nVertex = nQuad + 1; nVertex < nQuad + 6; ++nVertex)
+        {
+            low  = glm::min(low,  buffers.m_chunkVertexBuffer[nVertex]);
+            high = glm::max(high, buffers.m_chunkVertexBuffer[nVertex]);
+            uv   = glm::min(uv,   buffers.m_chunkUVsBuffer   [nVertex]);
+        }
+
+        int d = 0;
+        for(int axis = 1; axis < 3; ++axis)
+        {
+            if(std::abs(normal[axis]) > std::abs(normal[d]))
+            {
+                d = axis;
+            }
+        }
+
+        Face face;
+        face.tile[0] = static_cast<int>(std::lround(uv.x * tileScale));
+        face.tile[1] = static_cast<int>(std::lround(uv.y * tileScale));
+
+        int first[3];
+        int last [3];
+        for(int axis = 0; axis < 3; ++axis)
+        {
+            face.normal[axis] = static_cast<int>(std::lround(normal[axis]));
+
+            // The face lies on the plane of the cube side it belongs to
+            float lowCenter  = axis == d ? low[axis]  - normal[axis] * half : low[axis]  + half;
+            float highCenter = axis == d ? high[axis] - normal[axis] * half : high[axis] - half;
+            first[axis] = static_cast<int>(std::lround(lowCenter  / cubeSize));
+            last [axis] = static_cast<int>(std::lround(highCenter / cubeSize));
+        }
+
+        for(face.cube[0] = first[0]; face.cube[0] <= last[0]; ++face.cube[0])
+        {
+            for(face.cube[1] = first[1]; face.cube[1] <= last[1]; ++face.cube[1])
+            {
+                for(face.cube[2] = first[2]; face.cube[2] <= last[2]; ++face.cube[2])
+                {
+                    faces.push_back(face);
+                }
+            }
+        }
+    }
+
+    std::sort(faces.begin(), faces.end());
+    return faces;
+}
+
+/// \brief The geometry of a chunk batched by one of the meshers
+struct MeshResult
+{
+    size_t            vertexCount;
+    size_t            indexCount;
+    size_t            indexedVertexCount;
+    std::vector<Face> faces;
+};
+
+/// \brief Batches the chunk with the given mesher
+MeshResult Mesh(DenseCubes & cubes, TerrainMesher::Borders const& borders, bool bGreedy, WorldBuffers & buffers)
+{
+    MeshResult result;
+    result.vertexCount        = TerrainMesher::Build(cubes, borders, bGreedy, buffers);
+    result.indexCount         = buffers.m_chunkIndexesBuffer.size();
+    result.indexedVertexCount = buffers.m_chunkIndexedVertexBuffer.size();
+
+    // Per face UVs are multiples of the texture step, greedy ones of the tile stride
+    result.faces = GetFaces(buffers, result.vertexCount, bGreedy ? 1.0f / 32.0f : 1.0f / WorldSettings::s_textureStep);
+
+    buffers.m_chunkIndexesBuffer.clear();
+    buffers.m_chunkIndexedUVsBuffer.clear();
+    buffers.m_chunkIndexedVertexBuffer.clear();
+    buffers.m_chunkIndexedNormalBuffer.clear();
+    return result;
+}
+
+}
+
+TEST(TerrainMesher, GreedyCoversTheSameFacesWithFewerTriangles)
+{
+    static DenseCubes cubes;
+    WorldBuffers buffers;
+
+    const uint32_t seeds[] = { 1, 2, 3 };
+    for(int nChunk = 0; nChunk < 4; ++nChunk)
+    {
+        if(nChunk == 0)
+        {
+            FillHills(cubes);
+        }
+        else
+        {
+            FillRandom(cubes, seeds[nChunk - 1]);
+        }
+
+        MeshResult faces  = Mesh(cubes, GetNoBorders(), false, buffers);
+        MeshResult greedy = Mesh(cubes, GetNoBorders(), true,  buffers);
+
+        EXPECT_EQ(0u, faces.vertexCount  % 6);
+        EXPECT_EQ(0u, greedy.vertexCount % 6);
+        EXPECT_EQ(faces.vertexCount,  faces.indexCount);
+        EXPECT_EQ(greedy.vertexCount, greedy.indexCount);
+
+        EXPECT_LT(greedy.vertexCount, faces.vertexCount) << "Chunk " << nChunk;
+        EXPECT_LT(greedy.indexedVertexCount, faces.indexedVertexCount) << "Chunk " << nChunk;
+
+        // Each face is covered once, by a quad of the same tile
+        ASSERT_EQ(faces.vertexCount / 6, faces.faces.size());
+        EXPECT_TRUE(std::adjacent_find(greedy.faces.begin(), greedy.faces.end()) == greedy.faces.end());
+        EXPECT_TRUE(faces.faces == greedy.faces) << "Chunk " << nChunk;
+    }
+}
+
+TEST(TerrainMesher, HillsAreMergedIntoLargeQuads)
+{
+    static DenseCubes cubes;
+    WorldBuffers buffers;
+    FillHills(cubes);
+
+    MeshResult faces  = Mesh(cubes, GetNoBorders(), false, buffers);
+    MeshResult greedy = Mesh(cubes, GetNoBorders(), true,  buffers);
+
+    // Smooth terrain is where greedy meshing pays off
+    EXPECT_LT(greedy.vertexCount * 3, faces.vertexCount);
+}
+
+TEST(TerrainMesher, UniformChunk)
+{
+    static DenseCubes cubes;
+    WorldBuffers buffers;
+    FillUniform(cubes, GetCube(ByteCube::EType::Rock));
+
+    // Alone, the six sides are visible
+    MeshResult faces  = Mesh(cubes, GetNoBorders(), false, buffers);
+    MeshResult greedy = Mesh(cubes, GetNoBorders(), true,  buffers);
+    EXPECT_EQ(6u * s_size * s_size * 6u, faces.vertexCount);
+    EXPECT_EQ(6u * 6u,                   greedy.vertexCount);
+    EXPECT_TRUE(faces.faces == greedy.faces);
+
+    // Surrounded by solid chunks, nothing is visible
+    TerrainMesher::Borders rock = GetUniformBorders(GetCube(ByteCube::EType::Rock));
+    EXPECT_EQ(0u, Mesh(cubes, rock, false, buffers).vertexCount);
+    EXPECT_EQ(0u, Mesh(cubes, rock, true,  buffers).vertexCount);
+
+    // Air neighbors hide nothing
+    TerrainMesher::Borders air = GetUniformBorders(GetAir());
+    EXPECT_EQ(faces.vertexCount,  Mesh(cubes, air, false, buffers).vertexCount);
+    EXPECT_EQ(greedy.vertexCount, Mesh(cubes, air, true,  buffers).vertexCount);
+
+    // Air chunk
+    FillUniform(cubes, GetAir());
+    EXPECT_EQ(0u, Mesh(cubes, GetNoBorders(), false, buffers).vertexCount);
+    EXPECT_EQ(0u, Mesh(cubes, GetNoBorders(), true,  buffers).vertexCount);
+}
+
+TEST(TerrainMesher, NeighborsHideTheFacesOnTheirSide)
+{
+    static DenseCubes cubes;
+    WorldBuffers buffers;
+    FillHills(cubes);
+
+    // Only the side of the chunk touching a solid neighbor loses its faces
+    for(int nSide = 0; nSide < 6; ++nSide)
+    {
+        TerrainMesher::Borders borders = GetUniformBorders(GetCube(ByteCube::EType::Rock));
+        std::fill(borders.m_bNeighbor, borders.m_bNeighbor + 6, false);
+        borders.m_bNeighbor[nSide] = true;
+
+        int axis     = nSide / 2;
+        int outwards = nSide % 2 == 0 ? -1 : 1;
+        int border   = nSide % 2 == 0 ?  0 : static_cast<int>(s_size) - 1;
+
+        MeshResult all    = Mesh(cubes, GetNoBorders(), false, buffers);
+        MeshResult faces  = Mesh(cubes, borders,        false, buffers);
+        MeshResult greedy = Mesh(cubes, borders,        true,  buffers);
+
+        std::vector<Face> expected;
+        for(Face const& face : all.faces)
+        {
+            if(face.normal[axis] != outwards || face.cube[axis] != border)
+            {
+                expected.push_back(face);
+            }
+        }
+
+        // The hills never reach the top of the chunk
+        if(nSide != 5)
+        {
+            EXPECT_LT(expected.size(), all.faces.size()) << "Side " << nSide;
+        }
+
+        EXPECT_TRUE(expected == faces.faces)  << "Side " << nSide;
+        EXPECT_TRUE(expected == greedy.faces) << "Side " << nSide;
+    }
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(TerrainMesherBenchmark, DISABLED_FacesVersusGreedy)
+{
+    static DenseCubes cubes;
+    WorldBuffers buffers;
+    const int iterationCount = 200;
+
+    const char * names[] = { "hills", "random" };
+    for(int nChunk = 0; nChunk < 2; ++nChunk)
+    {
+        if(nChunk == 0)
+        {
+            FillHills(cubes);
+        }
+        else
+        {
+            FillRandom(cubes, 1);
+        }
+
+        for(int nMode = 0; nMode < 2; ++nMode)
+        {
+            bool bGreedy = nMode == 1;
+
+            size_t vertexCount        = 0;
+            size_t indexedVertexCount = 0;
+            auto begin = std::chrono::steady_clock::now();
+            for(int nIteration = 0; nIteration < iterationCount; ++nIteration)
+            {
+                vertexCount        = TerrainMesher::Build(cubes, GetNoBorders(), bGreedy, buffers);
+                indexedVertexCount = buffers.m_chunkIndexedVertexBuffer.size();
+
+                // Like TerrainRenderer::Batch once the mesh is stored
+                buffers.m_chunkIndexesBuffer.clear();
+                buffers.m_chunkIndexedUVsBuffer.clear();
+                buffers.m_chunkIndexedVertexBuffer.clear();
+                buffers.m_chunkIndexedNormalBuffer.clear();
+            }
+
+            auto   end     = std::chrono::steady_clock::now();
+            double elapsed = std::chrono::duration<double, std::micro>(end - begin).count() / iterationCount;
+
+            printf("%-6s %-8s : %6u triangles, %6u indexed vertices, %8.1f us per chunk\n",
+                   names[nChunk], bGreedy ? "greedy" : "per face",
+                   static_cast<unsigned>(vertexCount / 3),
+                   static_cast<unsigned>(indexedVertexCount),
+                   elapsed);
+        }
+    }
+}
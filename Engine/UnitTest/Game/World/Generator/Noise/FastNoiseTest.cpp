@@ -0,0 +1,200 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       FastNoiseTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Game/World/Generator/Noise
+/// \author     Vincent STEHLY--CALISTO
+
+#include <chrono>
+#include <vector>
+#include <cstdio>
+#include <algorithm>
+
+#include "World/Generator/Noise/FastNoise.h"
+
+#include "gtest/gtest.h"
+
+namespace
+{
+
+/// \brief The largest difference allowed between the SSE2 and the scalar paths
+const float s_tolerance = 1e-5f;
+
+/// \brief A noise type vectorized by FillNoiseGrid, with the fractal type it uses
+struct GridCase
+{
+    const char *           name;
+    FastNoise::NoiseType   noiseType;
+    FastNoise::FractalType fractalType;
+};
+
+const GridCase s_cases[] =
+{
+    { "Perlin",                    FastNoise::Perlin,         FastNoise::FBM        },
+    { "PerlinFractal FBM",         FastNoise::PerlinFractal,  FastNoise::FBM        },
+    { "PerlinFractal Billow",      FastNoise::PerlinFractal,  FastNoise::Billow     },
+    { "PerlinFractal RigidMulti",  FastNoise::PerlinFractal,  FastNoise::RigidMulti },
+    { "Simplex",                   FastNoise::Simplex,        FastNoise::FBM        },
+    { "SimplexFractal FBM",        FastNoise::SimplexFractal, FastNoise::FBM        },
+    { "SimplexFractal Billow",     FastNoise::SimplexFractal, FastNoise::Billow     },
+    { "SimplexFractal RigidMulti", FastNoise::SimplexFractal, FastNoise::RigidMulti }
+};
+
+const FastNoise::Interp s_interps[] = { FastNoise::Linear, FastNoise::Hermite, FastNoise::Quintic };
+
+// Odd sizes leave a tail of 1 to 3 samples after the last full SSE2 vector
+const int   s_width  = 37;
+const int   s_height = 23;
+const int   s_depth  = 9;
+
+// The grid straddles the origin to cover FastFloor on negative coordinates
+const float s_x0     = -13.7f;
+const float s_y0     =  41.3f;
+const float s_z0     =  -5.2f;
+const float s_step   =  0.75f;
+
+/// \brief Returns a noise of the given case
+FastNoise CreateNoise(GridCase const& gridCase, FastNoise::Interp interp, bool bSIMD)
+{
+    FastNoise noise(4242);
+    noise.SetNoiseType     (gridCase.noiseType);
+    noise.SetFractalType   (gridCase.fractalType);
+    noise.SetInterp        (interp);
+    noise.SetFrequency     (0.05f);
+    noise.SetFractalOctaves(4);
+    noise.SetGridSIMD      (bSIMD);
+    return noise;
+}
+
+/// \brief Checks the 2D grid against GetNoise sample by sample
+void Check2D(FastNoise const& noise, const char * name)
+{
+    std::vector<float> grid(s_width * s_height);
+    noise.FillNoiseGrid(grid.data(), s_x0, s_y0, s_width, s_height, s_step);
+
+    for(int j = 0; j < s_height; ++j)
+    {
+        for(int i = 0; i < s_width; ++i)
+        {
+            float expected = noise.GetNoise(s_x0 + i * s_step, s_y0 + j * s_step);
+            ASSERT_NEAR(expected, grid[j * s_width + i], s_tolerance)
+                << name << " interp " << noise.GetInterp() << " at (" << i << ", " << j << ")";
+        }
+    }
+}
+
+/// \brief Checks the 3D grid against GetNoise sample by sample
+void Check3D(FastNoise const& noise, const char * name)
+{
+    std::vector<float> grid(s_width * s_height * s_depth);
+    noise.FillNoiseGrid(grid.data(), s_x0, s_y0, s_z0, s_width, s_height, s_depth, s_step);
+
+    for(int k = 0; k < s_depth; ++k)
+    {
+        for(int j = 0; j < s_height; ++j)
+        {
+            for(int i = 0; i < s_width; ++i)
+            {
+                float expected = noise.GetNoise(s_x0 + i * s_step, s_y0 + j * s_step, s_z0 + k * s_step);
+                ASSERT_NEAR(expected, grid[(k * s_height + j) * s_width + i], s_tolerance)
+                    << name << " interp " << noise.GetInterp() << " at (" << i << ", " << j << ", " << k << ")";
+            }
+        }
+    }
+}
+
+/// \brief  Fills the grid repeatedly
+/// \return The best time of the runs, in milliseconds
+double TimeGrid(FastNoise const& noise, std::vector<float> & grid, int size, bool b3D)
+{
+    double best = 1e9;
+    for(int nRun = 0; nRun < 5; ++nRun)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        if(b3D)
+        {
+            noise.FillNoiseGrid(grid.data(), 0.0f, 0.0f, 0.0f, size, size, size);
+        }
+        else
+        {
+            noise.FillNoiseGrid(grid.data(), 0.0f, 0.0f, size, size);
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(end - begin).count());
+    }
+
+    return best;
+}
+
+}
+
+TEST(FastNoise, GridSIMDMatchesGetNoise2D)
+{
+    printf("SSE2 grid path %s\n", FastNoise::IsGridSIMDSupported() ? "enabled" : "not supported");
+
+    for(GridCase const& gridCase : s_cases)
+    {
+        for(FastNoise::Interp interp : s_interps)
+        {
+            Check2D(CreateNoise(gridCase, interp, true), gridCase.name);
+        }
+    }
+}
+
+TEST(FastNoise, GridSIMDMatchesGetNoise3D)
+{
+    for(GridCase const& gridCase : s_cases)
+    {
+        for(FastNoise::Interp interp : s_interps)
+        {
+            Check3D(CreateNoise(gridCase, interp, true), gridCase.name);
+        }
+    }
+}
+
+TEST(FastNoise, GridScalarMatchesGetNoise)
+{
+    // Types without a SIMD path and the forced scalar path go through GetNoise
+    GridCase value    = { "Value",    FastNoise::Value,    FastNoise::FBM };
+    GridCase cellular = { "Cellular", FastNoise::Cellular, FastNoise::FBM };
+
+    Check2D(CreateNoise(value,      FastNoise::Quintic, true),  value.name);
+    Check3D(CreateNoise(cellular,   FastNoise::Quintic, true),  cellular.name);
+    Check3D(CreateNoise(s_cases[5], FastNoise::Quintic, false), s_cases[5].name);
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(FastNoiseBenchmark, DISABLED_GridSIMDVersusScalar)
+{
+    const int size2D = 1024;
+    const int size3D = 128;
+    std::vector<float> grid(std::max(size2D * size2D, size3D * size3D * size3D));
+
+    for(GridCase const& gridCase : s_cases)
+    {
+        FastNoise simd   = CreateNoise(gridCase, FastNoise::Quintic, true);
+        FastNoise scalar = CreateNoise(gridCase, FastNoise::Quintic, false);
+
+        printf("%-26s 3D %d^3 %6.1f ms vs %6.1f ms, 2D %d^2 %6.1f ms vs %6.1f ms\n",
+               gridCase.name,
+               size3D, TimeGrid(simd, grid, size3D, true),  TimeGrid(scalar, grid, size3D, true),
+               size2D, TimeGrid(simd, grid, size2D, false), TimeGrid(scalar, grid, size2D, false));
+    }
+}
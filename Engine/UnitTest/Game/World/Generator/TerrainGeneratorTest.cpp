@@ -0,0 +1,207 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainGeneratorTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Game/World/Generator
+/// \author     Vincent STEHLY--CALISTO
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "World/Generator/TerrainGenerator.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const int s_size        = static_cast<int>(WorldSettings::s_chunkSize);
+const int s_blockCount  = static_cast<int>(WorldSettings::s_chunkBlockCount);
+const int s_columnCount = static_cast<int>(WorldSettings::s_matSize);
+const int s_chunkCount  = static_cast<int>(WorldSettings::s_matHeight);
+
+/// \brief The heights and the cubes of a world, like World::m_worldHeights and World::m_chunks
+struct GeneratedWorld
+{
+    std::vector<int>      heights;
+    std::vector<ByteCube> cubes;
+
+    GeneratedWorld()
+    : heights(WorldSettings::s_matSizeCubes * WorldSettings::s_matSizeCubes)
+    , cubes  (static_cast<size_t>(s_columnCount * s_columnCount * s_chunkCount) * s_blockCount)
+    {
+        // None
+    }
+
+    size_t GetChunkOffset(int chunkX, int chunkY, int chunkZ) const
+    {
+        return static_cast<size_t>(((chunkX * s_columnCount + chunkY) * s_chunkCount + chunkZ) * s_blockCount);
+    }
+};
+
+/// \brief Generates the world like BasicWorldGenerator::generateTerrain
+void GenerateWorld(TerrainGenerator const& terrain, size_t threadCount, GeneratedWorld & world)
+{
+    WorkerPool pool;
+    pool.Initialize(threadCount);
+
+    terrain.GenerateRegion(pool, s_columnCount, s_columnCount, s_chunkCount,
+                           [&world](int chunkX, int chunkY, int const* pHeights, ByteCube const* pCubes)
+    {
+        for(int x = 0; x < s_size; ++x)
+        {
+            for(int y = 0; y < s_size; ++y)
+            {
+                world.heights[(chunkX * s_size + x) * WorldSettings::s_matSizeCubes + chunkY * s_size + y] = pHeights[x * s_size + y];
+            }
+        }
+
+        std::copy(pCubes, pCubes + s_chunkCount * s_blockCount, world.cubes.begin() + world.GetChunkOffset(chunkX, chunkY, 0));
+    });
+}
+
+/// \brief FNV-1a over the bytes
+uint64_t Hash(void const* pData, size_t size, uint64_t hash = 1469598103934665603ull)
+{
+    auto const* pBytes = static_cast<unsigned char const *>(pData);
+    for(size_t nByte = 0; nByte < size; ++nByte)
+    {
+        hash ^= pBytes[nByte];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+/// \brief Hashes the heights then the cubes of the world
+uint64_t Hash(GeneratedWorld const& world)
+{
+    uint64_t hash = Hash(world.heights.data(), world.heights.size() * sizeof(int));
+    return Hash(world.cubes.data(), world.cubes.size() * sizeof(ByteCube), hash);
+}
+
+/// \brief Counts the cubes of the given type
+int Count(ByteCube const* pCubes, size_t count, ByteCube::EType type)
+{
+    int matches = 0;
+    for(size_t nCube = 0; nCube < count; ++nCube)
+    {
+        matches += pCubes[nCube].GetType() == type ? 1 : 0;
+    }
+
+    return matches;
+}
+
+GenerationSettings GetSettings(int seed)
+{
+    GenerationSettings settings;
+    settings.seed    = seed;
+    settings.octaves = 3;
+    return settings;
+}
+
+}
+
+TEST(TerrainGenerator, SameWorldForAnyThreadCount)
+{
+    TerrainGenerator terrain(GetSettings(1337), 70.0f / 64.0f);
+
+    GeneratedWorld reference;
+    GenerateWorld(terrain, 1, reference);
+    const uint64_t referenceHash = Hash(reference);
+
+    const size_t threadCounts[] = { 2, 4, 8 };
+    for(size_t threadCount : threadCounts)
+    {
+        GeneratedWorld world;
+        GenerateWorld(terrain, threadCount, world);
+
+        EXPECT_EQ(reference.heights, world.heights) << threadCount << " threads";
+        EXPECT_EQ(referenceHash, Hash(world))       << threadCount << " threads";
+    }
+}
+
+TEST(TerrainGenerator, SameWorldForTheSameSeed)
+{
+    GeneratedWorld first, second, other;
+    GenerateWorld(TerrainGenerator(GetSettings(7), 1.0f), 4, first);
+    GenerateWorld(TerrainGenerator(GetSettings(7), 1.0f), 4, second);
+    GenerateWorld(TerrainGenerator(GetSettings(8), 1.0f), 4, other);
+
+    EXPECT_EQ(Hash(first), Hash(second));
+    EXPECT_NE(Hash(first), Hash(other));
+}
+
+TEST(TerrainGenerator, ChunksMatchTheirColumn)
+{
+    TerrainGenerator terrain(GetSettings(42), 3.0f);
+
+    // In the world, and out of it as the streamed chunks
+    const glm::tvec3<int> columns[] = { {0, 0, 0}, {3, 5, 0}, {7, 7, 0}, {-4, 2, 0}, {12, -9, 0} };
+    for(glm::tvec3<int> const& column : columns)
+    {
+        std::vector<int>      heights(s_size * s_size);
+        std::vector<ByteCube> columnCubes(static_cast<size_t>(s_chunkCount) * s_blockCount);
+        terrain.GenerateColumn(column.x, column.y, s_chunkCount, heights.data(), columnCubes.data());
+
+        for(int chunkZ = 0; chunkZ < s_chunkCount; ++chunkZ)
+        {
+            std::vector<ByteCube> chunkCubes(s_blockCount);
+            terrain.GenerateChunk(glm::tvec3<int>(column.x, column.y, chunkZ), chunkCubes.data());
+
+            EXPECT_TRUE(std::equal(chunkCubes.begin(), chunkCubes.end(), columnCubes.begin() + chunkZ * s_blockCount))
+                << "chunk " << column.x << " " << column.y << " " << chunkZ;
+        }
+    }
+}
+
+TEST(TerrainGenerator, StacksFollowTheHeights)
+{
+    TerrainGenerator terrain(GetSettings(5), 70.0f / 64.0f);
+
+    GeneratedWorld world;
+    GenerateWorld(terrain, 4, world);
+
+    for(int x = 0; x < static_cast<int>(WorldSettings::s_matSizeCubes); ++x)
+    {
+        for(int y = 0; y < static_cast<int>(WorldSettings::s_matSizeCubes); ++y)
+        {
+            const int height = world.heights[x * WorldSettings::s_matSizeCubes + y];
+            ASSERT_GE(height, 1);
+            ASSERT_LE(height, static_cast<int>(WorldSettings::s_matHeightCubes));
+
+            ByteCube const* pChunks = world.cubes.data() + world.GetChunkOffset(x / s_size, y / s_size, 0);
+            for(int z = 0; z < height - 3; ++z)
+            {
+                ByteCube const& cube = pChunks[(z / s_size) * s_blockCount + ((x % s_size) * s_size + y % s_size) * s_size + z % s_size];
+                ASSERT_EQ(ByteCube::EType::Rock, cube.GetType());
+                ASSERT_TRUE(cube.IsVisible());
+            }
+        }
+    }
+
+    // About 70 trees of 4 wood cubes, less the ones under the leaves of other trees
+    const int woodCount = Count(world.cubes.data(), world.cubes.size(), ByteCube::EType::Wood1);
+    EXPECT_GT(woodCount, 3 * 40);
+    EXPECT_LT(woodCount, 3 * 100);
+    EXPECT_GT(Count(world.cubes.data(), world.cubes.size(), ByteCube::EType::Grass1), 0);
+}
@@ -0,0 +1,325 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       WorkerPoolTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Core/Thread
+/// \author     Vincent STEHLY--CALISTO
+
+#include <vector>
+#include <chrono>
+#include <random>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include "Runtime/Core/Thread/WorkerPool.hpp"
+#include "Runtime/Rendering/Particle/ParticleSimulation.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief The update of a ParticleSystem without its renderer
+struct Emitter
+{
+    static const int s_jobSize = 16384; ///< Same slices as ParticleSystem
+
+    ParticleBuffer     particles;
+    std::mt19937       generator;
+    std::vector<int>   jobWritten;
+    std::vector<float> positions;
+    std::vector<float> colors;
+    int                liveParticles;
+    int                simulatedParticles;
+    int                billboardCount;
+    int                emissionRate;
+
+    Emitter(int capacity, int rate, uint32_t seed)
+    : generator(seed)
+    , liveParticles(0)
+    , simulatedParticles(0)
+    , billboardCount(0)
+    , emissionRate(rate)
+    {
+        particles.Allocate(capacity);
+        positions.resize(static_cast<size_t>(capacity) * 4);
+        colors.resize   (static_cast<size_t>(capacity) * 3);
+    }
+
+    void Emit(float dt)
+    {
+        std::uniform_real_distribution<float> random(-1.0f, 1.0f);
+
+        int particleToEmit = static_cast<int>(dt * static_cast<float>(emissionRate));
+        for(int i = 0; i < particleToEmit && liveParticles < particles.GetCapacity(); ++i)
+        {
+            int index = liveParticles++;
+            particles.size     [index] = 1.0f;
+            particles.lifeTime [index] = 0.6f + 0.4f * random(generator);
+            particles.positionX[index] = random(generator);
+            particles.positionY[index] = random(generator);
+            particles.positionZ[index] = 0.0f;
+            particles.velocityX[index] = random(generator);
+            particles.velocityY[index] = random(generator);
+            particles.velocityZ[index] = 5.0f + random(generator);
+            particles.colorR   [index] = 1.0f;
+            particles.colorG   [index] = 0.5f;
+            particles.colorB   [index] = 0.25f;
+        }
+
+        simulatedParticles = liveParticles;
+        jobWritten.assign(static_cast<size_t>(GetJobCount()), 0);
+    }
+
+    int GetJobCount() const
+    {
+        return (simulatedParticles + s_jobSize - 1) / s_jobSize;
+    }
+
+    void SimulateJob(int nJob, float dt)
+    {
+        int begin = nJob * s_jobSize;
+        int end   = std::min(begin + s_jobSize, simulatedParticles);
+
+        jobWritten[nJob] = ParticleSimulation::Simulate(
+                particles, begin, end, glm::vec3(0.0f, 0.0f, -9.81f), dt,
+                positions.data() + begin * 4, colors.data() + begin * 3);
+    }
+
+    void EndUpdate()
+    {
+        billboardCount     = ParticleSimulation::PackJobs(positions.data(), colors.data(), jobWritten.data(), GetJobCount(), s_jobSize);
+        liveParticles      = particles.Compact(simulatedParticles);
+        simulatedParticles = 0;
+    }
+};
+
+/// \brief Same steps as RenderingEngine::UpdateParticleSystems
+void UpdateEmitters(WorkerPool & pool, std::vector<Emitter *> const& emitters, float dt)
+{
+    pool.ParallelFor(static_cast<int>(emitters.size()), [&emitters, dt](int nEmitter)
+    {
+        emitters[nEmitter]->Emit(dt);
+    });
+
+    std::vector<std::pair<Emitter *, int>> jobs;
+    for(Emitter * pEmitter : emitters)
+    {
+        for(int nJob = 0; nJob < pEmitter->GetJobCount(); ++nJob)
+        {
+            jobs.emplace_back(pEmitter, nJob);
+        }
+    }
+
+    pool.ParallelFor(static_cast<int>(jobs.size()), [&jobs, dt](int nJob)
+    {
+        jobs[nJob].first->SimulateJob(jobs[nJob].second, dt);
+    });
+
+    for(Emitter * pEmitter : emitters)
+    {
+        pEmitter->EndUpdate();
+    }
+}
+
+/// \brief FNV-1a over the bytes
+uint64_t Hash(void const* pData, size_t size, uint64_t hash)
+{
+    auto const* pBytes = static_cast<unsigned char const *>(pData);
+    for(size_t nByte = 0; nByte < size; ++nByte)
+    {
+        hash ^= pBytes[nByte];
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+/// \brief Runs the emitters for some frames and hashes their billboards
+uint64_t HashBillboards(size_t threadCount, int frameCount, int capacity, int rate)
+{
+    WorkerPool pool;
+    pool.Initialize(threadCount);
+
+    std::vector<Emitter *> emitters;
+    for(uint32_t nEmitter = 0; nEmitter < 4; ++nEmitter)
+    {
+        emitters.push_back(new Emitter(capacity, rate, 42 + nEmitter));
+    }
+
+    uint64_t hash = 1469598103934665603ull;
+    for(int nFrame = 0; nFrame < frameCount; ++nFrame)
+    {
+        UpdateEmitters(pool, emitters, 1.0f / 60.0f);
+        for(Emitter * pEmitter : emitters)
+        {
+            hash = Hash(&pEmitter->billboardCount, sizeof(int), hash);
+            if(nFrame % 10 == 9)
+            {
+                hash = Hash(pEmitter->positions.data(), pEmitter->billboardCount * 4 * sizeof(float), hash);
+                hash = Hash(pEmitter->colors.data(),    pEmitter->billboardCount * 3 * sizeof(float), hash);
+            }
+        }
+    }
+
+    for(Emitter * pEmitter : emitters)
+    {
+        delete pEmitter;
+    }
+
+    return hash;
+}
+
+}
+
+TEST(WorkerPool, RunsEachJobOnce)
+{
+    const size_t threadCounts[] = { 1, 2, 4, 8 };
+    for(size_t threadCount : threadCounts)
+    {
+        WorkerPool pool;
+        pool.Initialize(threadCount);
+        EXPECT_EQ(threadCount, pool.GetThreadCount());
+
+        std::vector<std::atomic<int>> runs(1000);
+        for(int nBatch = 0; nBatch < 50; ++nBatch)
+        {
+            pool.ParallelFor(static_cast<int>(runs.size()), [&runs](int nJob)
+            {
+                runs[nJob]++;
+            });
+        }
+
+        for(std::atomic<int> const& run : runs)
+        {
+            EXPECT_EQ(50, run.load());
+        }
+    }
+}
+
+TEST(WorkerPool, ReinitializesAndShutsDown)
+{
+    WorkerPool pool;
+    pool.Initialize(4);
+
+    std::atomic<int> sum(0);
+    pool.ParallelFor(100, [&sum](int nJob) { sum += nJob; });
+
+    pool.Initialize(2);
+    EXPECT_EQ(2u, pool.GetThreadCount());
+    pool.ParallelFor(100, [&sum](int nJob) { sum += nJob; });
+
+    // Without workers the caller runs the jobs
+    pool.Shutdown();
+    EXPECT_EQ(1u, pool.GetThreadCount());
+    pool.ParallelFor(100, [&sum](int nJob) { sum += nJob; });
+
+    EXPECT_EQ(3 * 4950, sum.load());
+}
+
+TEST(WorkerPool, NewWorkersIgnorePastBatches)
+{
+    WorkerPool pool;
+
+    // Workers started after some batches must wait for the next one
+    for(int nRestart = 0; nRestart < 500; ++nRestart)
+    {
+        pool.Initialize(4);
+
+        for(int nBatch = 0; nBatch < 3; ++nBatch)
+        {
+            std::vector<std::atomic<int>> runs(64);
+            pool.ParallelFor(static_cast<int>(runs.size()), [&runs](int nJob)
+            {
+                runs[nJob]++;
+            });
+
+            for(std::atomic<int> const& run : runs)
+            {
+                ASSERT_EQ(1, run.load()) << "Restart " << nRestart;
+            }
+        }
+    }
+}
+
+TEST(WorkerPool, SameBillboardsForAnyThreadCount)
+{
+    // Several slices per emitter once the pools are full
+    const uint64_t reference = HashBillboards(1, 60, 60000, 100000);
+
+    const size_t threadCounts[] = { 2, 4, 8 };
+    for(size_t threadCount : threadCounts)
+    {
+        EXPECT_EQ(reference, HashBillboards(threadCount, 60, 60000, 100000)) << threadCount << " threads";
+    }
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(WorkerPoolBenchmark, DISABLED_ParticleUpdateScaling)
+{
+    const size_t threadCounts[] = { 1, 2, 4, 8 };
+    const int    frameCount     = 120;
+
+    double referenceMs = 0.0;
+    for(size_t threadCount : threadCounts)
+    {
+        WorkerPool pool;
+        pool.Initialize(threadCount);
+
+        // One heavy and three light emitters, about 700k particles at steady state
+        std::vector<Emitter *> emitters;
+        emitters.push_back(new Emitter(600000, 600000, 1));
+        emitters.push_back(new Emitter(200000, 200000, 2));
+        emitters.push_back(new Emitter(200000, 200000, 3));
+        emitters.push_back(new Emitter(200000, 200000, 4));
+
+        // Warming up until the pools are full
+        for(int nFrame = 0; nFrame < 60; ++nFrame)
+        {
+            UpdateEmitters(pool, emitters, 1.0f / 60.0f);
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for(int nFrame = 0; nFrame < frameCount; ++nFrame)
+        {
+            UpdateEmitters(pool, emitters, 1.0f / 60.0f);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        int liveParticles = 0;
+        for(Emitter * pEmitter : emitters)
+        {
+            liveParticles += pEmitter->liveParticles;
+            delete pEmitter;
+        }
+
+        double stepMs = std::chrono::duration<double, std::milli>(end - start).count() / frameCount;
+        if(threadCount == 1)
+        {
+            referenceMs = stepMs;
+        }
+
+        printf("%zu threads : %7d particles, %6.3f ms per step (x%.2f)\n",
+               threadCount, liveParticles, stepMs, referenceMs / stepMs);
+    }
+}
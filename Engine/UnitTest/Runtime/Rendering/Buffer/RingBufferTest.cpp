@@ -0,0 +1,264 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RingBufferTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Buffer
+/// \author     Vincent STEHLY--CALISTO
+
+#include <map>
+#include <vector>
+#include <cstring>
+
+#include "Runtime/Rendering/Buffer/RingBuffer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief What the GPU would see, outlives the storage owned by the ring
+struct GPUState
+{
+    std::vector<uchar> memory;
+    std::map<size_t, size_t> fencedRanges;  ///< Live fences and the offset they guard
+    size_t lastWrittenOffset = 0;
+    size_t fenceCount        = 0;
+    size_t waitCount         = 0;
+    size_t violationCount    = 0;            ///< Writes to a range the GPU may still read
+    bool   bSignaled         = false;        ///< The GPU is done before each wait
+    bool   bReleased         = false;
+};
+
+/// \brief CPU only storage, fences are counters
+class StubStorage : public IRingBufferStorage
+{
+public:
+
+    explicit StubStorage(GPUState & state)
+    : m_state(state)
+    {
+        // None
+    }
+
+    bool Allocate(size_t size) override
+    {
+        // The previous content may still be read through a live fence
+        if(!m_state.fencedRanges.empty())
+        {
+            m_state.violationCount++;
+        }
+
+        m_state.memory.assign(size, 0);
+        return true;
+    }
+
+    void Release() override
+    {
+        m_state.bReleased = true;
+        m_state.memory.clear();
+    }
+
+    void * MapRange(size_t offset, size_t size) override
+    {
+        EXPECT_LE(offset + size, m_state.memory.size());
+        for(auto const& fencedRange : m_state.fencedRanges)
+        {
+            if(fencedRange.second == offset)
+            {
+                m_state.violationCount++;
+            }
+        }
+
+        return m_state.memory.data() + offset;
+    }
+
+    void UnmapRange(size_t offset, size_t /* size */) override
+    {
+        m_state.lastWrittenOffset = offset;
+    }
+
+    Fence InsertFence() override
+    {
+        m_state.fenceCount++;
+        m_state.fencedRanges[m_state.fenceCount] = m_state.lastWrittenOffset;
+        return reinterpret_cast<Fence>(m_state.fenceCount);
+    }
+
+    bool WaitFence(Fence fence) override
+    {
+        size_t id = reinterpret_cast<size_t>(fence);
+        EXPECT_EQ(1u, m_state.fencedRanges.erase(id)) << "Unknown or deleted fence " << id;
+
+        m_state.waitCount++;
+        return !m_state.bSignaled;
+    }
+
+    uint GetBufferID() const override
+    {
+        return 7;
+    }
+
+private:
+
+    GPUState & m_state;
+};
+
+/// \brief Maps, writes and unmaps a region
+void Write(RingBuffer & ring, size_t size, uchar value)
+{
+    void * pData = ring.Map(size);
+    memset(pData, value, size);
+    ring.Unmap();
+}
+
+}
+
+TEST(RingBuffer, RegionsAreAlignedAndCycle)
+{
+    GPUState   state;
+    RingBuffer ring;
+    ASSERT_TRUE(ring.Initialize(new StubStorage(state), 100));
+
+    EXPECT_EQ(256u, ring.GetRegionSize());
+    EXPECT_EQ(3u * 256u, state.memory.size());
+    EXPECT_EQ(7u, ring.GetBufferID());
+
+    const size_t offsets[] = { 0, 256, 512, 0, 256, 512, 0 };
+    for(size_t nWrite = 0; nWrite < sizeof(offsets) / sizeof(offsets[0]); ++nWrite)
+    {
+        Write(ring, 100, static_cast<uchar>(nWrite + 1));
+        EXPECT_EQ(offsets[nWrite], ring.GetOffset());
+        EXPECT_EQ(nWrite + 1, state.memory[ring.GetOffset()]);
+    }
+}
+
+TEST(RingBuffer, FencesEachRegionLeft)
+{
+    GPUState   state;
+    RingBuffer ring;
+    ring.Initialize(new StubStorage(state), 256);
+
+    // The first write has nothing to fence
+    Write(ring, 256, 1);
+    EXPECT_EQ(0u, state.fenceCount);
+
+    // Then each write fences the region written before it
+    Write(ring, 256, 2);
+    Write(ring, 256, 3);
+    EXPECT_EQ(2u, state.fenceCount);
+    EXPECT_EQ(0u, state.waitCount);
+    EXPECT_EQ(0u,   state.fencedRanges[1]);
+    EXPECT_EQ(256u, state.fencedRanges[2]);
+
+    // The fourth write reuses the region 0, after its fence
+    Write(ring, 256, 4);
+    EXPECT_EQ(3u, state.fenceCount);
+    EXPECT_EQ(1u, state.waitCount);
+    EXPECT_EQ(2u, state.fencedRanges.size());
+
+    for(int nWrite = 0; nWrite < 100; ++nWrite)
+    {
+        Write(ring, 256, static_cast<uchar>(nWrite));
+        EXPECT_LE(state.fencedRanges.size(), 2u);
+    }
+
+    EXPECT_EQ(0u, state.violationCount);
+}
+
+TEST(RingBuffer, CountsTheWritesThatWaited)
+{
+    for(bool bSignaled : { true, false })
+    {
+        GPUState   state;
+        RingBuffer ring;
+        ring.Initialize(new StubStorage(state), 64);
+        state.bSignaled = bSignaled;
+
+        for(int nWrite = 0; nWrite < 10; ++nWrite)
+        {
+            Write(ring, 64, 0);
+        }
+
+        // Only the writes 4 to 10 reuse a fenced region
+        EXPECT_EQ(bSignaled ? 0u : 7u, ring.GetWaitCount());
+        EXPECT_EQ(7u, state.waitCount);
+    }
+}
+
+TEST(RingBuffer, ReserveWaitsForTheGPUBeforeReallocating)
+{
+    GPUState   state;
+    RingBuffer ring;
+    ring.Initialize(new StubStorage(state), 256);
+
+    Write(ring, 256, 1);
+    Write(ring, 256, 2);
+
+    // Smaller or equal sizes keep the storage
+    EXPECT_FALSE(ring.Reserve(100));
+    EXPECT_EQ(256u, ring.GetRegionSize());
+    EXPECT_EQ(1u, state.fencedRanges.size());
+
+    // The written regions are fenced and waited for
+    EXPECT_TRUE(ring.Reserve(1000));
+    EXPECT_EQ(1024u, ring.GetRegionSize());
+    EXPECT_EQ(3u * 1024u, state.memory.size());
+    EXPECT_EQ(2u, state.fenceCount);
+    EXPECT_TRUE(state.fencedRanges.empty());
+
+    // The ring restarts from the first region, without fence
+    Write(ring, 1000, 3);
+    EXPECT_EQ(0u, ring.GetOffset());
+    EXPECT_EQ(2u, state.fenceCount);
+    EXPECT_EQ(0u, state.violationCount);
+}
+
+TEST(RingBuffer, ReleaseWaitsForAllFences)
+{
+    GPUState state;
+    {
+        RingBuffer ring;
+        ring.Initialize(new StubStorage(state), 256);
+
+        for(int nWrite = 0; nWrite < 5; ++nWrite)
+        {
+            Write(ring, 128, 0);
+        }
+
+        EXPECT_EQ(2u, state.fencedRanges.size());
+    }
+
+    // The destructor fenced the last region and waited for all of them
+    EXPECT_TRUE(state.bReleased);
+    EXPECT_TRUE(state.fencedRanges.empty());
+    EXPECT_EQ(state.fenceCount, state.waitCount);
+}
+
+TEST(RingBuffer, EmptyWritesStillMapARange)
+{
+    GPUState   state;
+    RingBuffer ring;
+    ring.Initialize(new StubStorage(state), 16);
+
+    EXPECT_NE(nullptr, ring.Map(0));
+    ring.Unmap();
+    EXPECT_EQ(0u, ring.GetOffset());
+}
@@ -0,0 +1,166 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightBufferTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cstring>
+
+#include "Runtime/Rendering/Lighting/LightBuffer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief Reads a float of the block
+float ReadFloat(LightBuffer const& buffer, size_t offset)
+{
+    float value;
+    memcpy(&value, buffer.GetData() + offset, sizeof(float));
+    return value;
+}
+
+/// \brief Reads an int of the block
+int ReadInt(LightBuffer const& buffer, size_t offset)
+{
+    int value;
+    memcpy(&value, buffer.GetData() + offset, sizeof(int));
+    return value;
+}
+
+/// \brief Places a member with the std140 rules and returns its offset
+///        Scalars align on 4 bytes, vec3 and vec4 on 16, structures on 16
+size_t Place(size_t & offset, size_t alignment, size_t size)
+{
+    offset = (offset + alignment - 1) & ~(alignment - 1);
+    size_t memberOffset = offset;
+    offset += size;
+    return memberOffset;
+}
+
+}
+
+TEST(LightBuffer, MatchesTheStd140Rules)
+{
+    // struct PointLight { float range; float intensity; vec3 color; vec3 position; };
+    size_t pointLight = 0;
+    EXPECT_EQ( 0u, Place(pointLight,  4,  4));
+    EXPECT_EQ( 4u, Place(pointLight,  4,  4));
+    EXPECT_EQ(16u, Place(pointLight, 16, 12));
+    EXPECT_EQ(32u, Place(pointLight, 16, 12));
+    size_t stride = (pointLight + 15) & ~static_cast<size_t>(15);
+    EXPECT_EQ(LightBuffer::s_pointLightStride, stride);
+
+    // layout(std140) uniform Lights
+    size_t block = 0;
+    EXPECT_EQ( 0u, Place(block, 16, 12)); // lightDirection
+    EXPECT_EQ(12u, Place(block,  4,  4)); // lightIntensity
+    EXPECT_EQ(16u, Place(block, 16, 12)); // lightColor
+    EXPECT_EQ(28u, Place(block,  4,  4)); // ambientIntensity
+    EXPECT_EQ(32u, Place(block,  4,  4)); // pointLightCount
+    EXPECT_EQ(48u, Place(block, 16, 16)); // clusterGrid
+    EXPECT_EQ(64u, Place(block, 16, 16)); // clusterTile
+    EXPECT_EQ(LightBuffer::s_pointLightOffset, Place(block, 16, stride * LightBuffer::s_maxPointLights));
+    EXPECT_EQ(LightBuffer::s_capacity, block);
+}
+
+TEST(LightBuffer, WritesTheDirectionalLight)
+{
+    LightBuffer buffer;
+    EXPECT_EQ(80u, buffer.GetSize());
+
+    buffer.SetDirectionalLight(glm::vec3(1.0f, 2.0f, 3.0f), 4.0f, 5.0f, glm::vec3(6.0f, 7.0f, 8.0f));
+    EXPECT_EQ(1.0f, ReadFloat(buffer,  0));
+    EXPECT_EQ(2.0f, ReadFloat(buffer,  4));
+    EXPECT_EQ(3.0f, ReadFloat(buffer,  8));
+    EXPECT_EQ(4.0f, ReadFloat(buffer, 12));
+    EXPECT_EQ(6.0f, ReadFloat(buffer, 16));
+    EXPECT_EQ(7.0f, ReadFloat(buffer, 20));
+    EXPECT_EQ(8.0f, ReadFloat(buffer, 24));
+    EXPECT_EQ(5.0f, ReadFloat(buffer, 28));
+}
+
+TEST(LightBuffer, WritesTheCountAndTheClusters)
+{
+    LightBuffer buffer;
+    buffer.SetPointLightCount(3);
+    buffer.SetClusters(glm::ivec4(16, 9, 24, 1), glm::vec4(100.0f, 120.0f, 2.5f, 5.75f));
+
+    EXPECT_EQ(3, ReadInt(buffer, 32));
+    EXPECT_EQ(16, ReadInt(buffer, 48));
+    EXPECT_EQ( 9, ReadInt(buffer, 52));
+    EXPECT_EQ(24, ReadInt(buffer, 56));
+    EXPECT_EQ( 1, ReadInt(buffer, 60));
+    EXPECT_EQ(100.0f, ReadFloat(buffer, 64));
+    EXPECT_EQ(120.0f, ReadFloat(buffer, 68));
+    EXPECT_EQ(  2.5f, ReadFloat(buffer, 72));
+    EXPECT_EQ( 5.75f, ReadFloat(buffer, 76));
+
+    // The clusters do not overwrite the count
+    EXPECT_EQ(3, ReadInt(buffer, 32));
+}
+
+TEST(LightBuffer, WritesThePointLightsWithA48BytesStride)
+{
+    LightBuffer buffer;
+    buffer.SetPointLightCount(3);
+    EXPECT_EQ(80u + 3u * 48u, buffer.GetSize());
+
+    for(int nLight = 0; nLight < 3; ++nLight)
+    {
+        float value = static_cast<float>(nLight);
+        PointLightStructure light { 10.0f + value, 20.0f + value, glm::vec3(1.0f + value, 2.0f + value, 3.0f + value), glm::vec3(4.0f + value, 5.0f + value, 6.0f + value), nLight };
+        buffer.SetPointLight(nLight, light);
+    }
+
+    for(int nLight = 0; nLight < 3; ++nLight)
+    {
+        float  value  = static_cast<float>(nLight);
+        size_t offset = 80u + 48u * static_cast<size_t>(nLight);
+
+        EXPECT_EQ(10.0f + value, ReadFloat(buffer, offset +  0)); // range
+        EXPECT_EQ(20.0f + value, ReadFloat(buffer, offset +  4)); // intensity
+        EXPECT_EQ( 1.0f + value, ReadFloat(buffer, offset + 16)); // color
+        EXPECT_EQ( 2.0f + value, ReadFloat(buffer, offset + 20));
+        EXPECT_EQ( 3.0f + value, ReadFloat(buffer, offset + 24));
+        EXPECT_EQ( 4.0f + value, ReadFloat(buffer, offset + 32)); // position
+        EXPECT_EQ( 5.0f + value, ReadFloat(buffer, offset + 36));
+        EXPECT_EQ( 6.0f + value, ReadFloat(buffer, offset + 40));
+
+        // Padding
+        EXPECT_EQ(0.0f, ReadFloat(buffer, offset +  8));
+        EXPECT_EQ(0.0f, ReadFloat(buffer, offset + 12));
+        EXPECT_EQ(0.0f, ReadFloat(buffer, offset + 28));
+        EXPECT_EQ(0.0f, ReadFloat(buffer, offset + 44));
+    }
+}
+
+TEST(LightBuffer, ClampsThePointLightCount)
+{
+    LightBuffer buffer;
+    buffer.SetPointLightCount(1000);
+
+    EXPECT_EQ(LightBuffer::s_maxPointLights, buffer.GetPointLightCount());
+    EXPECT_EQ(LightBuffer::s_maxPointLights, ReadInt(buffer, 32));
+    EXPECT_EQ(LightBuffer::s_capacity, buffer.GetSize());
+}
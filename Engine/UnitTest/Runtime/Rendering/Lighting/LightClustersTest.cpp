@@ -0,0 +1,204 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       LightClustersTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "Glm/glm/ext.hpp"
+#include "Runtime/Rendering/Lighting/LightClusters.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const float s_near = 0.1f;
+const float s_far  = 2000.0f;
+
+/// \brief The projection of the demo camera
+glm::mat4 GetProjection()
+{
+    return glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, s_near, s_far);
+}
+
+/// \brief A camera above the terrain looking down at it
+glm::mat4 GetView()
+{
+    return glm::lookAt(glm::vec3(10.0f, 20.0f, 30.0f), glm::vec3(200.0f, 0.0f, -150.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+/// \brief Lights scattered around the camera, some behind it or beyond the far plane
+void GetLights(int count, std::mt19937 & random, std::vector<glm::vec3> & positions, std::vector<float> & ranges)
+{
+    std::uniform_real_distribution<float> x(-300.0f, 500.0f), y(-10.0f, 60.0f), z(-600.0f, 200.0f), range(2.0f, 40.0f);
+
+    positions.resize(static_cast<size_t>(count));
+    ranges.resize(static_cast<size_t>(count));
+    for(int nLight = 0; nLight < count; ++nLight)
+    {
+        positions[nLight] = glm::vec3(x(random), y(random), z(random));
+        ranges[nLight]    = range(random);
+    }
+}
+
+/// \brief Tells if a sphere touches a box, with the closest point of the box
+bool SphereTouchesBox(glm::vec3 const& center, float radius, glm::vec3 const& min, glm::vec3 const& max)
+{
+    float squaredDistance = 0.0f;
+    for(int nAxis = 0; nAxis < 3; ++nAxis)
+    {
+        float delta = 0.0f;
+        if(center[nAxis] < min[nAxis])      delta = min[nAxis] - center[nAxis];
+        else if(center[nAxis] > max[nAxis]) delta = center[nAxis] - max[nAxis];
+        squaredDistance += delta * delta;
+    }
+
+    return squaredDistance <= radius * radius;
+}
+
+}
+
+TEST(LightClusters, BoundsContainTheirFrustumCells)
+{
+    LightClusters clusters;
+    glm::mat4 projection = GetProjection();
+    clusters.SetProjection(projection);
+
+    // A point of the frustum falls in the bounds of the cluster the shader picks
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> ndc(-1.0f, 1.0f), depth(s_near, s_far);
+    for(int nPoint = 0; nPoint < 100000; ++nPoint)
+    {
+        float x = ndc(random), y = ndc(random), d = depth(random);
+        glm::vec3 point(x * d / projection[0][0], y * d / projection[1][1], -d);
+
+        int tileX   = std::min(static_cast<int>((x + 1.0f) * 0.5f * LightClusters::s_clusterX), LightClusters::s_clusterX - 1);
+        int tileY   = std::min(static_cast<int>((y + 1.0f) * 0.5f * LightClusters::s_clusterY), LightClusters::s_clusterY - 1);
+        int cluster = LightClusters::GetClusterIndex(tileX, tileY, clusters.GetSlice(d));
+
+        glm::vec3 min, max;
+        clusters.GetClusterBounds(cluster, min, max);
+
+        glm::vec3 epsilon(1e-3f * d);
+        ASSERT_TRUE(glm::all(glm::greaterThanEqual(point, min - epsilon)) && glm::all(glm::lessThanEqual(point, max + epsilon)))
+            << "depth " << d << ", cluster " << cluster;
+    }
+}
+
+TEST(LightClusters, SlicesSpanTheDepthRange)
+{
+    LightClusters clusters;
+    clusters.SetProjection(GetProjection());
+
+    EXPECT_EQ(0, clusters.GetSlice(s_near));
+    EXPECT_EQ(LightClusters::s_clusterZ - 1, clusters.GetSlice(s_far * 0.999f));
+    EXPECT_EQ(LightClusters::s_clusterZ - 1, clusters.GetSlice(s_far * 10.0f));
+
+    int previous = 0;
+    for(float depth = s_near; depth < s_far; depth *= 1.1f)
+    {
+        int slice = clusters.GetSlice(depth);
+        EXPECT_GE(slice, previous);
+        previous = slice;
+    }
+}
+
+TEST(LightClusters, AssignMatchesTheBruteForceSearch)
+{
+    LightClusters clusters;
+    clusters.SetProjection(GetProjection());
+
+    glm::mat4    view = GetView();
+    std::mt19937 random(11);
+
+    for(int lightCount : { 0, 1, 16, 256, 1024 })
+    {
+        std::vector<glm::vec3> positions;
+        std::vector<float>     ranges;
+        GetLights(lightCount, random, positions, ranges);
+
+        clusters.Assign(view, positions.data(), ranges.data(), lightCount);
+        std::vector<uint> const& cells   = clusters.GetCells();
+        std::vector<uint> const& indices = clusters.GetLightIndices();
+
+        // Every light against every cluster box
+        size_t pairCount = 0;
+        for(int nCluster = 0; nCluster < LightClusters::s_clusterCount; ++nCluster)
+        {
+            glm::vec3 min, max;
+            clusters.GetClusterBounds(nCluster, min, max);
+
+            std::vector<uint> expected;
+            for(int nLight = 0; nLight < lightCount; ++nLight)
+            {
+                glm::vec3 center = glm::vec3(view * glm::vec4(positions[nLight], 1.0f));
+                if(SphereTouchesBox(center, ranges[nLight], min, max))
+                {
+                    expected.push_back(static_cast<uint>(nLight));
+                }
+            }
+
+            uint offset = cells[nCluster * 2];
+            uint count  = cells[nCluster * 2 + 1];
+            ASSERT_LE(offset + count, indices.size());
+
+            std::vector<uint> assigned(indices.begin() + offset, indices.begin() + offset + count);
+            ASSERT_EQ(expected, assigned) << lightCount << " lights, cluster " << nCluster;
+            pairCount += count;
+        }
+
+        EXPECT_EQ(indices.size(), pairCount);
+    }
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(LightClustersBenchmark, DISABLED_Assign)
+{
+    LightClusters clusters;
+    clusters.SetProjection(GetProjection());
+
+    glm::mat4    view = GetView();
+    std::mt19937 random(11);
+
+    for(int lightCount : { 16, 256, 1024, 4096 })
+    {
+        std::vector<glm::vec3> positions;
+        std::vector<float>     ranges;
+        GetLights(lightCount, random, positions, ranges);
+
+        const int iterations = 50;
+        auto start = std::chrono::steady_clock::now();
+        for(int nIteration = 0; nIteration < iterations; ++nIteration)
+        {
+            clusters.Assign(view, positions.data(), ranges.data(), lightCount);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        printf("%5d lights : assign %8.1f us, %zu cluster light pairs\n", lightCount,
+               std::chrono::duration<double, std::micro>(end - start).count() / iterations,
+               clusters.GetLightIndices().size());
+    }
+}
@@ -0,0 +1,216 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PointLightGridTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "Runtime/Rendering/Lighting/PointLightGrid.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief The lights layouts of the tests
+enum class Scene
+{
+    Volume,     ///< Lights spread over the terrain height
+    Plane,      ///< All lights at the same height
+    Duplicated  ///< Lights snapped on a coarse lattice, many at the same position
+};
+
+/// \brief Returns the k nearest lights, ties broken by index
+int QueryBruteForce(std::vector<glm::vec3> const& lights, glm::vec3 const& position, int maxCount, int * pIndices)
+{
+    std::vector<std::pair<float, int>> distances;
+    distances.reserve(lights.size());
+    for(size_t nLight = 0; nLight < lights.size(); ++nLight)
+    {
+        glm::vec3 delta = lights[nLight] - position;
+        distances.emplace_back(glm::dot(delta, delta), static_cast<int>(nLight));
+    }
+
+    int count = std::min(maxCount, static_cast<int>(distances.size()));
+    std::partial_sort(distances.begin(), distances.begin() + count, distances.end());
+
+    for(int nLight = 0; nLight < count; ++nLight)
+    {
+        pIndices[nLight] = distances[nLight].second;
+    }
+
+    return count;
+}
+
+/// \brief Generates the lights of a scene
+std::vector<glm::vec3> GetLights(Scene scene, int count, std::mt19937 & random)
+{
+    std::uniform_real_distribution<float> horizontal(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> vertical  (   0.0f,  40.0f);
+
+    std::vector<glm::vec3> lights(static_cast<size_t>(count));
+    for(glm::vec3 & light : lights)
+    {
+        light = glm::vec3(horizontal(random), scene == Scene::Plane ? 5.0f : vertical(random), horizontal(random));
+        if(scene == Scene::Duplicated)
+        {
+            light = glm::round(light / 20.0f) * 20.0f;
+        }
+    }
+
+    return lights;
+}
+
+/// \brief Generates query positions, partly outside of the lights bounds
+std::vector<glm::vec3> GetQueries(int count, std::mt19937 & random)
+{
+    std::uniform_real_distribution<float> distribution(-300.0f, 300.0f);
+
+    std::vector<glm::vec3> queries(static_cast<size_t>(count));
+    for(glm::vec3 & query : queries)
+    {
+        query = glm::vec3(distribution(random), distribution(random) * 0.2f, distribution(random));
+    }
+
+    return queries;
+}
+
+}
+
+TEST(PointLightGrid, EmptyGridReturnsNoLight)
+{
+    PointLightGrid grid;
+    int indices[PointLightGrid::s_maxQueryCount];
+
+    EXPECT_EQ(0, grid.GetLightCount());
+    EXPECT_EQ(0, grid.QueryNearest(glm::vec3(0.0f), 4, indices));
+
+    grid.Build(nullptr, 0);
+    EXPECT_EQ(0, grid.QueryNearest(glm::vec3(0.0f), 4, indices));
+}
+
+TEST(PointLightGrid, MatchesTheBruteForceSearch)
+{
+    std::mt19937 random(42);
+
+    const Scene scenes[]      = { Scene::Volume, Scene::Plane, Scene::Duplicated };
+    const int   lightCounts[] = { 1, 3, 16, 100, 1000, 10000 };
+    const int   maxCounts[]   = { 1, 4, 8, PointLightGrid::s_maxQueryCount };
+
+    for(Scene scene : scenes)
+    {
+        for(int lightCount : lightCounts)
+        {
+            std::vector<glm::vec3> lights  = GetLights(scene, lightCount, random);
+            std::vector<glm::vec3> queries = GetQueries(500, random);
+
+            PointLightGrid grid;
+            grid.Build(lights.data(), lightCount);
+            ASSERT_EQ(lightCount, grid.GetLightCount());
+
+            for(int maxCount : maxCounts)
+            {
+                for(glm::vec3 const& query : queries)
+                {
+                    int gridIndices [PointLightGrid::s_maxQueryCount];
+                    int bruteIndices[PointLightGrid::s_maxQueryCount];
+
+                    int gridCount  = grid.QueryNearest(query, maxCount, gridIndices);
+                    int bruteCount = QueryBruteForce(lights, query, maxCount, bruteIndices);
+
+                    ASSERT_EQ(bruteCount, gridCount) << "scene " << static_cast<int>(scene) << ", " << lightCount << " lights";
+                    for(int nLight = 0; nLight < gridCount; ++nLight)
+                    {
+                        ASSERT_EQ(bruteIndices[nLight], gridIndices[nLight])
+                            << "scene " << static_cast<int>(scene) << ", " << lightCount << " lights, " << maxCount << " nearest";
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(PointLightGrid, RebuildForgetsThePreviousLights)
+{
+    std::vector<glm::vec3> lights { glm::vec3(0.0f), glm::vec3(10.0f), glm::vec3(-10.0f) };
+
+    PointLightGrid grid;
+    grid.Build(lights.data(), 3);
+
+    lights = { glm::vec3(100.0f, 0.0f, 0.0f) };
+    grid.Build(lights.data(), 1);
+
+    int indices[PointLightGrid::s_maxQueryCount];
+    EXPECT_EQ(1, grid.GetLightCount());
+    ASSERT_EQ(1, grid.QueryNearest(glm::vec3(0.0f), 4, indices));
+    EXPECT_EQ(0, indices[0]);
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(PointLightGridBenchmark, DISABLED_GridVersusBruteForce)
+{
+    const int lightCounts[] = { 100, 1000, 10000 };
+    const int queryCount    = 20000;
+
+    std::mt19937 random(42);
+    for(int lightCount : lightCounts)
+    {
+        std::vector<glm::vec3> lights  = GetLights(Scene::Volume, lightCount, random);
+        std::vector<glm::vec3> queries = GetQueries(queryCount, random);
+
+        PointLightGrid grid;
+        int indices[PointLightGrid::s_maxQueryCount];
+        int found = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for(int nBuild = 0; nBuild < 10; ++nBuild)
+        {
+            grid.Build(lights.data(), lightCount);
+        }
+        auto built = std::chrono::steady_clock::now();
+        for(glm::vec3 const& query : queries)
+        {
+            found += grid.QueryNearest(query, 4, indices);
+        }
+        auto queried = std::chrono::steady_clock::now();
+
+        // The brute force is too slow to run every query on 10k lights
+        int bruteQueryCount = lightCount >= 10000 ? 2000 : queryCount;
+        for(int nQuery = 0; nQuery < bruteQueryCount; ++nQuery)
+        {
+            found += QueryBruteForce(lights, queries[nQuery], 4, indices);
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double buildUs = std::chrono::duration<double, std::micro>(built - start).count() / 10;
+        double gridUs  = std::chrono::duration<double, std::micro>(queried - built).count() / queryCount;
+        double bruteUs = std::chrono::duration<double, std::micro>(end - queried).count() / bruteQueryCount;
+        printf("%5d lights : build %8.1f us, grid query %7.3f us, brute force %8.3f us (x%.1f)\n",
+               lightCount, buildUs, gridUs, bruteUs, bruteUs / gridUs);
+
+        EXPECT_GT(found, 0);
+    }
+}
@@ -0,0 +1,210 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ShadowCascadesTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Lighting
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+
+#include "Glm/glm/gtc/matrix_transform.hpp"
+#include "Runtime/Rendering/Lighting/ShadowCascades.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const float s_near = 0.1f;
+const float s_far  = 2000.0f;
+
+/// \brief The projection of the demo camera
+glm::mat4 GetProjection()
+{
+    return glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, s_near, s_far);
+}
+
+/// \brief A moving and turning camera, z up like the terrain
+glm::mat4 GetView(int frame)
+{
+    float     time = static_cast<float>(frame);
+    glm::vec3 eye(time * 0.37f, -time * 1.13f, 50.0f + time * 0.01f);
+    glm::vec3 forward(std::cos(time * 0.1f), std::sin(time * 0.1f), -0.2f * std::sin(time * 0.05f));
+
+    return glm::lookAt(eye, eye + forward, glm::vec3(0.0f, 0.0f, 1.0f));
+}
+
+/// \brief Returns the distance from a view depth on the axis to a slice corner at the given depth
+float GetCornerDistance(float tanX, float tanY, float center, float depth)
+{
+    float k = std::sqrt(tanX * tanX + tanY * tanY);
+    return std::hypot(depth - center, k * depth);
+}
+
+}
+
+TEST(ShadowCascades, SplitsGoFromNearToFar)
+{
+    float splits[ShadowCascades::s_maxCascades + 1];
+
+    for(int count = 1; count <= ShadowCascades::s_maxCascades; ++count)
+    {
+        for(float lambda : { 0.0f, 0.5f, 0.75f, 1.0f })
+        {
+            ShadowCascades::ComputeSplits(0.1f, 400.0f, count, lambda, splits);
+            EXPECT_EQ(  0.1f, splits[0]);
+            EXPECT_EQ(400.0f, splits[count]);
+
+            for(int nSplit = 0; nSplit < count; ++nSplit)
+            {
+                EXPECT_LT(splits[nSplit], splits[nSplit + 1]) << count << " cascades, lambda " << lambda;
+            }
+        }
+    }
+}
+
+TEST(ShadowCascades, SplitsBlendUniformAndLogarithmic)
+{
+    float splits[3];
+
+    ShadowCascades::ComputeSplits(1.0f, 100.0f, 2, 0.0f, splits);
+    EXPECT_NEAR(50.5f, splits[1], 1e-4f);
+
+    ShadowCascades::ComputeSplits(1.0f, 100.0f, 2, 1.0f, splits);
+    EXPECT_NEAR(10.0f, splits[1], 1e-4f);
+
+    ShadowCascades::ComputeSplits(1.0f, 100.0f, 2, 0.5f, splits);
+    EXPECT_NEAR(30.25f, splits[1], 1e-4f);
+}
+
+TEST(ShadowCascades, SliceSphereTouchesBothEnds)
+{
+    const float tanX = 0.7f;
+    const float tanY = 0.4f;
+
+    // A thin slice, the near and far corners are on the sphere
+    float radius = 0.0f;
+    float center = ShadowCascades::ComputeSliceSphere(tanX, tanY, 10.0f, 50.0f, radius);
+    EXPECT_GT(center, 10.0f);
+    EXPECT_LT(center, 50.0f);
+    EXPECT_NEAR(radius, GetCornerDistance(tanX, tanY, center, 10.0f), 1e-3f);
+    EXPECT_NEAR(radius, GetCornerDistance(tanX, tanY, center, 50.0f), 1e-3f);
+
+    // Moving the center either way needs a bigger sphere
+    for(float delta : { -0.5f, 0.5f })
+    {
+        float moved = center + delta;
+        EXPECT_GT(std::max(GetCornerDistance(tanX, tanY, moved, 10.0f), GetCornerDistance(tanX, tanY, moved, 50.0f)), radius);
+    }
+}
+
+TEST(ShadowCascades, SliceSphereOfAWideSliceIsCenteredOnTheFarPlane)
+{
+    const float tanX = 1.5f;
+    const float tanY = 1.0f;
+
+    // The far corners alone set the sphere, the near ones are inside
+    float radius = 0.0f;
+    float center = ShadowCascades::ComputeSliceSphere(tanX, tanY, 0.1f, 400.0f, radius);
+    EXPECT_EQ(400.0f, center);
+    EXPECT_NEAR(radius, GetCornerDistance(tanX, tanY, center, 400.0f), 1e-2f);
+    EXPECT_LT(GetCornerDistance(tanX, tanY, center, 0.1f), radius);
+}
+
+TEST(ShadowCascades, CascadesEncloseTheirSlice)
+{
+    glm::mat4 projection = GetProjection();
+    float     tanX       = 1.0f / projection[0][0];
+    float     tanY       = 1.0f / projection[1][1];
+    glm::vec3 light      = glm::normalize(glm::vec3(-0.5f, -0.5f, -0.5f));
+
+    ShadowCascades cascades;
+    cascades.Configure(4, 2048);
+    EXPECT_EQ(4, cascades.GetCascadeCount());
+
+    // One texel of margin for the snapping
+    const float bound = 1.0f + 2.0f / 2048.0f + 1e-4f;
+    for(int nFrame = 0; nFrame < 200; ++nFrame)
+    {
+        glm::mat4 view = GetView(nFrame);
+        cascades.Update(projection, view, light);
+
+        EXPECT_NEAR(s_near, cascades.GetSplit(0), 1e-4f);
+        EXPECT_EQ  (400.0f, cascades.GetSplit(4));
+
+        glm::mat4 inverseView = glm::inverse(view);
+        for(int nCascade = 0; nCascade < cascades.GetCascadeCount(); ++nCascade)
+        {
+            glm::mat4 const& matrix = cascades.GetMatrix(nCascade);
+            for(int nCorner = 0; nCorner < 8; ++nCorner)
+            {
+                float     depth  = cascades.GetSplit(nCascade + (nCorner & 1));
+                float     x      = (nCorner & 2) ? 1.0f : -1.0f;
+                float     y      = (nCorner & 4) ? 1.0f : -1.0f;
+                glm::vec4 corner = inverseView * glm::vec4(x * tanX * depth, y * tanY * depth, -depth, 1.0f);
+                glm::vec4 clip   = matrix * corner;
+
+                ASSERT_LE(std::abs(clip.x), bound) << "frame " << nFrame << ", cascade " << nCascade;
+                ASSERT_LE(std::abs(clip.y), bound) << "frame " << nFrame << ", cascade " << nCascade;
+                ASSERT_GE(clip.z, -1.0001f)        << "frame " << nFrame << ", cascade " << nCascade;
+                ASSERT_LE(clip.z,  1.0001f)        << "frame " << nFrame << ", cascade " << nCascade;
+            }
+
+            // A caster between the light and the slice still writes its depth
+            glm::vec4 center = inverseView * glm::vec4(0.0f, 0.0f, -cascades.GetSplit(nCascade + 1), 1.0f);
+            glm::vec4 caster = matrix * (center - glm::vec4(light * 400.0f, 0.0f));
+            ASSERT_GE(caster.z, -1.0001f) << "frame " << nFrame << ", cascade " << nCascade;
+        }
+    }
+}
+
+TEST(ShadowCascades, CascadesMoveByWholeTexels)
+{
+    const int resolution     = 1024;
+    const int halfResolution = resolution / 2;
+    glm::vec3 light          = glm::normalize(glm::vec3(-0.3f, 0.2f, -1.0f));
+
+    ShadowCascades cascades;
+    cascades.Configure(3, resolution);
+
+    glm::mat4 previous[ShadowCascades::s_maxCascades];
+    for(int nFrame = 0; nFrame < 100; ++nFrame)
+    {
+        cascades.Update(GetProjection(), GetView(nFrame), light);
+
+        for(int nCascade = 0; nCascade < cascades.GetCascadeCount(); ++nCascade)
+        {
+            // The world origin always lands on a texel center
+            glm::mat4 const& matrix = cascades.GetMatrix(nCascade);
+            glm::vec2 texel = glm::vec2(matrix * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)) * static_cast<float>(halfResolution);
+            ASSERT_NEAR(std::round(texel.x), texel.x, 2e-2f * std::max(1.0f, std::abs(texel.x) / 1000.0f));
+            ASSERT_NEAR(std::round(texel.y), texel.y, 2e-2f * std::max(1.0f, std::abs(texel.y) / 1000.0f));
+
+            // The size of the cascade does not depend on the camera rotation
+            if(nFrame > 0)
+            {
+                EXPECT_NEAR(glm::length(glm::vec3(previous[nCascade][0])), glm::length(glm::vec3(matrix[0])), 1e-6f);
+            }
+
+            previous[nCascade] = matrix;
+        }
+    }
+}
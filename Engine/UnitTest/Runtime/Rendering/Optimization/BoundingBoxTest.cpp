@@ -0,0 +1,107 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BoundingBoxTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Glm/glm/ext.hpp"
+#include "Runtime/Rendering/Optimization/BoundingBox.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief Expects two vectors to be equal up to the float precision
+void ExpectNear(glm::vec3 const& expected, glm::vec3 const& actual)
+{
+    EXPECT_NEAR(expected.x, actual.x, 1e-5f);
+    EXPECT_NEAR(expected.y, actual.y, 1e-5f);
+    EXPECT_NEAR(expected.z, actual.z, 1e-5f);
+}
+
+}
+
+TEST(BoundingBox, IsEmptyUntilEnclosing)
+{
+    BoundingBox box;
+    EXPECT_TRUE(box.IsEmpty());
+
+    box.Enclose(glm::vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_EQ(box.GetMin(), box.GetMax());
+
+    box.Enclose(std::vector<glm::vec3> { glm::vec3(-1.0f, 4.0f, 3.0f), glm::vec3(2.0f, 0.0f, -5.0f) });
+    EXPECT_EQ(glm::vec3(-1.0f, 0.0f, -5.0f), box.GetMin());
+    EXPECT_EQ(glm::vec3( 2.0f, 4.0f,  3.0f), box.GetMax());
+    EXPECT_EQ(glm::vec3(0.5f, 2.0f, -1.0f),  box.GetCenter());
+    EXPECT_EQ(glm::vec3(1.5f, 2.0f,  4.0f),  box.GetExtents());
+
+    box.Reset();
+    EXPECT_TRUE(box.IsEmpty());
+}
+
+TEST(BoundingBox, TransformTranslatesAndScales)
+{
+    BoundingBox box(glm::vec3(0.0f), glm::vec3(16.0f));
+
+    BoundingBox translated = box.Transform(glm::translate(glm::mat4(1.0f), glm::vec3(-8.0f, -8.0f, -40.0f)));
+    EXPECT_EQ(glm::vec3(-8.0f, -8.0f, -40.0f), translated.GetMin());
+    EXPECT_EQ(glm::vec3( 8.0f,  8.0f, -24.0f), translated.GetMax());
+
+    BoundingBox scaled = box.Transform(glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 0.5f, -1.0f)));
+    EXPECT_EQ(glm::vec3( 0.0f, 0.0f, -16.0f), scaled.GetMin());
+    EXPECT_EQ(glm::vec3(32.0f, 8.0f,   0.0f), scaled.GetMax());
+}
+
+TEST(BoundingBox, TransformEnclosesTheRotatedCorners)
+{
+    BoundingBox box(glm::vec3(-1.0f, -2.0f, -3.0f), glm::vec3(1.0f, 2.0f, 3.0f));
+    glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, 0.0f))
+                        * glm::rotate(glm::mat4(1.0f), glm::radians(30.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+
+    // The box of the eight transformed corners is the tightest axis aligned box
+    BoundingBox corners;
+    for(int nCorner = 0; nCorner < 8; ++nCorner)
+    {
+        glm::vec3 corner((nCorner & 1) ? box.GetMax().x : box.GetMin().x,
+                         (nCorner & 2) ? box.GetMax().y : box.GetMin().y,
+                         (nCorner & 4) ? box.GetMax().z : box.GetMin().z);
+
+        corners.Enclose(glm::vec3(transform * glm::vec4(corner, 1.0f)));
+    }
+
+    BoundingBox transformed = box.Transform(transform);
+    ExpectNear(corners.GetMin(), transformed.GetMin());
+    ExpectNear(corners.GetMax(), transformed.GetMax());
+
+    // 45 degrees around z, the unit cube grows to sqrt(2) on x and y
+    BoundingBox cube = BoundingBox(glm::vec3(-1.0f), glm::vec3(1.0f)).Transform(
+        glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+    ExpectNear(glm::vec3(sqrtf(2.0f), sqrtf(2.0f), 1.0f), cube.GetMax());
+}
+
+TEST(BoundingBox, TransformKeepsEmptyBoxesEmpty)
+{
+    BoundingBox box;
+    EXPECT_TRUE(box.Transform(glm::translate(glm::mat4(1.0f), glm::vec3(1.0f))).IsEmpty());
+}
@@ -0,0 +1,200 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       DynamicResolutionTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <random>
+
+#include "Runtime/Rendering/Optimization/DynamicResolution.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const float s_budget = 1000.0f / 60.0f;
+
+/// \brief Tells if a scale is a multiple of the scale step
+bool IsSnapped(float scale)
+{
+    float steps = scale / DynamicResolution::s_scaleStep;
+    return std::abs(steps - std::round(steps)) < 1e-4f;
+}
+
+/// \brief Feeds the same frame time until the scale changes
+/// \return The number of updates, -1 if the scale did not change
+int UpdateUntilChange(DynamicResolution & resolution, float frameTime, int maxUpdates)
+{
+    for(int nUpdate = 1; nUpdate <= maxUpdates; ++nUpdate)
+    {
+        if(resolution.Update(frameTime))
+        {
+            return nUpdate;
+        }
+    }
+
+    return -1;
+}
+
+}
+
+TEST(DynamicResolution, KeepsTheScaleInsideTheBand)
+{
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.5f, 1.0f);
+
+    // Between 80 and 100 % of the budget, the scale never moves
+    std::mt19937 random(3);
+    std::uniform_real_distribution<float> band(s_budget * 0.82f, s_budget * 0.98f);
+    for(int nFrame = 0; nFrame < 1000; ++nFrame)
+    {
+        ASSERT_FALSE(resolution.Update(band(random))) << "frame " << nFrame;
+    }
+
+    EXPECT_EQ(1.0f, resolution.GetScale());
+}
+
+TEST(DynamicResolution, IgnoresASingleSlowFrame)
+{
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.5f, 1.0f);
+
+    for(int nFrame = 0; nFrame < 100; ++nFrame)
+    {
+        resolution.Update(s_budget * 0.9f);
+    }
+
+    // The average only moves by a tenth of the spike
+    EXPECT_FALSE(resolution.Update(s_budget * 1.5f));
+    EXPECT_EQ(1.0f, resolution.GetScale());
+    EXPECT_LT(resolution.GetAverageFrameTime(), s_budget);
+}
+
+TEST(DynamicResolution, ClampsToTheRange)
+{
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.6f, 0.9f);
+    EXPECT_FLOAT_EQ(0.9f, resolution.GetScale());
+
+    // Far over budget, the scale drops down to the min and stays there
+    for(int nFrame = 0; nFrame < 2000; ++nFrame)
+    {
+        resolution.Update(s_budget * 10.0f);
+        ASSERT_GE(resolution.GetScale(), 0.6f - 1e-6f);
+    }
+    EXPECT_FLOAT_EQ(0.6f, resolution.GetScale());
+
+    // Far under budget, it climbs up to the max and stays there
+    for(int nFrame = 0; nFrame < 2000; ++nFrame)
+    {
+        resolution.Update(s_budget * 0.1f);
+        ASSERT_LE(resolution.GetScale(), 0.9f + 1e-6f);
+    }
+    EXPECT_FLOAT_EQ(0.9f, resolution.GetScale());
+
+    // Reversed and out of range bounds
+    resolution.Configure(s_budget, 1.0f, 0.5f);
+    resolution.Reset();
+    EXPECT_FLOAT_EQ(1.0f, resolution.GetScale());
+
+    resolution.Configure(s_budget, 0.0f, 1.0f);
+    for(int nFrame = 0; nFrame < 2000; ++nFrame)
+    {
+        resolution.Update(s_budget * 100.0f);
+    }
+    EXPECT_FLOAT_EQ(DynamicResolution::s_scaleStep, resolution.GetScale());
+}
+
+TEST(DynamicResolution, SnapsToTheScaleStep)
+{
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.5f, 1.0f);
+
+    // Random loads, every scale reached is a multiple of 5 %
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> load(0.3f, 2.5f);
+    for(int nFrame = 0; nFrame < 5000; ++nFrame)
+    {
+        resolution.Update(s_budget * load(random));
+        ASSERT_TRUE(IsSnapped(resolution.GetScale())) << resolution.GetScale();
+    }
+
+    // A drop is at least one step, even when just over budget
+    resolution.Reset();
+    ASSERT_GT(UpdateUntilChange(resolution, s_budget * 1.01f, 1000), 0);
+    EXPECT_FLOAT_EQ(0.95f, resolution.GetScale());
+
+    // A drop follows the pixel count, 4 times the budget halves each axis
+    resolution.Reset();
+    ASSERT_GT(UpdateUntilChange(resolution, s_budget * 4.0f, 1000), 0);
+    EXPECT_FLOAT_EQ(0.5f, resolution.GetScale());
+}
+
+TEST(DynamicResolution, WaitsForTheCooldownAfterAChange)
+{
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.1f, 1.0f);
+
+    // The first decision needs the warm up samples
+    EXPECT_EQ(DynamicResolution::s_warmupFrames, UpdateUntilChange(resolution, s_budget * 1.5f, 1000));
+
+    // Then the samples of the cooldown are ignored, and the average restarts
+    float scale = resolution.GetScale();
+    EXPECT_EQ(DynamicResolution::s_cooldownFrames + DynamicResolution::s_warmupFrames,
+              UpdateUntilChange(resolution, s_budget * 1.5f, 1000));
+    EXPECT_LT(resolution.GetScale(), scale);
+}
+
+TEST(DynamicResolution, SettlesOnAGPUWithoutOscillating)
+{
+    // The GPU cost follows the pixel count
+    const float fullResolutionTime = s_budget * 1.8f;
+
+    DynamicResolution resolution;
+    resolution.Configure(s_budget, 0.5f, 1.0f);
+
+    int changes = 0;
+    for(int nFrame = 0; nFrame < 3000; ++nFrame)
+    {
+        float scale = resolution.GetScale();
+        if(resolution.Update(fullResolutionTime * scale * scale))
+        {
+            ++changes;
+        }
+    }
+
+    float scale     = resolution.GetScale();
+    float frameTime = fullResolutionTime * scale * scale;
+    EXPECT_LE(frameTime, s_budget);
+    EXPECT_GE(frameTime, s_budget * DynamicResolution::s_lowerThreshold);
+    EXPECT_LE(changes, 3);
+}
+
+TEST(DynamicResolution, ComputesTheRenderSize)
+{
+    EXPECT_EQ(1600, DynamicResolution::ComputeRenderSize(1600, 1.0f));
+    EXPECT_EQ(1200, DynamicResolution::ComputeRenderSize(1600, 0.75f));
+    EXPECT_EQ( 675, DynamicResolution::ComputeRenderSize( 900, 0.75f));
+    EXPECT_EQ(   1, DynamicResolution::ComputeRenderSize(   1, 0.05f));
+}
@@ -0,0 +1,166 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       FrustumTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Glm/glm/ext.hpp"
+#include "Runtime/Rendering/Optimization/Frustum.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const float s_near   = 0.1f;
+const float s_far    = 2000.0f;
+const float s_fov    = glm::radians(45.0f);
+const float s_aspect = 16.0f / 9.0f;
+
+/// \brief A camera at the origin looking toward -z
+Frustum GetPerspective()
+{
+    return Frustum(glm::perspective(s_fov, s_aspect, s_near, s_far)
+                 * glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+}
+
+/// \brief A light volume of 200 x 200 looking toward -z from z = 1
+Frustum GetOrthographic()
+{
+    return Frustum(glm::ortho(-100.0f, 100.0f, -100.0f, 100.0f, 0.1f, 5000.0f)
+                 * glm::lookAt(glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+}
+
+/// \brief A box of the given half size around the center
+BoundingBox GetBox(glm::vec3 const& center, float extent)
+{
+    return BoundingBox(center - glm::vec3(extent), center + glm::vec3(extent));
+}
+
+}
+
+TEST(Frustum, ExtractsThePerspectivePlanes)
+{
+    Frustum frustum = GetPerspective();
+
+    // Near and far planes
+    EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, 0.0f, -s_near * 1.01f)));
+    EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, 0.0f, -s_near * 0.99f)));
+    EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, 0.0f, -s_far  * 0.99f)));
+    EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, 0.0f, -s_far  * 1.01f)));
+    EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, 0.0f,  10.0f)));
+
+    // Side planes, at a distance of 10 units
+    float halfHeight = 10.0f * tanf(s_fov * 0.5f);
+    float halfWidth  = halfHeight * s_aspect;
+    for(float sign : { -1.0f, 1.0f })
+    {
+        EXPECT_TRUE (frustum.IsVisible(glm::vec3(sign * halfWidth * 0.99f, 0.0f, -10.0f)));
+        EXPECT_FALSE(frustum.IsVisible(glm::vec3(sign * halfWidth * 1.01f, 0.0f, -10.0f)));
+        EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, sign * halfHeight * 0.99f, -10.0f)));
+        EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, sign * halfHeight * 1.01f, -10.0f)));
+    }
+}
+
+TEST(Frustum, ExtractsTheOrthographicPlanes)
+{
+    Frustum frustum = GetOrthographic();
+
+    // The side planes are parallel, the same bounds at any depth
+    for(float z : { 0.0f, -100.0f, -4000.0f })
+    {
+        for(float sign : { -1.0f, 1.0f })
+        {
+            EXPECT_TRUE (frustum.IsVisible(glm::vec3(sign *  99.0f, 0.0f, z)));
+            EXPECT_FALSE(frustum.IsVisible(glm::vec3(sign * 101.0f, 0.0f, z)));
+            EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, sign *  99.0f, z)));
+            EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, sign * 101.0f, z)));
+        }
+    }
+
+    // Near at z = 0.9, far at z = -4999
+    EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, 0.0f,     0.89f)));
+    EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, 0.0f,     0.91f)));
+    EXPECT_TRUE (frustum.IsVisible(glm::vec3(0.0f, 0.0f, -4998.0f)));
+    EXPECT_FALSE(frustum.IsVisible(glm::vec3(0.0f, 0.0f, -5000.0f)));
+}
+
+TEST(Frustum, DefaultContainsEverything)
+{
+    Frustum frustum;
+    EXPECT_TRUE(frustum.IsVisible(glm::vec3(1e6f, -1e6f, 1e6f)));
+    EXPECT_TRUE(frustum.IsVisible(GetBox(glm::vec3(1e6f), 1.0f)));
+}
+
+TEST(Frustum, KeepsBoxesInside)
+{
+    Frustum perspective = GetPerspective();
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f)));
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(5.0f, 2.0f, -500.0f), 10.0f)));
+
+    Frustum orthographic = GetOrthographic();
+    EXPECT_TRUE(orthographic.IsVisible(GetBox(glm::vec3(0.0f), 5.0f)));
+    EXPECT_TRUE(orthographic.IsVisible(GetBox(glm::vec3(-90.0f, 90.0f, -3000.0f), 5.0f)));
+}
+
+TEST(Frustum, CullsBoxesOutside)
+{
+    Frustum perspective = GetPerspective();
+    EXPECT_FALSE(perspective.IsVisible(GetBox(glm::vec3(  0.0f,  0.0f,    10.0f),  1.0f))); // Behind
+    EXPECT_FALSE(perspective.IsVisible(GetBox(glm::vec3(101.0f,  0.0f,   -10.0f),  1.0f))); // Right
+    EXPECT_FALSE(perspective.IsVisible(GetBox(glm::vec3(  0.0f, 60.0f,   -10.0f),  1.0f))); // Top
+    EXPECT_FALSE(perspective.IsVisible(GetBox(glm::vec3(  0.0f,  0.0f, -2100.0f), 50.0f))); // Far
+
+    Frustum orthographic = GetOrthographic();
+    EXPECT_FALSE(orthographic.IsVisible(GetBox(glm::vec3( 155.0f, 0.0f,  0.0f), 5.0f)));
+    EXPECT_FALSE(orthographic.IsVisible(GetBox(glm::vec3(-155.0f, 0.0f,  0.0f), 5.0f)));
+    EXPECT_FALSE(orthographic.IsVisible(GetBox(glm::vec3(   0.0f, 0.0f, 10.0f), 5.0f)));
+}
+
+TEST(Frustum, KeepsBoxesStraddlingAPlane)
+{
+    Frustum perspective = GetPerspective();
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(0.0f, 0.0f, -2000.0f), 50.0f))); // Far
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(0.0f, 0.0f,     0.0f),  1.0f))); // Near
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(0.0f, 0.0f,     0.0f), 500.0f))); // Contains the frustum origin
+
+    float halfWidth = 10.0f * tanf(s_fov * 0.5f) * s_aspect;
+    EXPECT_TRUE(perspective.IsVisible(GetBox(glm::vec3(halfWidth + 0.5f, 0.0f, -10.0f), 1.0f))); // Right
+
+    Frustum orthographic = GetOrthographic();
+    EXPECT_TRUE(orthographic.IsVisible(GetBox(glm::vec3(100.0f, 100.0f, -10.0f), 5.0f))); // Corner
+}
+
+TEST(Frustum, NeverCullsEmptyBoxes)
+{
+    EXPECT_TRUE(GetPerspective().IsVisible(BoundingBox()));
+    EXPECT_TRUE(GetOrthographic().IsVisible(BoundingBox()));
+}
+
+TEST(Frustum, CullsTransformedBoxes)
+{
+    Frustum     frustum = GetPerspective();
+    BoundingBox chunk(glm::vec3(0.0f), glm::vec3(16.0f));
+
+    EXPECT_TRUE (frustum.IsVisible(chunk.Transform(glm::translate(glm::mat4(1.0f), glm::vec3(-8.0f, -8.0f, -40.0f)))));
+    EXPECT_FALSE(frustum.IsVisible(chunk.Transform(glm::translate(glm::mat4(1.0f), glm::vec3(-8.0f, -8.0f,  10.0f)))));
+}
@@ -0,0 +1,169 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       RenderQueueTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Runtime/Rendering/Optimization/RenderQueue.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief The states of a draw
+struct Draw
+{
+    uint  program;
+    uint  texture;
+    uint  vao;
+    float depth;
+};
+
+/// \brief Returns an opaque renderer, the queue never dereferences them
+IRenderer * GetRenderer(std::vector<int> & renderers, size_t index)
+{
+    return reinterpret_cast<IRenderer *>(&renderers[index]);
+}
+
+/// \brief Returns a random number in [0, count)
+uint GetRandom(std::mt19937 & random, uint count)
+{
+    return static_cast<uint>(random() % count);
+}
+
+/// \brief Counts the program, texture and vao changes of a draw order
+int CountStateChanges(std::vector<Draw> const& draws, std::vector<size_t> const& order)
+{
+    uint program = ~0u, texture = ~0u, vao = ~0u;
+    int  changes = 0;
+
+    for(size_t nDraw : order)
+    {
+        Draw const& draw = draws[nDraw];
+        if(draw.program != program) { program = draw.program; ++changes; }
+        if(draw.texture != texture) { texture = draw.texture; ++changes; }
+        if(draw.vao     != vao)     { vao     = draw.vao;     ++changes; }
+    }
+
+    return changes;
+}
+
+}
+
+TEST(RenderQueue, KeyFieldsAreOrderedByPriority)
+{
+    // A more significant field wins whatever the less significant ones
+    EXPECT_LT(RenderQueue::MakeKey(1, 65535, 65535, 1000.0f), RenderQueue::MakeKey(2, 0, 0, 0.0f));
+    EXPECT_LT(RenderQueue::MakeKey(1, 5, 65535, 1000.0f),     RenderQueue::MakeKey(1, 6, 0, 0.0f));
+    EXPECT_LT(RenderQueue::MakeKey(1, 5, 7, 1e30f),           RenderQueue::MakeKey(1, 5, 8, 0.0f));
+    EXPECT_LT(RenderQueue::MakeKey(1, 5, 7, 1.0f),            RenderQueue::MakeKey(1, 5, 7, 2.0f));
+    EXPECT_EQ(RenderQueue::MakeKey(1, 5, 7, 2.0f),            RenderQueue::MakeKey(1, 5, 7, 2.0f));
+}
+
+TEST(RenderQueue, KeyFieldsHaveTheirOwnBits)
+{
+    const int depthShift   = 0;
+    const int vaoShift     = depthShift   + RenderQueue::s_depthBits;
+    const int textureShift = vaoShift     + RenderQueue::s_vaoBits;
+    const int programShift = textureShift + RenderQueue::s_textureBits;
+    EXPECT_EQ(64, programShift + RenderQueue::s_programBits);
+
+    uint64 key = RenderQueue::MakeKey(0xABC, 0x1234, 0x5678, 3.5f);
+    EXPECT_EQ(0xABCu,  (key >> programShift) & ((1ull << RenderQueue::s_programBits) - 1));
+    EXPECT_EQ(0x1234u, (key >> textureShift) & ((1ull << RenderQueue::s_textureBits) - 1));
+    EXPECT_EQ(0x5678u, (key >> vaoShift)     & ((1ull << RenderQueue::s_vaoBits)     - 1));
+    EXPECT_EQ(RenderQueue::GetDepthBits(3.5f), key & ((1ull << RenderQueue::s_depthBits) - 1));
+
+    // Names wider than their field are truncated, without touching the other fields
+    EXPECT_EQ(RenderQueue::MakeKey(0x1ABC, 0x11234, 0x15678, 3.5f), key);
+}
+
+TEST(RenderQueue, DepthBitsAreMonotonic)
+{
+    uint64 previous = 0;
+    for(float depth = 1e-3f; depth < 5000.0f; depth *= 1.01f)
+    {
+        uint64 bits = RenderQueue::GetDepthBits(depth);
+        ASSERT_GE(bits, previous) << "depth " << depth;
+        ASSERT_LT(bits, 1ull << RenderQueue::s_depthBits) << "depth " << depth;
+        previous = bits;
+    }
+
+    // Distinct enough to order the draws of a scene
+    EXPECT_LT(RenderQueue::GetDepthBits(10.0f), RenderQueue::GetDepthBits(10.1f));
+    EXPECT_LT(RenderQueue::GetDepthBits(1000.0f), RenderQueue::GetDepthBits(1010.0f));
+    EXPECT_LT(RenderQueue::GetDepthBits(std::numeric_limits<float>::infinity()), 1ull << RenderQueue::s_depthBits);
+
+    // Behind the camera or invalid depths come first
+    EXPECT_EQ(0u, RenderQueue::GetDepthBits(0.0f));
+    EXPECT_EQ(0u, RenderQueue::GetDepthBits(-3.0f));
+    EXPECT_EQ(0u, RenderQueue::GetDepthBits(std::numeric_limits<float>::quiet_NaN()));
+}
+
+TEST(RenderQueue, SortsByKeyAndKeepsTheSubmissionOrder)
+{
+    const size_t drawCount = 2000;
+
+    std::mt19937 random(1);
+    std::vector<Draw> draws(drawCount);
+    std::vector<int>  renderers(drawCount);
+
+    RenderQueue queue;
+    for(size_t nDraw = 0; nDraw < drawCount; ++nDraw)
+    {
+        // Few programs and textures, many vaos, a coarse depth to get equal keys
+        draws[nDraw] = Draw { 1 + GetRandom(random, 6), GetRandom(random, 10), 1 + GetRandom(random, 300), static_cast<float>(GetRandom(random, 100)) };
+        queue.Submit(RenderQueue::MakeKey(draws[nDraw].program, draws[nDraw].texture, draws[nDraw].vao, draws[nDraw].depth),
+                     GetRenderer(renderers, nDraw));
+    }
+
+    queue.Sort();
+    std::vector<RenderQueue::Item> const& items = queue.GetItems();
+    ASSERT_EQ(drawCount, items.size());
+
+    std::vector<size_t> submitted, sorted;
+    for(size_t nDraw = 0; nDraw < drawCount; ++nDraw)
+    {
+        submitted.push_back(nDraw);
+        sorted.push_back(static_cast<size_t>(reinterpret_cast<int *>(items[nDraw].pRenderer) - renderers.data()));
+    }
+
+    for(size_t nItem = 1; nItem < items.size(); ++nItem)
+    {
+        ASSERT_LE(items[nItem - 1].key, items[nItem].key);
+        if(items[nItem - 1].key == items[nItem].key)
+        {
+            ASSERT_LT(sorted[nItem - 1], sorted[nItem]);
+        }
+    }
+
+    // Draws of the same program are contiguous, and within them the same texture
+    EXPECT_LT(CountStateChanges(draws, sorted), CountStateChanges(draws, submitted) / 2);
+
+    queue.Clear();
+    EXPECT_TRUE(queue.GetItems().empty());
+}
@@ -0,0 +1,246 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       VBOIndexerTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Optimization
+/// \author     Vincent STEHLY--CALISTO
+
+#include <map>
+#include <chrono>
+#include <random>
+
+#include "Runtime/Rendering/Optimization/VBOIndexer.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief The previous indexer, a std::map ordered by the vertex bits
+struct ReferenceIndexer
+{
+    struct Vertex
+    {
+        glm::vec3 position;
+        glm::vec3 normal;
+        glm::vec2 uv;
+
+        bool operator<(Vertex const& other) const
+        {
+            return memcmp(this, &other, sizeof(Vertex)) > 0;
+        }
+    };
+
+    template <typename TIndex>
+    static void Index(
+            std::vector<glm::vec3> const& inVertices,
+            std::vector<glm::vec3> const& inNormals,
+            std::vector<glm::vec2> const& inUVs,
+            std::vector<TIndex>         & outIndexes,
+            std::vector<glm::vec3>      & outVertices,
+            std::vector<glm::vec3>      & outNormals,
+            std::vector<glm::vec2>      & outUVs)
+    {
+        std::map<Vertex, TIndex> output;
+        for (size_t nVertex = 0; nVertex < inVertices.size(); ++nVertex)
+        {
+            Vertex pack = {inVertices[nVertex], inNormals[nVertex], inUVs[nVertex]};
+
+            auto it = output.find(pack);
+            if (it != output.end())
+            {
+                outIndexes.push_back(it->second);
+            }
+            else
+            {
+                TIndex index = static_cast<TIndex>(outVertices.size());
+                outVertices.push_back(inVertices[nVertex]);
+                outNormals.push_back (inNormals [nVertex]);
+                outUVs.push_back     (inUVs     [nVertex]);
+                outIndexes.push_back (index);
+                output[pack] = index;
+            }
+        }
+    }
+};
+
+/// \brief A mesh made of cube faces, most vertices are shared
+struct Mesh
+{
+    std::vector<glm::vec3> vertices;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> uvs;
+
+    Mesh(size_t vertexCount, int extent, unsigned seed)
+    {
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<int> position(0, extent - 1);
+        std::uniform_int_distribution<int> face    (0, 5);
+        std::uniform_int_distribution<int> tile    (0, 3);
+
+        for (size_t nVertex = 0; nVertex < vertexCount; ++nVertex)
+        {
+            int nFace = face(random);
+
+            glm::vec3 normal(0.0f);
+            normal[nFace % 3] = nFace < 3 ? 1.0f : -1.0f;
+
+            vertices.emplace_back(position(random), position(random), position(random));
+            normals.push_back(normal);
+            uvs.emplace_back(tile(random) / 16.0f, 0.5f);
+        }
+    }
+};
+
+}
+
+TEST(VBOIndexer, MatchesReferenceIndexer)
+{
+    Mesh mesh(60000, 12, 42);
+
+    std::vector<unsigned short> refIndexes;
+    std::vector<glm::vec3>      refVertices, refNormals;
+    std::vector<glm::vec2>      refUVs;
+    ReferenceIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, refIndexes, refVertices, refNormals, refUVs);
+
+    std::vector<unsigned short> indexes;
+    std::vector<glm::vec3>      vertices, normals;
+    std::vector<glm::vec2>      uvs;
+    EXPECT_TRUE(VBOIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, indexes, vertices, normals, uvs));
+
+    EXPECT_LT(vertices.size(), mesh.vertices.size());
+    EXPECT_EQ(refIndexes,  indexes);
+    EXPECT_EQ(refVertices, vertices);
+    EXPECT_EQ(refNormals,  normals);
+    EXPECT_EQ(refUVs,      uvs);
+}
+
+TEST(VBOIndexer, MatchesReferenceIndexerWithoutNormals)
+{
+    Mesh mesh(20000, 16, 7);
+    std::vector<glm::vec3> flatNormals(mesh.vertices.size(), glm::vec3(0.0f));
+
+    std::vector<unsigned short> refIndexes;
+    std::vector<glm::vec3>      refVertices, refNormals;
+    std::vector<glm::vec2>      refUVs;
+    ReferenceIndexer::Index(mesh.vertices, flatNormals, mesh.uvs, refIndexes, refVertices, refNormals, refUVs);
+
+    std::vector<unsigned short> indexes;
+    std::vector<glm::vec3>      vertices;
+    std::vector<glm::vec2>      uvs;
+    EXPECT_TRUE(VBOIndexer::Index(mesh.vertices, mesh.uvs, indexes, vertices, uvs));
+
+    EXPECT_EQ(refIndexes,  indexes);
+    EXPECT_EQ(refVertices, vertices);
+    EXPECT_EQ(refUVs,      uvs);
+}
+
+TEST(VBOIndexer, MatchesReferenceIndexerWith32BitsIndexes)
+{
+    Mesh mesh(300000, 40, 3);
+
+    std::vector<unsigned int> refIndexes;
+    std::vector<glm::vec3>    refVertices, refNormals;
+    std::vector<glm::vec2>    refUVs;
+    ReferenceIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, refIndexes, refVertices, refNormals, refUVs);
+
+    std::vector<unsigned int> indexes;
+    std::vector<glm::vec3>    vertices, normals;
+    std::vector<glm::vec2>    uvs;
+    VBOIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, indexes, vertices, normals, uvs);
+
+    EXPECT_GT(vertices.size(), 0x10000u);
+    EXPECT_EQ(refIndexes,  indexes);
+    EXPECT_EQ(refVertices, vertices);
+    EXPECT_EQ(refNormals,  normals);
+    EXPECT_EQ(refUVs,      uvs);
+}
+
+TEST(VBOIndexer, Rejects16BitsIndexesOverflow)
+{
+    Mesh mesh(300000, 40, 3);
+
+    std::vector<unsigned short> indexes(1, 7);
+    std::vector<glm::vec3>      vertices(1), normals(1);
+    std::vector<glm::vec2>      uvs(1);
+    EXPECT_FALSE(VBOIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, indexes, vertices, normals, uvs));
+
+    // Nothing is emitted, the previous content is kept
+    EXPECT_EQ(1u, indexes.size());
+    EXPECT_EQ(7u, indexes.front());
+    EXPECT_EQ(1u, vertices.size());
+    EXPECT_EQ(1u, normals.size());
+    EXPECT_EQ(1u, uvs.size());
+}
+
+TEST(VBOIndexer, Accepts65536Vertices)
+{
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> inUVs;
+    for (int nVertex = 0; nVertex < 0x10000; ++nVertex)
+    {
+        positions.emplace_back(nVertex, 0.0f, 0.0f);
+        inUVs.emplace_back(0.0f);
+    }
+
+    std::vector<unsigned short> indexes;
+    std::vector<glm::vec3>      vertices;
+    std::vector<glm::vec2>      uvs;
+    EXPECT_TRUE(VBOIndexer::Index(positions, inUVs, indexes, vertices, uvs));
+    EXPECT_EQ(0xFFFFu, indexes.back());
+
+    // One more unique vertex does not fit
+    positions.emplace_back(-1.0f, 0.0f, 0.0f);
+    inUVs.emplace_back(0.0f);
+
+    indexes.clear();
+    vertices.clear();
+    uvs.clear();
+    EXPECT_FALSE(VBOIndexer::Index(positions, inUVs, indexes, vertices, uvs));
+    EXPECT_TRUE(indexes.empty());
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(VBOIndexerBenchmark, DISABLED_ReferenceVersusHashTable)
+{
+    const size_t counts[] = { 6000, 60000, 180000 };
+    for (size_t count : counts)
+    {
+        Mesh mesh(count, 24, 11);
+
+        std::vector<unsigned int> refIndexes, indexes;
+        std::vector<glm::vec3>    refVertices, refNormals, vertices, normals;
+        std::vector<glm::vec2>    refUVs, uvs;
+
+        auto start = std::chrono::steady_clock::now();
+        ReferenceIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, refIndexes, refVertices, refNormals, refUVs);
+        auto middle = std::chrono::steady_clock::now();
+        VBOIndexer::Index(mesh.vertices, mesh.normals, mesh.uvs, indexes, vertices, normals, uvs);
+        auto end = std::chrono::steady_clock::now();
+
+        double referenceMs = std::chrono::duration<double, std::milli>(middle - start).count();
+        double hashMs      = std::chrono::duration<double, std::milli>(end - middle).count();
+        printf("%7zu vertices : map %8.2f ms, hash table %8.2f ms (x%.1f)\n",
+               count, referenceMs, hashMs, referenceMs / hashMs);
+
+        EXPECT_EQ(refIndexes, indexes);
+    }
+}
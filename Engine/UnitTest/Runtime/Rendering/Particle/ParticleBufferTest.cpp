@@ -0,0 +1,169 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleBufferTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include "Runtime/Rendering/Particle/ParticleSimulation.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+/// \brief Writes a particle whose identifier is stored in its red channel
+void SetParticle(ParticleBuffer & particles, int index, float id, float lifeTime)
+{
+    particles.positionX[index] = id;
+    particles.positionY[index] = id;
+    particles.positionZ[index] = id;
+    particles.velocityX[index] = 0.0f;
+    particles.velocityY[index] = 0.0f;
+    particles.velocityZ[index] = 0.0f;
+    particles.colorR   [index] = id;
+    particles.colorG   [index] = id;
+    particles.colorB   [index] = id;
+    particles.size     [index] = id;
+    particles.lifeTime [index] = lifeTime;
+}
+
+/// \brief Returns the sorted identifiers of the particles in [0, count)
+std::vector<float> GetIds(ParticleBuffer const& particles, int count)
+{
+    std::vector<float> ids(particles.colorR, particles.colorR + count);
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+}
+
+TEST(ParticleBuffer, AllocateKillsAllParticles)
+{
+    ParticleBuffer particles;
+    particles.Allocate(13);
+
+    EXPECT_EQ(13, particles.GetCapacity());
+    for(int nParticle = 0; nParticle < 13; ++nParticle)
+    {
+        EXPECT_EQ(0.0f, particles.lifeTime[nParticle]);
+    }
+
+    // Each array is 16 bytes aligned for the SIMD kernel
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(particles.positionX) % 16);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(particles.lifeTime)  % 16);
+    EXPECT_EQ(0, particles.Compact(13));
+}
+
+TEST(ParticleBuffer, CompactKeepsTheLivingParticles)
+{
+    // Each bit of the mask is a living particle, including the first and last ones
+    const int count = 10;
+    for(int mask = 0; mask < (1 << count); ++mask)
+    {
+        ParticleBuffer particles;
+        particles.Allocate(count);
+
+        std::vector<float> living;
+        for(int nParticle = 0; nParticle < count; ++nParticle)
+        {
+            bool bAlive = (mask & (1 << nParticle)) != 0;
+            SetParticle(particles, nParticle, static_cast<float>(nParticle), bAlive ? 1.0f : 0.0f);
+            if(bAlive)
+            {
+                living.push_back(static_cast<float>(nParticle));
+            }
+        }
+
+        int liveCount = particles.Compact(count);
+        ASSERT_EQ(static_cast<int>(living.size()), liveCount) << "mask " << mask;
+        ASSERT_EQ(living, GetIds(particles, liveCount)) << "mask " << mask;
+
+        // All attributes moved together
+        for(int nParticle = 0; nParticle < liveCount; ++nParticle)
+        {
+            ASSERT_EQ(particles.colorR[nParticle], particles.positionX[nParticle]);
+            ASSERT_EQ(particles.colorR[nParticle], particles.size[nParticle]);
+        }
+    }
+}
+
+TEST(ParticleBuffer, LiveRangeNeverHoldsADeadParticle)
+{
+    // The pool and the emission rate of the demo emitters
+    const int   capacity     = 200000;
+    const int   emissionRate = 5000;
+    const float dt           = 1.0f / 60.0f;
+    const int   frameCount   = 600;
+
+    ParticleBuffer particles;
+    particles.Allocate(capacity);
+
+    std::mt19937 random(5);
+    std::uniform_real_distribution<float> distribution(0.5f, 3.0f);
+
+    // The life time of each living particle, indexed by identifier
+    std::vector<float> lifeTimes;
+    std::vector<float> positions(capacity * 4), colors(capacity * 3);
+
+    int liveParticles = 0;
+    for(int nFrame = 0; nFrame < frameCount; ++nFrame)
+    {
+        // Emits at the end of the live range, like ParticleSystem::Emit
+        int particleToEmit = static_cast<int>(dt * static_cast<float>(emissionRate));
+        for(int nEmit = 0; nEmit < particleToEmit && liveParticles < capacity; ++nEmit)
+        {
+            float lifeTime = distribution(random);
+            SetParticle(particles, liveParticles++, static_cast<float>(lifeTimes.size()), lifeTime);
+            lifeTimes.push_back(lifeTime);
+        }
+
+        int written   = ParticleSimulation::Simulate(particles, 0, liveParticles, glm::vec3(0.0f), dt, positions.data(), colors.data());
+        liveParticles = particles.Compact(liveParticles);
+        ASSERT_EQ(written, liveParticles) << "frame " << nFrame;
+
+        for(int nParticle = 0; nParticle < liveParticles; ++nParticle)
+        {
+            ASSERT_GT(particles.lifeTime[nParticle], 0.0f) << "frame " << nFrame << ", particle " << nParticle;
+        }
+
+        // The survivors are exactly the particles whose life time is not over
+        std::vector<float> expected;
+        for(size_t nId = 0; nId < lifeTimes.size(); ++nId)
+        {
+            lifeTimes[nId] -= dt;
+            if(lifeTimes[nId] > 0.0f)
+            {
+                expected.push_back(static_cast<float>(nId));
+            }
+        }
+
+        ASSERT_EQ(expected, GetIds(particles, liveParticles)) << "frame " << nFrame;
+    }
+
+    // Past the longest life time, emission and death are balanced
+    EXPECT_GT(liveParticles, 0);
+    EXPECT_LT(liveParticles, capacity);
+}
@@ -0,0 +1,198 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ParticleSimulationTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Particle
+/// \author     Vincent STEHLY--CALISTO
+
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstring>
+
+#include "Runtime/Rendering/Particle/ParticleSimulation.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const glm::vec3 s_gravity(0.0f, 0.0f, -9.81f);
+const float     s_dt = 1.0f / 60.0f;
+
+/// \brief Fills the particles with random attributes
+///        About a third of the particles die within the first frames
+void FillRandom(ParticleBuffer & particles, int count, uint32_t seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    particles.Allocate(count);
+    for(int nParticle = 0; nParticle < count; ++nParticle)
+    {
+        particles.positionX[nParticle] = distribution(random) * 100.0f;
+        particles.positionY[nParticle] = distribution(random) * 100.0f;
+        particles.positionZ[nParticle] = distribution(random) * 100.0f;
+        particles.velocityX[nParticle] = distribution(random);
+        particles.velocityY[nParticle] = distribution(random);
+        particles.velocityZ[nParticle] = distribution(random);
+        particles.colorR[nParticle]    = distribution(random);
+        particles.colorG[nParticle]    = distribution(random);
+        particles.colorB[nParticle]    = distribution(random);
+        particles.size[nParticle]      = distribution(random) + 2.0f;
+        particles.lifeTime[nParticle]  = (distribution(random) + 0.6f) * 0.2f;
+    }
+}
+
+/// \brief Copies all the attributes of the particles
+void Copy(ParticleBuffer const& from, ParticleBuffer & to, int count)
+{
+    to.Allocate(count);
+    float * const sources[]      = { from.positionX, from.positionY, from.positionZ, from.velocityX, from.velocityY, from.velocityZ, from.colorR, from.colorG, from.colorB, from.size, from.lifeTime };
+    float * const destinations[] = { to.positionX, to.positionY, to.positionZ, to.velocityX, to.velocityY, to.velocityZ, to.colorR, to.colorG, to.colorB, to.size, to.lifeTime };
+
+    for(size_t nAttribute = 0; nAttribute < sizeof(sources) / sizeof(sources[0]); ++nAttribute)
+    {
+        memcpy(destinations[nAttribute], sources[nAttribute], count * sizeof(float));
+    }
+}
+
+/// \brief Tells if the attributes of the particles are bitwise equal
+bool AreEqual(ParticleBuffer const& lhs, ParticleBuffer const& rhs, int count)
+{
+    float * const left[]  = { lhs.positionX, lhs.positionY, lhs.positionZ, lhs.velocityX, lhs.velocityY, lhs.velocityZ, lhs.lifeTime };
+    float * const right[] = { rhs.positionX, rhs.positionY, rhs.positionZ, rhs.velocityX, rhs.velocityY, rhs.velocityZ, rhs.lifeTime };
+
+    for(size_t nAttribute = 0; nAttribute < sizeof(left) / sizeof(left[0]); ++nAttribute)
+    {
+        if(memcmp(left[nAttribute], right[nAttribute], count * sizeof(float)) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+TEST(ParticleSimulation, SimulateMatchesSimulateScalar)
+{
+    const int counts[] = { 1, 3, 4, 7, 1001, 4099 };
+    const int begins[] = { 0, 1, 3 };
+
+    for(int count : counts)
+    {
+        for(int begin : begins)
+        {
+            if(begin >= count)
+            {
+                continue;
+            }
+
+            ParticleBuffer simd, scalar;
+            FillRandom(simd, count, static_cast<uint32_t>(count + begin));
+            Copy(simd, scalar, count);
+
+            std::vector<float> simdPositions(count * 4), simdColors(count * 3);
+            std::vector<float> scalarPositions(count * 4), scalarColors(count * 3);
+
+            // Until all particles are dead, the ranges start unaligned
+            for(int nFrame = 0; nFrame < 20; ++nFrame)
+            {
+                int simdWritten   = ParticleSimulation::Simulate(simd, begin, count, s_gravity, s_dt, simdPositions.data(), simdColors.data());
+                int scalarWritten = ParticleSimulation::SimulateScalar(scalar, begin, count, s_gravity, s_dt, scalarPositions.data(), scalarColors.data());
+
+                ASSERT_EQ(scalarWritten, simdWritten) << count << " particles from " << begin << ", frame " << nFrame;
+                ASSERT_EQ(0, memcmp(scalarPositions.data(), simdPositions.data(), scalarWritten * 4 * sizeof(float))) << count << " particles from " << begin << ", frame " << nFrame;
+                ASSERT_EQ(0, memcmp(scalarColors.data(),    simdColors.data(),    scalarWritten * 3 * sizeof(float))) << count << " particles from " << begin << ", frame " << nFrame;
+                ASSERT_TRUE(AreEqual(scalar, simd, count)) << count << " particles from " << begin << ", frame " << nFrame;
+            }
+        }
+    }
+}
+
+TEST(ParticleSimulation, SimulateWritesTheLivingParticles)
+{
+    ParticleBuffer particles;
+    FillRandom(particles, 8, 1);
+    for(int nParticle = 0; nParticle < 8; ++nParticle)
+    {
+        particles.lifeTime[nParticle] = (nParticle % 2 == 0) ? 1.0f : 0.0f;
+    }
+
+    std::vector<float> positions(8 * 4), colors(8 * 3);
+    int written = ParticleSimulation::Simulate(particles, 0, 8, s_gravity, s_dt, positions.data(), colors.data());
+    ASSERT_EQ(4, written);
+
+    for(int nBillboard = 0; nBillboard < written; ++nBillboard)
+    {
+        int nParticle = nBillboard * 2;
+        EXPECT_EQ(particles.positionX[nParticle], positions[nBillboard * 4 + 0]);
+        EXPECT_EQ(particles.positionY[nParticle], positions[nBillboard * 4 + 1]);
+        EXPECT_EQ(particles.positionZ[nParticle], positions[nBillboard * 4 + 2]);
+        EXPECT_EQ(particles.size[nParticle],      positions[nBillboard * 4 + 3]);
+        EXPECT_EQ(particles.colorR[nParticle],    colors[nBillboard * 3 + 0]);
+        EXPECT_EQ(particles.colorG[nParticle],    colors[nBillboard * 3 + 1]);
+        EXPECT_EQ(particles.colorB[nParticle],    colors[nBillboard * 3 + 2]);
+        EXPECT_FLOAT_EQ(1.0f - s_dt,              particles.lifeTime[nParticle]);
+    }
+}
+
+/// Run with --gtest_also_run_disabled_tests
+TEST(ParticleSimulationBenchmark, DISABLED_ScalarVersusSIMD)
+{
+    printf("SIMD kernel : %s\n", ParticleSimulation::IsSIMDSupported() ? "SSE2" : "none");
+
+    const int counts[] = { 10000, 100000, 1000000 };
+    for(int count : counts)
+    {
+        ParticleBuffer simd, scalar;
+        FillRandom(simd, count, 1);
+        for(int nParticle = 0; nParticle < count; ++nParticle)
+        {
+            simd.lifeTime[nParticle] = 1e9f;
+        }
+        Copy(simd, scalar, count);
+
+        std::vector<float> positions(count * 4), colors(count * 3);
+        const int iterations = count >= 1000000 ? 20 : 200;
+
+        auto start = std::chrono::steady_clock::now();
+        for(int nIteration = 0; nIteration < iterations; ++nIteration)
+        {
+            ParticleSimulation::SimulateScalar(scalar, 0, count, s_gravity, s_dt, positions.data(), colors.data());
+        }
+        auto middle = std::chrono::steady_clock::now();
+        for(int nIteration = 0; nIteration < iterations; ++nIteration)
+        {
+            ParticleSimulation::Simulate(simd, 0, count, s_gravity, s_dt, positions.data(), colors.data());
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        double scalarUs = std::chrono::duration<double, std::micro>(middle - start).count() / iterations;
+        double simdUs   = std::chrono::duration<double, std::micro>(end - middle).count()  / iterations;
+        printf("%7d particles : scalar %9.1f us, SIMD %9.1f us (x%.2f)\n",
+               count, scalarUs, simdUs, scalarUs / simdUs);
+
+        EXPECT_TRUE(AreEqual(scalar, simd, count));
+    }
+}
@@ -0,0 +1,211 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ProgramCacheTest.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    UnitTest/Runtime/Rendering/Shader
+/// \author     Vincent STEHLY--CALISTO
+
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+
+#include "Runtime/Rendering/Shader/ProgramCache.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace cardinal;
+
+namespace
+{
+
+const char * s_vertexSource   = "#version 330 core\nvoid main() { gl_Position = vec4(0.0); }\n";
+const char * s_fragmentSource = "#version 330 core\nout vec4 color;\nvoid main() { color = vec4(1.0); }\n";
+const char * s_driver         = "NVIDIA Corporation|GeForce GTX 1080/PCIe/SSE2|4.6.0 NVIDIA 418.56";
+
+/// \brief Returns the key of a program, like ShaderCompiler::SubmitProgram
+uint64 GetKey(const char * szVertex, const char * szFragment, const char * szDriver)
+{
+    uint64 key = ProgramCache::Hash(szVertex, ProgramCache::s_seed);
+    key = ProgramCache::Hash(szFragment, key);
+    return ProgramCache::Hash(szDriver, key);
+}
+
+/// \brief Overwrites a 32 bits field of a file
+void Patch(std::string const& path, std::streamoff offset, uint32 value)
+{
+    std::fstream stream(path, std::ios::in | std::ios::out | std::ios::binary);
+    stream.seekp(offset);
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/// \brief Truncates a file to the given size
+void Truncate(std::string const& path, size_t size)
+{
+    std::vector<char> content;
+    {
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    content.resize(std::min(size, content.size()));
+    std::ofstream stream(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+/// \brief Returns the size of a file
+size_t GetFileSize(std::string const& path)
+{
+    std::ifstream stream(path, std::ios::in | std::ios::binary | std::ios::ate);
+    return static_cast<size_t>(stream.tellg());
+}
+
+/// \brief Writes the entry of the test program in a temporary directory
+class ProgramCacheTest : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        ProgramCache::SetDirectory(::testing::TempDir() + "CardinalProgramCache");
+        m_path   = ProgramCache::GetPath("Test.vert|Test.frag");
+        m_key    = GetKey(s_vertexSource, s_fragmentSource, s_driver);
+        m_binary = { 'C', 'A', 'R', 'D', 1, 2, 3, 4, 5, 6, 7 };
+
+        ASSERT_TRUE(ProgramCache::WriteEntry(m_path, m_key, 0x8E21, m_binary));
+    }
+
+    void TearDown() override
+    {
+        ProgramCache::RemoveEntry(m_path);
+        ProgramCache::SetDirectory("ShaderCache");
+    }
+
+    /// \brief Tells if the entry reads back with the given key
+    bool Read(uint64 key)
+    {
+        uint32            format = 0;
+        std::vector<char> binary;
+        return ProgramCache::ReadEntry(m_path, key, format, binary);
+    }
+
+    std::string       m_path;
+    uint64            m_key;
+    std::vector<char> m_binary;
+};
+
+}
+
+TEST(ProgramCacheKey, ChangesWithTheSources)
+{
+    uint64 key = GetKey(s_vertexSource, s_fragmentSource, s_driver);
+    EXPECT_EQ(key, GetKey(s_vertexSource, s_fragmentSource, s_driver));
+
+    // Any edit, even a single space, misses
+    std::string edited = s_fragmentSource;
+    edited.insert(edited.size() - 2, " ");
+    EXPECT_NE(key, GetKey(s_vertexSource, edited.c_str(), s_driver));
+    EXPECT_NE(key, GetKey(s_fragmentSource, s_vertexSource, s_driver));
+
+    // The boundary between the stages is part of the key
+    EXPECT_NE(GetKey("ab", "c", s_driver), GetKey("a", "bc", s_driver));
+    EXPECT_NE(GetKey("", "abc", s_driver), GetKey("abc", "", s_driver));
+}
+
+TEST(ProgramCacheKey, ChangesWithTheDriver)
+{
+    uint64 key = GetKey(s_vertexSource, s_fragmentSource, s_driver);
+    EXPECT_NE(key, GetKey(s_vertexSource, s_fragmentSource, "NVIDIA Corporation|GeForce GTX 1080/PCIe/SSE2|4.6.0 NVIDIA 430.14"));
+    EXPECT_NE(key, GetKey(s_vertexSource, s_fragmentSource, "Intel|Mesa Intel(R) UHD Graphics 620|4.6 (Core Profile) Mesa 19.0.8"));
+    EXPECT_NE(key, GetKey(s_vertexSource, s_fragmentSource, ""));
+}
+
+TEST(ProgramCacheKey, NamesMapToDistinctFiles)
+{
+    EXPECT_EQ(ProgramCache::GetPath("a.vert|a.frag"), ProgramCache::GetPath("a.vert|a.frag"));
+    EXPECT_NE(ProgramCache::GetPath("a.vert|a.frag"), ProgramCache::GetPath("b.vert|a.frag"));
+}
+
+TEST_F(ProgramCacheTest, ReadsBackItsEntry)
+{
+    uint32            format = 0;
+    std::vector<char> binary;
+    ASSERT_TRUE(ProgramCache::ReadEntry(m_path, m_key, format, binary));
+    EXPECT_EQ(0x8E21u, format);
+    EXPECT_EQ(m_binary, binary);
+}
+
+TEST_F(ProgramCacheTest, MissesOnAnotherKey)
+{
+    EXPECT_FALSE(Read(GetKey(s_vertexSource, s_fragmentSource, "Another driver")));
+    EXPECT_FALSE(Read(m_key + 1));
+
+    // The next recompilation overwrites the entry
+    uint64 key = GetKey(s_vertexSource, "void main() {}", s_driver);
+    ASSERT_TRUE(ProgramCache::WriteEntry(m_path, key, 1, m_binary));
+    EXPECT_TRUE (Read(key));
+    EXPECT_FALSE(Read(m_key));
+}
+
+TEST_F(ProgramCacheTest, RejectsAWrongMagic)
+{
+    Patch(m_path, 0, 0x12345678);
+    EXPECT_FALSE(Read(m_key));
+
+    Patch(m_path, 0, ProgramCache::s_magic);
+    EXPECT_TRUE(Read(m_key));
+}
+
+TEST_F(ProgramCacheTest, RejectsAnotherVersion)
+{
+    Patch(m_path, 4, ProgramCache::s_version + 1);
+    EXPECT_FALSE(Read(m_key));
+
+    Patch(m_path, 4, 0);
+    EXPECT_FALSE(Read(m_key));
+}
+
+TEST_F(ProgramCacheTest, RejectsATruncatedFile)
+{
+    size_t size = GetFileSize(m_path);
+
+    // In the binary, in the header and empty
+    for(size_t truncatedSize : { size - 1, size - m_binary.size(), size_t(10), size_t(0) })
+    {
+        ASSERT_TRUE(ProgramCache::WriteEntry(m_path, m_key, 0x8E21, m_binary));
+        Truncate(m_path, truncatedSize);
+        EXPECT_FALSE(Read(m_key)) << truncatedSize << " bytes";
+    }
+}
+
+TEST_F(ProgramCacheTest, RejectsTrailingBytes)
+{
+    {
+        std::ofstream stream(m_path, std::ios::out | std::ios::binary | std::ios::app);
+        stream.put('\0');
+    }
+
+    EXPECT_FALSE(Read(m_key));
+}
+
+TEST_F(ProgramCacheTest, MissesOnceRemoved)
+{
+    ProgramCache::RemoveEntry(m_path);
+    EXPECT_FALSE(Read(m_key));
+}
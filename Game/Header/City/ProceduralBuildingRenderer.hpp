@@ -29,6 +29,7 @@
 #include "Glm/glm/ext.hpp"
 
 #include "Runtime/Rendering/Renderer/IRenderer.hpp"
+#include "Runtime/Rendering/Buffer/RingBuffer.hpp"
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
 /// \class  ProceduralBuildingRenderer
@@ -51,7 +52,7 @@ public :
                     std::vector<glm::vec3>      const &normals,
                     std::vector<glm::vec2>      const &uvs);
 
-    /// \brief Updates the mesh
+    /// \brief Streams the mesh in the next region of the rings
     /// \param normals The normals of the mesh
     /// \param vertices The vertices of the mesh
     /// \param uvs The uvs of the mesh
@@ -79,9 +80,9 @@ private:
 
     friend class RenderingEngine;
 
-    uint m_verticesObject;
-    uint m_normalsObject;
-    uint m_uvsObject;
+    cardinal::RingBuffer m_verticesRing;
+    cardinal::RingBuffer m_normalsRing;
+    cardinal::RingBuffer m_uvsRing;
 };
 
 #endif // !CARDINAL_ENGINE_PROCEDURAL_BUILDING_RENDERER_HPP__
\ No newline at end of file
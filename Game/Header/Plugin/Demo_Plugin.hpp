@@ -28,6 +28,7 @@
 #include "Runtime/Rendering/Particle/ParticleSystem.hpp"
 
 #include "World/World.hpp"
+#include "World/ChunkRegulator.hpp"
 #include "World/Generator/BasicWorldGenerator.hpp"
 
 #include "Character/Character.hpp"
@@ -50,6 +51,7 @@ public:
 private:
 
     World *             m_pWorld;
+    ChunkRegulator *    m_pChunkRegulator = nullptr;
     BasicWorldGenerator m_worldGenerator;
 
     Character     m_character;
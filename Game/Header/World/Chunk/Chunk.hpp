@@ -31,6 +31,8 @@
 // Game
 #include "World/Cube/ByteCube.hpp"
 #include "World/WorldSettings.hpp"
+#include "World/Chunk/ChunkCollider.hpp"
+#include "World/Chunk/PaletteStorage.hpp"
 #include "World/Chunk/Renderer/GrassRenderer.hpp"
 #include "World/Chunk/Renderer/TerrainRenderer.hpp"
 #include "World/Chunk/Renderer/EighthBlockRenderer.hpp"
@@ -49,10 +51,9 @@ public:
         Generating
     };
 
-    /// \brief The cubes in the chunks
-    ByteCube m_cubes[WorldSettings::s_chunkSize]
-                    [WorldSettings::s_chunkSize]
-                    [WorldSettings::s_chunkSize];
+    /// \brief The dense cubes of the chunk, nullptr while the chunk is compressed
+    ByteCube (* m_cubes)[WorldSettings::s_chunkSize]
+                        [WorldSettings::s_chunkSize];
 
     /// \brief Constructor
     Chunk();
@@ -69,12 +70,61 @@ public:
     /// \brief Returns the chunk state
     inline EChunkState GetState() const;
 
+    /// \brief Sets the chunk state
+    inline void SetState(EChunkState state);
+
     /// \brief Returns the chunk index
     inline glm::tvec3<int> GetChunkIndex() const;
 
+    /// \brief  Returns the cube at the given chunk coordinates
+    /// \return The cube
+    inline ByteCube GetCube(uint x, uint y, uint z) const;
+
+    /// \brief Sets the cube at the given chunk coordinates
+    /// \param cube The new cube
+    inline void SetCube(uint x, uint y, uint z, ByteCube const& cube);
+
+    /// \brief  Returns a pointer on the cube at the given chunk coordinates
+    /// \remark Decompresses the chunk, the pointer is valid until the next compression
+    inline ByteCube * GetMutableCube(uint x, uint y, uint z);
+
+    /// \brief Fills the whole chunk with the given cube, releases the dense cubes
+    /// \param cube The cube
+    void Fill(ByteCube const& cube);
+
+    /// \brief Copies the cubes into the palette storage, releases the dense cubes
+    /// \param pCubes The s_chunkBlockCount cubes, indexed like the dense cubes
+    void Assign(ByteCube const* pCubes);
+
+    /// \brief Moves the cubes into the palette storage and releases the dense cubes
+    void Compress();
+
+    /// \brief Moves the cubes back into a dense array
+    void Decompress();
+
+    /// \brief Tells if the cubes are stored in the palette
+    inline bool IsCompressed() const;
+
+    /// \brief Returns the number of bytes used to store the cubes
+    size_t GetStorageFootprint() const;
+
+    /// \brief Returns the number of terrain triangles of the last batch
+    inline size_t GetTerrainTriangleCount() const;
+
     /// \brief Batch the cubes do display them
+    /// \param  buffers The scratch buffers of the calling batching job
     /// \remark Should be called whenever a chunk cube state changes
-    void Batch();
+    void Batch(WorldBuffers & buffers);
+
+    /// \brief  Uploads the last batch to the GPU and swaps the collider
+    /// \remark Must be called from the thread that owns the GL context
+    void Upload();
+
+    /// \brief Releases the geometry of the renderers and the collider
+    void Clear();
+
+    /// \brief Returns the static collider of the chunk
+    inline ChunkCollider & GetCollider();
 
 private:
 
@@ -83,6 +133,8 @@ private:
     int         m_chunkIndexY;
     int         m_chunkIndexZ;
 
+    PaletteStorage          m_storage;
+    ChunkCollider           m_collider;
     Chunk *                 m_neighbors[6];
     GrassRenderer           m_grassRenderer;
     TerrainRenderer         m_terrainRenderer;
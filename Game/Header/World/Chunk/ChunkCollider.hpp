@@ -0,0 +1,89 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ChunkCollider.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_CHUNK_COLLIDER_HPP__
+#define CARDINAL_ENGINE_CHUNK_COLLIDER_HPP__
+
+#include <vector>
+#include "Glm/glm/glm.hpp"
+
+#include "Runtime/Physics/RigidBody.hpp"
+#include "Runtime/Physics/CollisionShape.hpp"
+
+/// \class ChunkCollider
+/// \brief Static triangle mesh collider of a chunk
+///        The shape is built by the batching job of the chunk, the main
+///        thread then swaps the rigid body in the physics world
+class ChunkCollider
+{
+public:
+
+    /// \brief Constructor
+    ChunkCollider();
+
+    /// \brief Destructor, releases the body and the shapes
+    ~ChunkCollider();
+
+    /// \brief  Builds the shape of the given triangles, can be called from any thread
+    /// \param  vertices The vertices of the triangles, in world space
+    /// \remark No triangle means no body once uploaded
+    void Build(std::vector<glm::vec3> const& vertices);
+
+    /// \brief  Replaces the rigid body by one using the last built shape
+    /// \remark Must be called from the thread that steps the physics
+    void Upload();
+
+    /// \brief Adds or removes the body from the physics world
+    /// \param bEnabled True to let dynamic bodies collide with the chunk
+    void SetEnabled(bool bEnabled);
+
+    /// \brief Releases the body and drops the pending shape
+    void Clear();
+
+    /// \brief Tells if the body is allowed in the physics world
+    inline bool IsEnabled() const;
+
+    /// \brief Tells if a shape is waiting to be uploaded
+    inline bool IsPending() const;
+
+    /// \brief Tells if the chunk has a rigid body
+    inline bool HasBody() const;
+
+private:
+
+    /// \brief Removes the body from the physics world and deletes it
+    void ReleaseBody();
+
+private:
+
+    bool                    m_bPending;
+    bool                    m_bEnabled;
+    bool                    m_bInWorld;       ///< The body is in the physics world
+    cardinal::VertexShape * m_pPendingShape;  ///< nullptr when the last batch had no triangle
+    cardinal::VertexShape * m_pShape;
+    cardinal::RigidBody   * m_pBody;
+};
+
+#include "World/Chunk/Impl/ChunkCollider.inl"
+
+#endif // !CARDINAL_ENGINE_CHUNK_COLLIDER_HPP__
@@ -27,8 +27,65 @@ inline Chunk::EChunkState Chunk::GetState() const
    return m_state;
 }
 
+/// \brief Sets the chunk state
+inline void Chunk::SetState(EChunkState state)
+{
+    m_state = state;
+}
+
 /// \brief Returns the chunk index
 glm::tvec3<int> Chunk::GetChunkIndex() const
 {
     return glm::tvec3<int>(m_chunkIndexX, m_chunkIndexY, m_chunkIndexZ);
 }
+
+/// \brief Returns the static collider of the chunk
+inline ChunkCollider & Chunk::GetCollider()
+{
+    return m_collider;
+}
+
+/// \brief Returns the number of terrain triangles of the last batch
+inline size_t Chunk::GetTerrainTriangleCount() const
+{
+    return m_terrainRenderer.GetTriangleCount();
+}
+
+/// \brief  Returns the cube at the given chunk coordinates
+/// \return The cube
+inline ByteCube Chunk::GetCube(uint x, uint y, uint z) const
+{
+    if(m_cubes != nullptr)
+    {
+        return m_cubes[x][y][z];
+    }
+
+    return m_storage.Get((x * WorldSettings::s_chunkSize + y) * WorldSettings::s_chunkSize + z);
+}
+
+/// \brief Sets the cube at the given chunk coordinates
+/// \param cube The new cube
+inline void Chunk::SetCube(uint x, uint y, uint z, ByteCube const& cube)
+{
+    if(m_cubes != nullptr)
+    {
+        m_cubes[x][y][z] = cube;
+        return;
+    }
+
+    m_storage.Set((x * WorldSettings::s_chunkSize + y) * WorldSettings::s_chunkSize + z, cube);
+}
+
+/// \brief  Returns a pointer on the cube at the given chunk coordinates
+/// \remark Decompresses the chunk, the pointer is valid until the next compression
+inline ByteCube * Chunk::GetMutableCube(uint x, uint y, uint z)
+{
+    Decompress();
+    return &m_cubes[x][y][z];
+}
+
+/// \brief Tells if the cubes are stored in the palette
+inline bool Chunk::IsCompressed() const
+{
+    return m_cubes == nullptr;
+}
@@ -0,0 +1,54 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PaletteStorage.inl
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk/Impl
+/// \author     Vincent STEHLY--CALISTO
+
+/// \brief  Returns the cube at the given index
+/// \param  index The index of the cube
+/// \return The cube
+inline ByteCube PaletteStorage::Get(uint index) const
+{
+    return m_bitsPerIndex == 0 ? m_palette[0] : m_palette[GetIndex(index)];
+}
+
+/// \brief Tells if all cubes are the same
+inline bool PaletteStorage::IsUniform() const
+{
+    return m_bitsPerIndex == 0;
+}
+
+/// \brief Writes the palette index of the given cube
+/// \remark Indexes never straddle two words as the bit count divides 64
+inline void PaletteStorage::SetIndex(uint index, uint paletteIndex)
+{
+    uint     bit   = index * m_bitsPerIndex;
+    uint64_t mask  = ((uint64_t(1) << m_bitsPerIndex) - 1) << (bit & 63);
+    uint64_t & word = m_indexes[bit >> 6];
+
+    word = (word & ~mask) | ((uint64_t(paletteIndex) << (bit & 63)) & mask);
+}
+
+/// \brief Reads the palette index of the given cube
+inline uint PaletteStorage::GetIndex(uint index) const
+{
+    uint bit = index * m_bitsPerIndex;
+    return static_cast<uint>((m_indexes[bit >> 6] >> (bit & 63)) & ((uint64_t(1) << m_bitsPerIndex) - 1));
+}
@@ -0,0 +1,102 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PaletteStorage.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_PALETTE_STORAGE_HPP__
+#define CARDINAL_ENGINE_PALETTE_STORAGE_HPP__
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "Runtime/Platform/Configuration/Configuration.hh"
+
+#include "World/WorldSettings.hpp"
+#include "World/Cube/ByteCube.hpp"
+
+/// \class PaletteStorage
+/// \brief Compressed storage of the cubes of a chunk
+///        Each cube is a bit packed index in a palette of the distinct cubes
+///        of the chunk. Indexes use 1, 2, 4 or 8 bits depending on the size
+///        of the palette, uniform chunks only store their single cube.
+///        Cubes are indexed like the dense array : (x * size + y) * size + z
+class PaletteStorage
+{
+public:
+
+    /// \brief Constructor, the storage is filled with default cubes
+    PaletteStorage();
+
+    /// \brief Fills the whole storage with the given cube
+    /// \param cube The cube
+    void Fill(ByteCube const& cube);
+
+    /// \brief Compresses the given dense cubes
+    /// \param pCubes The s_chunkBlockCount cubes of the chunk
+    void Assign(ByteCube const* pCubes);
+
+    /// \brief Decompresses the cubes
+    /// \param pCubes The s_chunkBlockCount cubes to fill
+    void Extract(ByteCube * pCubes) const;
+
+    /// \brief  Returns the cube at the given index
+    /// \param  index The index of the cube
+    /// \return The cube
+    inline ByteCube Get(uint index) const;
+
+    /// \brief Sets the cube at the given index
+    /// \param index The index of the cube
+    /// \param cube The new cube
+    void Set(uint index, ByteCube const& cube);
+
+    /// \brief Tells if all cubes are the same
+    inline bool IsUniform() const;
+
+    /// \brief  Returns the number of bytes used by the storage
+    /// \return The memory footprint in bytes
+    size_t GetMemoryFootprint() const;
+
+private:
+
+    /// \brief  Returns the palette index of the cube, adds it if needed
+    /// \return The palette index
+    uint GetPaletteIndex(ByteCube const& cube);
+
+    /// \brief Repacks the indexes with the given number of bits
+    void Repack(uint bitsPerIndex);
+
+    /// \brief Writes the palette index of the given cube
+    inline void SetIndex(uint index, uint paletteIndex);
+
+    /// \brief Reads the palette index of the given cube
+    inline uint GetIndex(uint index) const;
+
+private:
+
+    uint                  m_bitsPerIndex;
+    std::vector<ByteCube> m_palette;
+    std::vector<uint64_t> m_indexes;
+};
+
+#include "World/Chunk/Impl/PaletteStorage.inl"
+
+#endif // !CARDINAL_ENGINE_PALETTE_STORAGE_HPP__
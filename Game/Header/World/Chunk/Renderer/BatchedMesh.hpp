@@ -0,0 +1,72 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BatchedMesh.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk/Renderer
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_BATCHED_MESH_HPP__
+#define CARDINAL_ENGINE_BATCHED_MESH_HPP__
+
+#include <vector>
+#include "Glm/glm/glm.hpp"
+
+#include "Runtime/Platform/Configuration/Configuration.hh"
+#include "Runtime/Rendering/Renderer/MeshRenderer.hpp"
+
+/// \class BatchedMesh
+/// \brief Holds the indexed geometry produced by a chunk batching job
+///        until the main thread uploads it to the GPU
+class BatchedMesh
+{
+public:
+
+    /// \brief Copies the indexed geometry, can be called from any thread
+    /// \param indexes The indexes of the mesh
+    /// \param vertices The vertices of the mesh
+    /// \param normals The normals of the mesh
+    /// \param uvs The uvs of the mesh
+    void Store(std::vector<uint>      const& indexes,
+               std::vector<glm::vec3> const& vertices,
+               std::vector<glm::vec3> const& normals,
+               std::vector<glm::vec2> const& uvs);
+
+    /// \brief Uploads the pending geometry and releases it
+    /// \param pRenderer The renderer to initialize
+    /// \remark Must be called from the thread that owns the GL context
+    void Upload(cardinal::MeshRenderer * pRenderer);
+
+    /// \brief Drops the pending geometry without uploading it
+    void Clear();
+
+    /// \brief Tells if some geometry is waiting to be uploaded
+    inline bool IsPending() const;
+
+private:
+
+    bool                   m_isPending = false;
+    std::vector<uint>      m_indexes;
+    std::vector<glm::vec3> m_vertices;
+    std::vector<glm::vec3> m_normals;
+    std::vector<glm::vec2> m_uvs;
+};
+
+#include "World/Chunk/Renderer/Impl/BatchedMesh.inl"
+
+#endif // !CARDINAL_ENGINE_BATCHED_MESH_HPP__
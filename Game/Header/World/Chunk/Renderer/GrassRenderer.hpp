@@ -32,6 +32,7 @@
 #include "World/Detail/Grass.hpp"
 #include "World/Cube/ByteCube.hpp"
 #include "Runtime/Rendering/Renderer/MeshRenderer.hpp"
+#include "World/Chunk/Renderer/BatchedMesh.hpp"
 
 /// \class GrassRenderer
 /// \brief Renders all grass blocks in the chunks
@@ -43,7 +44,15 @@ public:
 
     /// \brief Static batching for terrain cubes
     /// \param pCubes The cubes of the chunk
-    void Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6]);
+    /// \param buffers The scratch buffers of the calling batching job
+    void Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6], WorldBuffers & buffers);
+
+    /// \brief  Uploads the last batch to the GPU
+    /// \remark Must be called from the thread that owns the GL context
+    void Upload();
+
+    /// \brief Releases the geometry of the renderer
+    void Clear();
 
     /// \brief Sets the world position
     void SetPosition(glm::vec3 const& position);
@@ -52,6 +61,7 @@ private:
 
     glm::vec3                m_model;
     cardinal::MeshRenderer * m_renderer = nullptr;
+    BatchedMesh              m_mesh;
 };
 
 #endif // !CARDINAL_ENGINE_GRASS_RENDERER_HPP__
\ No newline at end of file
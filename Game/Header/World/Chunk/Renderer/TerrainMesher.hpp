@@ -0,0 +1,66 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainMesher.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk/Renderer
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_TERRAIN_MESHER_HPP__
+#define CARDINAL_ENGINE_TERRAIN_MESHER_HPP__
+
+// Game
+#include "World/WorldBuffers.hpp"
+#include "World/WorldSettings.hpp"
+#include "World/Cube/ByteCube.hpp"
+
+/// \class TerrainMesher
+/// \brief Builds the geometry of the terrain cubes of a chunk
+///        Only fills the buffers, the GPU upload is left to the TerrainRenderer
+class TerrainMesher
+{
+public:
+
+    /// \brief The layers of the neighbor chunks touching each side of a chunk
+    ///        Sides follow the order of Chunk::SetNeighbors, a cube of a side
+    ///        is indexed by its two coordinates along the side in x, y, z order
+    struct Borders
+    {
+        bool     m_bNeighbor[6]; ///< A side without neighbor hides nothing
+        ByteCube m_cubes    [6][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+    };
+
+    /// \brief  Emits the terrain geometry of a chunk and indexes it
+    /// \param  pCubes The cubes of the chunk
+    /// \param  borders The cubes of the neighbor chunks
+    /// \param  bGreedy Merges coplanar faces of the same type
+    /// \param  buffers The scratch buffers. The emitted vertices stay in the
+    ///         chunk buffers and the indexed ones in the indexed buffers.
+    /// \return The number of emitted vertices, 3 per triangle
+    static size_t Build(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, bool bGreedy, WorldBuffers & buffers);
+
+    /// \brief  Emits 6 vertices per visible face
+    /// \return The number of emitted vertices
+    static size_t BatchFaces(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, WorldBuffers & buffers);
+
+    /// \brief  Merges coplanar visible faces of the same type into rectangles
+    /// \return The number of emitted vertices
+    static size_t BatchGreedy(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, WorldBuffers & buffers);
+};
+
+#endif // !CARDINAL_ENGINE_TERRAIN_MESHER_HPP__
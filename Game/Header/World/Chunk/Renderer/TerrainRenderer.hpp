@@ -32,6 +32,7 @@
 
 // Game
 #include "World/WorldBuffers.hpp"
+#include "World/Chunk/Renderer/BatchedMesh.hpp"
 #include "World/Cube/ByteCube.hpp"
 
 /// \class TerrainRenderer
@@ -45,15 +46,31 @@ public:
 
     /// \brief Static batching for terrain cubes
     /// \param pCubes The cubes of the chunk
-    void Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6]);
+    /// \param buffers The scratch buffers of the calling batching job
+    void Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6], WorldBuffers & buffers);
+
+    /// \brief  Uploads the last batch to the GPU
+    /// \remark Must be called from the thread that owns the GL context
+    void Upload();
+
+    /// \brief Releases the geometry of the renderer
+    void Clear();
 
     /// \brief Sets the world position
     void SetPosition(glm::vec3 const& position);
 
+    /// \brief  Returns the number of triangles of the last batch
+    /// \return The triangle count
+    inline size_t GetTriangleCount() const;
+
 private:
 
     glm::vec3                m_model;
+    size_t                   m_triangleCount = 0;
     cardinal::MeshRenderer * m_renderer = nullptr;
+    BatchedMesh              m_mesh;
 };
 
+#include "World/Chunk/Renderer/Impl/TerrainRenderer.inl"
+
 #endif // !CARDINAL_ENGINE_TERRAIN_RENDERER_HPP__
\ No newline at end of file
@@ -5,386 +5,138 @@
 #ifndef CARDINALENGINE_CHUNKREGULATOR_HPP
 #define CARDINALENGINE_CHUNKREGULATOR_HPP
 
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
 
 #include <ThirdParty/Glm/glm/vec3.hpp>
 #include <Header/Runtime/Rendering/Renderer/TextRenderer.hpp>
 #include <World/Cube/ByteCube.hpp>
 #include <World/Chunk/Chunk.hpp>
 #include "WorldSettings.hpp"
+#include "WorldBuffers.hpp"
 #include "World.hpp"
 
-// TODO Call the generator to generate a new chunk.
-
-// DONT USE THIS CLASS FOR NOW
-
 /// \class ChunkRegulator
-/// \brief Manage the generation of non generated chunk of the world
+/// \brief Streams the chunks of the world around the player
+///        When the player crosses a chunk boundary, the newly exposed slice
+///        of chunks is generated and batched by background workers. The ring
+///        of chunks of the world is only shifted once the whole slice is uploaded.
+/// \remark The workers are owned by the regulator and not taken from the worker
+///         pool of the engine : their jobs run across frames while the pool only
+///         runs blocking batches, which would stall the frame until the slice is done.
 class ChunkRegulator {
 public:
 
-    ChunkRegulator(World* world);
-
-/// \brief Updates the world from the character position
-/// \param position The position of the character
-/// \param dt The elasped time
-    void Update(const glm::vec3 &position, float dt)
-    {
-        // Updating debug text
-        // Computing player position
-        int posX = (int)position.x / ByteCube::s_cubeSize;
-        int posY = (int)position.y / ByteCube::s_cubeSize;
-        int posZ = (int)position.z / ByteCube::s_cubeSize;
-
-        int chunkX = posX / (int)WorldSettings::s_chunkSize;
-        int chunkY = posY / (int)WorldSettings::s_chunkSize;
-        int chunkZ = posZ / (int)WorldSettings::s_chunkSize;
+    /// \brief Fills the cubes of a streamed chunk
+    /// \remark Called from the streaming workers, must be thread safe
+    typedef std::function<void(Chunk &)> ChunkGenerator;
 
-        glm::tvec3<int> currentPosition(chunkX, chunkY, chunkZ);
-
-        std::string _cube  = "Cube : "  + std::to_string(posX)   + " " + std::to_string(posY)   + " " + std::to_string(posZ);
-        std::string _chunk = "Chunk : " + std::to_string(chunkX) + " " + std::to_string(chunkY) + " " + std::to_string(chunkZ);
-
-        m_playerChunkText->SetText(_cube.c_str(),  680, 530, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-        m_playerCubeText->SetText (_chunk.c_str(), 680, 515, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-
-        // Debug draw
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-                {
-                    glm::vec3 boxColor;
-                    glm::tvec3<int> chunkIndex = mp_world->m_chunks[x][y][z]->GetChunkIndex();
-
-                    if(chunkIndex.x == chunkX && chunkIndex.y == chunkY && chunkIndex.z == chunkZ)
-                    {
-                        boxColor = glm::vec3(1.0f, 0.0f, 0.0f);
-                    }
-                    else if(mp_world->m_chunks[x][y][z]->GetState() == Chunk::EChunkState::Generated)
-                    {
-                        boxColor = glm::vec3(0.0f, 1.0f, 0.0f);
-                    }
+    /// \brief Constructor
+    /// \param world The world to stream
+    ChunkRegulator(World* world);
 
-                    int chunkSize = (int)WorldSettings::s_chunkSize; // NOLINT
-                    cardinal::debug::DrawBox(glm::vec3(
-                            (chunkIndex.x * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f,
-                            (chunkIndex.y * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f,
-                            (chunkIndex.z * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f),
-                                    chunkSize * ByteCube::s_cubeSize,
-                                    chunkSize * ByteCube::s_cubeSize, boxColor);
+    /// \brief Destructor, cancels all jobs and stops the workers
+    ~ChunkRegulator();
 
-                }
-            }
-        }
+    /// \brief Sets the function filling the cubes of the streamed chunks
+    ///        Without generator, streamed chunks are filled with air
+    /// \param generator The generator
+    void SetChunkGenerator(ChunkGenerator const& generator);
 
-        // Checking delta position
-        glm::tvec3<int> delta = currentPosition - m_lastPlayerPos;
-        m_lastPlayerPos       = currentPosition;
+    /// \brief Updates the world from the character position
+    /// \param position The position of the character
+    /// \param dt The elasped time
+    void Update(const glm::vec3 &position, float dt);
 
-        CheckChunkDelta(delta);
-    }
 private:
 
-    World* mp_world;
-    cardinal::TextRenderer * m_playerCubeText;
-    cardinal::TextRenderer * m_playerChunkText;
-
-    glm::tvec3<int> m_lastPlayerPos;
-
-/// \brief Checks if the player changed of chunks
-/// \param delta The delta position (in chunks unit)
-    void CheckChunkDelta(glm::tvec3<int> const& delta)
+    /// \brief A chunk generated and batched in background
+    struct StreamingJob
     {
-        // The player is now one chunk further on X
-        if(delta.x == 1)
-        {
-            UpdateChunksXPositive();
-        }
-        // The player is now one chunk less on X
-        if(delta.x == -1)
-        {
-            UpdateChunksXNegative();
-        }
-        // The player is now one chunk further on Y
-        if(delta.y == 1)
-        {
-            UpdateChunksYPositive();
-        }
-        // The player is now one chunk less on Y
-        if(delta.y == -1)
-        {
-            UpdateChunksYNegative();
-        }
-        // The player is now one chunk further on Z
-        if(delta.z == 1)
-        {
-            UpdateChunksZPositive();
-        }
-        // The player is now one chunk less on Z
-        if(delta.z == -1)
-        {
-            UpdateChunksZNegative();
-        }
-    }
-
-/// \briefs If this method is called, all last chunks
-///         will translate on X
-    void UpdateChunksXPositive()
+        Chunk *           m_pChunk;
+        glm::tvec3<int>   m_chunkIndex;  ///< The chunk index in the world
+        glm::tvec3<int>   m_ringIndex;   ///< The destination in the ring of chunks
+        std::atomic<bool> m_bCancelled;  ///< The job is stale and must be dropped
+        bool              m_bUploaded;   ///< The chunk is on the GPU
+    };
+
+    /// \brief A translation of the ring of chunks waiting for its slice
+    struct PendingShift
     {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matHeight);
-
-        // Push all pointers that will be moved in the buffer
-        for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[0][y][z]);
-            }
-        }
+        int                         m_axis;
+        int                         m_direction;
+        std::vector<StreamingJob *> m_jobs;
+    };
 
-        // Translate pointers
-        for(uint x = 1; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-                {
-                    mp_world->m_chunks[x - 1][y][z] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
+    /// \brief Worker loop, generates and batches the closest queued chunk
+    /// \param nWorker The index of the worker
+    void WorkerLoop(size_t nWorker);
 
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[WorldSettings::s_matSize - 1][y][z]->GetChunkIndex();
+    /// \brief Checks if the player changed of chunks
+    ///        The ring spans the whole height of the terrain, it only moves horizontally
+    /// \param delta The delta position (in chunks unit)
+    void CheckChunkDelta(glm::tvec3<int> const& delta);
 
-                mp_world->m_chunks[WorldSettings::s_matSize - 1][y][z] = pointerBuffer.at(index++);
-                //std::thread t1(&Chunk::Initialize, m_chunks[WorldSettings::s_matSize - 1][y][z], previousPosition.x + 1, previousPosition.y, previousPosition.z);
-                //t1.detach();
-                mp_world->m_chunks[WorldSettings::s_matSize - 1][y][z]->Initialize(previousPosition.x + 1, previousPosition.y, previousPosition.z);
-            }
-        }
-    }
+    /// \brief Queues the jobs of the slice exposed by a translation of the ring
+    /// \param axis The axis of the translation
+    /// \param direction 1 or -1
+    void QueueShift(int axis, int direction);
 
-/// \briefs If this method is called, all last chunks
-///         will translate on -X
-    void UpdateChunksXNegative()
-    {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matHeight);
+    /// \brief Cancels the last pending shift, its jobs are dropped
+    void CancelLastShift();
 
-        // Push all pointers that will be moved in the buffer
-        for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[WorldSettings::s_matSize - 1][y][z]);
-            }
-        }
+    /// \brief Uploads ready chunks within the frame budget
+    void UploadReadyChunks();
 
-        // Translate pointers
-        for(int x = WorldSettings::s_matSize - 2; x >= 0; x--)
-        {
-            for(int y = WorldSettings::s_matSize - 1; y >= 0; y--)
-            {
-                for(int z = WorldSettings::s_matHeight - 1; z >= 0; z--)
-                {
-                    mp_world->m_chunks[x + 1][y][z] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
+    /// \brief Applies the pending shifts whose slice is fully uploaded
+    void ApplyReadyShifts();
 
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[0][y][z]->GetChunkIndex();
+    /// \brief Translates the ring of chunks and inserts the new slice
+    ///        The neighbors are linked again and the seam is batched again
+    /// \param shift The shift to apply
+    void ApplyShift(PendingShift const& shift);
 
-                mp_world->m_chunks[0][y][z] = pointerBuffer.at(index++);
-                mp_world->m_chunks[0][y][z]->Initialize(previousPosition.x - 1, previousPosition.y, previousPosition.z);
-            }
-        }
-    }
-
-    void UpdateChunksYPositive()
-    {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matHeight);
+    /// \brief Returns a chunk out of the ring, allocating it if needed
+    Chunk * AllocateSpareChunk();
 
-        // Push all pointers that will be moved in the buffer
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[x][0][z]);
-            }
-        }
+    /// \brief Returns the size of the ring along the given axis
+    static int GetRingSize(int axis);
 
-        // Translate pointers
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 1; y < WorldSettings::s_matSize; ++y)
-            {
-                for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-                {
-                    mp_world->m_chunks[x][y - 1][z] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
+    /// \brief Returns the chunk of the ring at the given index
+    Chunk *& GetRingChunk(glm::tvec3<int> const& ringIndex);
 
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[x][WorldSettings::s_matSize - 1][z]->GetChunkIndex();
+    /// \brief Returns the squared distance between two chunk indexes
+    static int GetSquaredDistance(glm::tvec3<int> const& a, glm::tvec3<int> const& b);
 
-                mp_world->m_chunks[x][WorldSettings::s_matSize - 1][z] = pointerBuffer.at(index++);
-                mp_world->m_chunks[x][WorldSettings::s_matSize - 1][z]->Initialize(previousPosition.x, previousPosition.y + 1, previousPosition.z);
-            }
-        }
-    }
-
-    void UpdateChunksYNegative()
-    {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matHeight);
-
-        // Push all pointers that will be moved in the buffer
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[x][WorldSettings::s_matSize - 1][z]);
-            }
-        }
-
-        // Translate pointers
-        for(int x = WorldSettings::s_matSize - 1; x >= 0; x--)
-        {
-            for(int y = WorldSettings::s_matSize - 2; y >= 0; y--)
-            {
-                for(int z = WorldSettings::s_matHeight - 1; z >= 0; z--)
-                {
-                    mp_world->m_chunks[x][y + 1][z] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
-
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[x][0][z]->GetChunkIndex();
-
-                mp_world->m_chunks[x][0][z] = pointerBuffer.at(index++);
-                mp_world->m_chunks[x][0][z]->Initialize(previousPosition.x, previousPosition.y - 1, previousPosition.z);
-            }
-        }
-    }
-
-    void UpdateChunksZPositive()
-    {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matSize);
-
-        // Push all pointers that will be moved in the buffer
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[x][y][0]);
-            }
-        }
-
-        // Translate pointers
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                for(uint z = 1; z < WorldSettings::s_matHeight; ++z)
-                {
-                    mp_world->m_chunks[x][y][z - 1] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
-
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[x][y][WorldSettings::s_matHeight - 1]->GetChunkIndex();
-
-                mp_world->m_chunks[x][y][WorldSettings::s_matHeight - 1] = pointerBuffer.at(index++);
-                mp_world->m_chunks[x][y][WorldSettings::s_matHeight - 1]->Initialize(previousPosition.x, previousPosition.y, previousPosition.z + 1);
-            }
-        }
-    }
-
-    void UpdateChunksZNegative()
-    {
-        // Buffering all last pointers
-        std::vector<Chunk *> pointerBuffer;
-        pointerBuffer.reserve(WorldSettings::s_matSize * WorldSettings::s_matSize);
-
-        // Push all pointers that will be moved in the buffer
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                pointerBuffer.push_back(mp_world->m_chunks[x][y][WorldSettings::s_matHeight - 1]);
-            }
-        }
-
-        // Translate pointers
-        for(int x = WorldSettings::s_matSize - 1; x >= 0; x--)
-        {
-            for(int y = WorldSettings::s_matSize - 1; y >= 0; y--)
-            {
-                for(int z = WorldSettings::s_matHeight - 2; z >= 0; z--)
-                {
-                    mp_world->m_chunks[x][y][z + 1] = mp_world->m_chunks[x][y][z];
-                }
-            }
-        }
+private:
 
-        // Updating front pointers
-        // Push all pointers that will be moved in the buffer
-        size_t index = 0;
-        for(uint x = 0; x < WorldSettings::s_matSize; ++x)
-        {
-            for(uint y = 0; y < WorldSettings::s_matSize; ++y)
-            {
-                glm::tvec3<int> previousPosition =  mp_world->m_chunks[x][y][0]->GetChunkIndex();
+    World* mp_world;
+    cardinal::TextRenderer * m_playerCubeText;
+    cardinal::TextRenderer * m_playerChunkText;
 
-                mp_world->m_chunks[x][y][0] = pointerBuffer.at(index++);
-                mp_world->m_chunks[x][y][0]->Initialize(previousPosition.x, previousPosition.y, previousPosition.z - 1);
-            }
-        }
-    }
+    glm::tvec3<int> m_lastPlayerPos;
+    bool            m_bTracking;    ///< The last player position is known
+    glm::tvec3<int> m_targetOrigin; ///< Index of the first chunk of the ring once all shifts are applied
+
+    ChunkGenerator             m_generator;
+    std::deque<PendingShift>   m_pendingShifts;
+    std::vector<Chunk *>       m_spareChunks;
+
+    // Shared with the workers
+    std::mutex                  m_mutex;
+    std::condition_variable     m_condition;
+    std::vector<StreamingJob *> m_queuedJobs;
+    std::vector<StreamingJob *> m_readyJobs;
+    glm::tvec3<int>             m_playerChunk;
+    bool                        m_bStop;
+
+    std::vector<std::thread>    m_workers;
+    std::vector<WorldBuffers>   m_buffers; ///< One arena per worker
 };
 
 
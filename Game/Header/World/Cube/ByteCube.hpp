@@ -109,6 +109,14 @@ public:
     /// \return True or false
     inline bool IsHeighthBlock() const;
 
+    /// \brief  Tells if both cubes have the same type and state
+    /// \return True or false
+    inline bool operator==(ByteCube const& other) const;
+
+    /// \brief  Tells if the cubes differ by their type or state
+    /// \return True or false
+    inline bool operator!=(ByteCube const& other) const;
+
 private:
 
    unsigned char m_properties;
@@ -110,3 +110,17 @@ bool ByteCube::IsHeighthBlock() const
     EType type = GetType();
     return (type == EType::EighthSnow);
 }
+
+/// \brief  Tells if both cubes have the same type and state
+/// \return True or false
+inline bool ByteCube::operator==(ByteCube const& other) const
+{
+    return m_properties == other.m_properties;
+}
+
+/// \brief  Tells if the cubes differ by their type or state
+/// \return True or false
+inline bool ByteCube::operator!=(ByteCube const& other) const
+{
+    return m_properties != other.m_properties;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <random>
+#include <functional>
 #include <World/World.hpp>
+#include "World/ChunkRegulator.hpp"
 #include "World/Generator/GenerationSettings.hpp"
+#include "World/Generator/TerrainGenerator.hpp"
 
 class BasicWorldGenerator
 {
@@ -11,6 +14,10 @@ public:
     World* generateWorld();
     World* generateWorld(GenerationSettings settings);
     World* regenerateWorld(GenerationSettings settings);
+
+    // Returns a generator of the chunks streamed by a ChunkRegulator, with the current settings
+    // Streamed chunks get the same cubes as the generated world, the generator is thread safe
+    ChunkRegulator::ChunkGenerator getChunkGenerator() const;
     int m_seed;
 
 private:
@@ -20,16 +27,19 @@ private:
 
     void generate3DPerlinWorld();
     void generateFBNWorld();
-    void generateHeights();
     void generateCavesWithCA();
-    void generateTrees(int number);
-    void generateTree(int x, int y, int z);
-    void generateGrass();
+
+    // Generates the heights, the grass and the trees of the world, by chunk column
+    void generateTerrain();
 
 
     void generateCaves();
     void buildStack(int x, int y, int height, bool onlyIfZero = true);
 
+    // Runs the job on each chunk column of the world, on a pool of workers
+    // Jobs of different columns must not touch the same cubes
+    void forEachColumn(std::function<void(int chunkX, int chunkY)> const& job);
+
     //Creation du monde entier, en utilisant le mouvement brownien fractionnaire
     void generate_piles(int x1, int y1,
                         int x2, int y2,
@@ -213,6 +213,24 @@ public:
 	FN_DECIMAL GetWhiteNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z, FN_DECIMAL w) const;
 	FN_DECIMAL GetWhiteNoiseInt(int x, int y, int z, int w) const;
 
+	//Grid
+	// Enables the SIMD path of FillNoiseGrid(...) when the CPU supports it
+	// Perlin, Simplex and their fractal variants are vectorized, other types always use GetNoise(...)
+	// Default: true
+	void SetGridSIMD(bool gridSIMD) { m_gridSIMD = gridSIMD; }
+
+	// Returns true if FillNoiseGrid(...) may use the SIMD path
+	bool GetGridSIMD() const { return m_gridSIMD; }
+
+	// Returns true if the CPU supports the SIMD path of FillNoiseGrid(...)
+	static bool IsGridSIMDSupported();
+
+	// Fills out[width * height] with GetNoise(x0 + i * step, y0 + j * step) at out[j * width + i]
+	void FillNoiseGrid(FN_DECIMAL* out, FN_DECIMAL x0, FN_DECIMAL y0, int width, int height, FN_DECIMAL step = 1) const;
+
+	// Fills out[width * height * depth] with GetNoise(x0 + i * step, y0 + j * step, z0 + k * step) at out[(k * height + j) * width + i]
+	void FillNoiseGrid(FN_DECIMAL* out, FN_DECIMAL x0, FN_DECIMAL y0, FN_DECIMAL z0, int width, int height, int depth, FN_DECIMAL step = 1) const;
+
 private:
 	unsigned char m_perm[512];
 	unsigned char m_perm12[512];
@@ -237,8 +255,12 @@ private:
 
 	FN_DECIMAL m_gradientPerturbAmp = FN_DECIMAL(1);
 
+	bool m_gridSIMD = true;
+
 	void CalculateFractalBounding();
 
+	bool UseGridSIMD() const;
+
 	//2D
 	FN_DECIMAL SingleValueFractalFBM(FN_DECIMAL x, FN_DECIMAL y) const;
 	FN_DECIMAL SingleValueFractalBillow(FN_DECIMAL x, FN_DECIMAL y) const;
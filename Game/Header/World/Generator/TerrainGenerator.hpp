@@ -0,0 +1,125 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainGenerator.hpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Generator
+/// \author     Vincent STEHLY--CALISTO
+
+#ifndef CARDINAL_ENGINE_TERRAIN_GENERATOR_HPP__
+#define CARDINAL_ENGINE_TERRAIN_GENERATOR_HPP__
+
+#include <vector>
+#include <functional>
+
+#include "Glm/glm/vec2.hpp"
+#include "Glm/glm/vec3.hpp"
+#include "Runtime/Core/Thread/WorkerPool.hpp"
+#include "World/WorldSettings.hpp"
+#include "World/Cube/ByteCube.hpp"
+#include "World/Generator/GenerationSettings.hpp"
+
+/// \class TerrainGenerator
+/// \brief Generates the terrain of the BasicWorldGenerator chunk by chunk
+///        Heights, grass and trees only depend on the settings and on the
+///        chunk index : any chunk can be generated alone, in any order and
+///        on any thread, and always gets the same cubes.
+///        Cubes are written like the dense cubes of a chunk : [x][y][z]
+class TerrainGenerator
+{
+public:
+
+    /// \brief Generation passes, seeded from the world seed
+    enum class Pass : unsigned { Grass = 1, Trees = 2, Caves = 3 };
+
+    /// \brief Receives a generated column of chunks
+    ///        pHeights holds the heights of the column [x][y],
+    ///        pCubes holds the cubes of its chunks, from the bottom one
+    /// \remark Called from the workers, once per column
+    typedef std::function<void(int chunkX, int chunkY, int const* pHeights, ByteCube const* pCubes)> ColumnSink;
+
+public:
+
+    /// \brief Constructor
+    /// \param settings The settings of the height noise
+    /// \param treesPerColumn The average number of trees per chunk column
+    TerrainGenerator(GenerationSettings const& settings, float treesPerColumn);
+
+    /// \brief Generates the cubes of a chunk
+    /// \param chunkIndex The index of the chunk
+    /// \param pCubes The s_chunkBlockCount cubes to fill
+    void GenerateChunk(glm::tvec3<int> const& chunkIndex, ByteCube * pCubes) const;
+
+    /// \brief Generates the chunks [0, chunkCount) of a column
+    /// \param chunkX The x index of the column
+    /// \param chunkY The y index of the column
+    /// \param chunkCount The number of chunks of the column
+    /// \param pHeights The s_chunkSize * s_chunkSize heights to fill, may be null
+    /// \param pCubes The chunkCount * s_chunkBlockCount cubes to fill
+    void GenerateColumn(int chunkX, int chunkY, int chunkCount, int * pHeights, ByteCube * pCubes) const;
+
+    /// \brief Generates the columns [0, columnCountX) x [0, columnCountY) on the pool
+    ///        The result does not depend on the number of threads of the pool
+    /// \param pool The pool running one job per column
+    /// \param columnCountX The number of columns along x
+    /// \param columnCountY The number of columns along y
+    /// \param chunkCount The number of chunks of each column
+    /// \param sink Receives the columns
+    void GenerateRegion(cardinal::WorkerPool & pool, int columnCountX, int columnCountY, int chunkCount, ColumnSink const& sink) const;
+
+    /// \brief  Returns a seed derived from the world seed, unique for a pass and a chunk column
+    /// \param  worldSeed The seed of the world
+    /// \param  pass The generation pass
+    /// \param  chunkX The x index of the column
+    /// \param  chunkY The y index of the column
+    /// \return The seed
+    static int GetRegionSeed(int worldSeed, Pass pass, int chunkX = 0, int chunkY = 0);
+
+private:
+
+    /// \brief The cubes of a column that do not depend on the height of a chunk
+    struct Column
+    {
+        int                           heights[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+        bool                          grass  [WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+        std::vector<glm::tvec2<int>>  trees; ///< Trunk positions in the column
+    };
+
+    /// \brief Evaluates the heights, the grass and the trees of a column
+    /// \param chunkX The x index of the column
+    /// \param chunkY The y index of the column
+    /// \param column The column to fill
+    void BuildColumn(int chunkX, int chunkY, Column & column) const;
+
+    /// \brief Writes the cubes of a chunk of the column
+    /// \param column The column
+    /// \param chunkZ The z index of the chunk
+    /// \param pCubes The s_chunkBlockCount cubes to fill
+    static void WriteChunk(Column const& column, int chunkZ, ByteCube * pCubes);
+
+private:
+
+    static const int s_trunkHeight = 4;
+
+    GenerationSettings m_settings;
+    FastNoise          m_heightNoise;
+    FastNoise          m_grassNoise;
+    float              m_treesPerColumn;
+};
+
+#endif // !CARDINAL_ENGINE_TERRAIN_GENERATOR_HPP__
@@ -28,18 +28,18 @@
 /// \return A pointer on the cube, could be nullptr
 inline ByteCube * World::GetCube(int x, int y, int z)
 {
-    ASSERT_GT(x, 0);
-    ASSERT_GT(y, 0);
-    ASSERT_GT(z, 0);
+    ASSERT_GT(x, -1);
+    ASSERT_GT(y, -1);
+    ASSERT_GT(z, -1);
 
-    ASSERT_LT(x, WorldSettings::s_matSizeCubes);
-    ASSERT_LT(y, WorldSettings::s_matSizeCubes);
-    ASSERT_LT(z, WorldSettings::s_matHeightCubes);
+    ASSERT_LT(x, static_cast<int>(WorldSettings::s_matSizeCubes));
+    ASSERT_LT(y, static_cast<int>(WorldSettings::s_matSizeCubes));
+    ASSERT_LT(z, static_cast<int>(WorldSettings::s_matHeightCubes));
 
     // Coordinates are conforms
-    return &(m_chunks[x /  WorldSettings::s_chunkSize]
-                     [y /  WorldSettings::s_chunkSize]
-                     [z /  WorldSettings::s_chunkSize]->m_cubes[x % WorldSettings::s_chunkSize]
-                                                               [y % WorldSettings::s_chunkSize]
-                                                               [z % WorldSettings::s_chunkSize]);
+    return m_chunks[x /  WorldSettings::s_chunkSize]
+                   [y /  WorldSettings::s_chunkSize]
+                   [z /  WorldSettings::s_chunkSize]->GetMutableCube(x % WorldSettings::s_chunkSize,
+                                                                     y % WorldSettings::s_chunkSize,
+                                                                     z % WorldSettings::s_chunkSize);
 }
@@ -24,11 +24,12 @@
 #ifndef CARDINAL_ENGINE_WORLD_HPP__
 #define CARDINAL_ENGINE_WORLD_HPP__
 
+#include <vector>
+
 // Engine
 #include <Header/Runtime/Rendering/Renderer/TextRenderer.hpp>
 #include "Runtime/Core/Assertion/Assert.hh"
 #include "Runtime/Rendering/Debug/Debug.hpp"
-#include "Runtime/Physics/RigidBody.hpp"
 
 // World
 #include "World/Chunk/Chunk.hpp"
@@ -59,6 +60,7 @@ public:
     inline ByteCube * GetCube(int x, int y, int z);
 
     /// \brief Updates the world from the character position
+    ///        Only the colliders of the chunks around the character stay in the physics world
     /// \param position The position of the character
     /// \param dt The elapsed time
     void Update(glm::vec3 const& position, float dt);
@@ -69,10 +71,28 @@ public:
     /// \brief Put air cube everywhere and disable them
     void Clean();
 
-    /// \brief Batch all the chunks
+    /// \brief Sets the neighbors of every chunk from its place in the grid
+    /// \remark Should be called whenever chunks move in the grid
+    void LinkNeighbors();
+
+    /// \brief  Batch all the chunks
     /// \remark Should be called whenever a cube state of the world changes
     void Batch();
 
+    /// \brief  Batches and uploads the given chunks, with their colliders
+    /// \param  chunks The chunks
+    /// \return The number of threads that meshed the chunks
+    /// \remark Chunks are meshed by a pool of workers while the calling thread
+    ///         uploads them to the GPU as soon as they are ready
+    size_t BatchChunks(std::vector<Chunk *> const& chunks);
+
+    /// \brief  Batches and uploads a single chunk, with its collider
+    /// \param  x The x chunk index
+    /// \param  y The y chunk index
+    /// \param  z The z chunk index
+    /// \remark Should be called whenever a cube state of the chunk changes
+    void BatchChunk(int x, int y, int z);
+
 private:
 
     void GetNeighbors(int x, int y, int z, Chunk * neighbors[6]);
@@ -82,7 +102,7 @@ private:
     cardinal::TextRenderer * m_worldText;
     cardinal::TextRenderer * m_cubeText;
     cardinal::TextRenderer * m_chunkText;
-    cardinal::RigidBody    * m_body;
+    std::vector<WorldBuffers> m_buffers; ///< One arena per batching worker
 };
 
 #include "World/Impl/World.inl"
@@ -30,31 +30,40 @@
 #include "Runtime/Core/Debug/Logger.hpp"
 #include "Runtime/Platform/Configuration/Configuration.hh"
 
+#include "World/WorldSettings.hpp"
+#include "World/Cube/ByteCube.hpp"
 #include "World/Detail/Grass.hpp"
 
 /// \class WorldBuffers
-/// \brief Stores usefull buffers to avoid memory allocations
+/// \brief Scratch buffers used while batching chunks to avoid memory allocations
+///        Each batching job owns its own instance and reuses it from one chunk
+///        to the next, so that several jobs can batch concurrently
 class WorldBuffers
 {
+public:
+
+    /// \brief Constructor, reserves all buffers
+    WorldBuffers();
+
 public:
 
     // Terrain
-    static std::vector<glm::vec2> s_chunkUVsBuffer;
-    static std::vector<glm::vec3> s_chunkVertexBuffer;
-    static std::vector<glm::vec3> s_chunkPhysicalVertexBuffer;
-    static std::vector<glm::vec3> s_chunkNormalBuffer;
-    static std::vector<ushort>    s_chunkIndexesBuffer;
-    static std::vector<glm::vec2> s_chunkIndexedUVsBuffer;
-    static std::vector<glm::vec3> s_chunkIndexedVertexBuffer;
-    static std::vector<glm::vec3> s_chunkIndexedNormalBuffer;
+    std::vector<glm::vec2> m_chunkUVsBuffer;
+    std::vector<glm::vec3> m_chunkVertexBuffer;
+    std::vector<glm::vec3> m_chunkPhysicalVertexBuffer;
+    std::vector<glm::vec3> m_chunkNormalBuffer;
+    std::vector<uint>      m_chunkIndexesBuffer;
+    std::vector<glm::vec2> m_chunkIndexedUVsBuffer;
+    std::vector<glm::vec3> m_chunkIndexedVertexBuffer;
+    std::vector<glm::vec3> m_chunkIndexedNormalBuffer;
 
     // Details
-    static std::vector<Grass> s_grassBuffer;
-
-public:
+    std::vector<Grass> m_grassBuffer;
 
-    /// \brief Initializes all world buffers
-    static void Initialize();
+    // Dense copy of the cubes of a compressed chunk
+    ByteCube m_chunkCubesBuffer[WorldSettings::s_chunkSize]
+                               [WorldSettings::s_chunkSize]
+                               [WorldSettings::s_chunkSize];
 };
 
 #endif // !CARDINAL_ENGINE_WORLD_BUFFERS_HPP__
\ No newline at end of file
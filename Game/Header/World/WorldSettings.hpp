@@ -47,6 +47,12 @@ public:
     static const uint s_matHeightCubes;
 
     static const float s_textureStep;
+
+    static const bool  s_greedyMeshing;
+    static const bool  s_compressChunks;
+    static const uint  s_streamingWorkers;
+    static const uint  s_streamingUploadBudget;
+    static const uint  s_colliderDistance;
 };
 
 /* static */  const uint WorldSettings::s_chunkSize        = 16;
@@ -60,6 +66,22 @@ public:
 /* static */  const uint WorldSettings::s_matHeightCubes = WorldSettings::s_matHeight * WorldSettings::s_chunkSize;
 
 /* static */  const float WorldSettings::s_textureStep = 1.0f / 16.0f;
+
+/// Merges coplanar faces of the same type into larger quads (see TerrainRenderer)
+/* static */  const bool  WorldSettings::s_greedyMeshing = true;
+
+/// Stores the cubes of batched chunks in a palette (see PaletteStorage)
+/* static */  const bool  WorldSettings::s_compressChunks = true;
+
+/// Number of threads generating and meshing the chunks streamed by the ChunkRegulator
+/// They live across frames, the fork-join pool of the engine can not host them
+/* static */  const uint  WorldSettings::s_streamingWorkers = 2;
+
+/// Maximum number of streamed chunks uploaded to the GPU per frame
+/* static */  const uint  WorldSettings::s_streamingUploadBudget = 4;
+
+/// Distance in chunks around the player within which chunk colliders are in the physics world
+/* static */  const uint  WorldSettings::s_colliderDistance = 2;
 }
 
 #endif // !CARDINAL_ENGINE_WORLD_SETTINGS_HPP__
@@ -68,7 +68,11 @@ void PhysicsCharacter::Update(cardinal::Window * pWindow, float dt)
     }
 
     glm::vec2 mousePos    (mouse.x, mouse.y);
-    glm::vec2 windowSize  (1600.0f, 900.0f);
+    int windowWidth  = 0;
+    int windowHeight = 0;
+    pWindow->GetSize(windowWidth, windowHeight);
+
+    glm::vec2 windowSize  (windowWidth, windowHeight);
     glm::vec2 windowCenter(windowSize.x /2, windowSize.y / 2);
 
     float maxMousePosRadius = glm::min(windowSize.x, windowSize.y) / 2.0f;
@@ -21,15 +21,16 @@
 /// \package    City
 /// \author     Vincent STEHLY--CALISTO
 
+#include <cstring>
+
 #include "Glew/include/GL/glew.h"
 #include "City/ProceduralBuildingRenderer.hpp"
+#include "Runtime/Rendering/Buffer/GLRingBufferStorage.hpp"
+#include "Runtime/Rendering/Optimization/StateCache.hpp"
 
 /// \brief Default constructor
 ProceduralBuildingRenderer::ProceduralBuildingRenderer() : cardinal::IRenderer()
 {
-    m_verticesObject = 0;
-    m_normalsObject  = 0;
-    m_uvsObject      = 0;
     m_elementsCount  = 0;
     m_isIndexed      = false;
 }
@@ -37,7 +38,9 @@ ProceduralBuildingRenderer::ProceduralBuildingRenderer() : cardinal::IRenderer()
 /// \brief Destructor
 ProceduralBuildingRenderer::~ProceduralBuildingRenderer() // NOLINT
 {
-    // TODO
+    m_verticesRing.Release();
+    m_normalsRing.Release();
+    m_uvsRing.Release();
 }
 
 /// \brief Initializes the mesh
@@ -49,46 +52,25 @@ void ProceduralBuildingRenderer::Initialize(
         std::vector<glm::vec3>      const &normals,
         std::vector<glm::vec2>      const &uvs)
 {
-    if (m_vao != 0)
-    {
-        glDeleteBuffers(1, &m_verticesObject);
-        glDeleteBuffers(1, &m_normalsObject);
-        glDeleteBuffers(1, &m_uvsObject);
-
-        m_verticesObject = 0;
-        m_normalsObject  = 0;
-        m_uvsObject      = 0;
-        m_elementsCount  = 0;
-    }
-    else if (m_vao == 0)
+    if (m_vao == 0)
     {
         glGenVertexArrays(1, &m_vao);
-    }
-
-    glBindVertexArray(m_vao);
-
-    glGenBuffers(1, &m_verticesObject);
-    glBindBuffer(GL_ARRAY_BUFFER, m_verticesObject);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(glm::vec3), &vertices[0], GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
-
-    glGenBuffers(1, &m_normalsObject);
-    glBindBuffer(GL_ARRAY_BUFFER, m_normalsObject);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(glm::vec3), &normals[0], GL_STATIC_DRAW);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
 
-    glGenBuffers(1, &m_uvsObject);
-    glBindBuffer(GL_ARRAY_BUFFER, m_uvsObject);
-    glBufferData(GL_ARRAY_BUFFER, uvs.size() * sizeof(glm::vec2), &uvs[0], GL_STATIC_DRAW);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 0, (void *) nullptr);
+        // The rings are sized by Update
+        m_verticesRing.Initialize(new cardinal::GLRingBufferStorage(GL_ARRAY_BUFFER), 0);
+        m_normalsRing.Initialize (new cardinal::GLRingBufferStorage(GL_ARRAY_BUFFER), 0);
+        m_uvsRing.Initialize     (new cardinal::GLRingBufferStorage(GL_ARRAY_BUFFER), 0);
 
-    glEnableVertexAttribArray(0);
-    glBindVertexArray(0);
+        glBindVertexArray(m_vao);
+        glEnableVertexAttribArray(0);
+        glBindVertexArray(0);
+    }
 
-    m_elementsCount = static_cast<GLsizei>(vertices.size());
+    Update(vertices, normals, uvs);
 }
 
-/// \brief Updates the mesh
+/// \brief Streams the mesh in the next region of the rings
+///        The regions only grow, the GPU is never waited on otherwise
 /// \param vertices The vertices of the mesh
 /// \param normals The normals of the mesh
 /// \param uvs The uvs of the mesh
@@ -103,27 +85,37 @@ void ProceduralBuildingRenderer::Update(
         return;
     }
 
-    if (m_elementsCount < vertices.size())
-    {
-        // The buffer is too small, we need to
-        // recreates buffers
-        Initialize(vertices, normals, uvs);
-        return;
-    }
+    const size_t verticesSize = vertices.size() * sizeof(glm::vec3);
+    const size_t normalsSize  = normals.size()  * sizeof(glm::vec3);
+    const size_t uvsSize      = uvs.size()      * sizeof(glm::vec2);
+
+    m_verticesRing.Reserve(verticesSize);
+    m_normalsRing.Reserve (normalsSize);
+    m_uvsRing.Reserve     (uvsSize);
+
+    memcpy(m_verticesRing.Map(verticesSize), vertices.data(), verticesSize);
+    m_verticesRing.Unmap();
+
+    memcpy(m_normalsRing.Map(normalsSize), normals.data(), normalsSize);
+    m_normalsRing.Unmap();
+
+    memcpy(m_uvsRing.Map(uvsSize), uvs.data(), uvsSize);
+    m_uvsRing.Unmap();
 
     glBindVertexArray(m_vao);
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_verticesObject);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, vertices.size() * sizeof(glm::vec3), &vertices[0]);
+    glBindBuffer         (GL_ARRAY_BUFFER, m_verticesRing.GetBufferID());
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (void *)m_verticesRing.GetOffset());
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_normalsObject);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, normals.size() * sizeof(glm::vec3), &normals[0]);
+    glBindBuffer         (GL_ARRAY_BUFFER, m_normalsRing.GetBufferID());
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, (void *)m_normalsRing.GetOffset());
 
-    glBindBuffer   (GL_ARRAY_BUFFER, m_uvsObject);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, uvs.size() * sizeof(glm::vec2), &uvs[0]);
+    glBindBuffer         (GL_ARRAY_BUFFER, m_uvsRing.GetBufferID());
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 0, (void *)m_uvsRing.GetOffset());
 
     m_elementsCount = static_cast<GLsizei>(vertices.size());
 
+    glBindBuffer     (GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 }
 
@@ -155,7 +147,7 @@ void ProceduralBuildingRenderer::Draw(glm::mat4 const& P, glm::mat4 const& V, gl
 {
     m_pShader->Begin(P * V * m_model, P, V, m_model, light, pointLights);
 
-    glBindVertexArray(m_vao);
+    cardinal::StateCache::BindVertexArray(m_vao);
     glEnableVertexAttribArray(0);
     glEnableVertexAttribArray(1);
     glEnableVertexAttribArray(2);
@@ -69,6 +69,10 @@ void Demo_Plugin::OnPlayStart()
 
     m_pWorld = m_worldGenerator.generateWorld();
 
+    // Streams the terrain around the character when it leaves the generated chunks
+    m_pChunkRegulator = new ChunkRegulator(m_pWorld);
+    m_pChunkRegulator->SetChunkGenerator(m_worldGenerator.getChunkGenerator());
+
     m_cameraManager.SetCamera(pCamera);
     m_cameraManager.SetCharacter(&m_character);
 
@@ -78,7 +82,9 @@ void Demo_Plugin::OnPlayStart()
 
 void Demo_Plugin::OnPlayStop()
 {
-
+    // Joins the streaming workers
+    delete m_pChunkRegulator;
+    m_pChunkRegulator = nullptr;
 }
 
 void Demo_Plugin::OnPreUpdate()
@@ -89,6 +95,8 @@ void Demo_Plugin::OnPreUpdate()
 void Demo_Plugin::OnPostUpdate(float dt)
 {
     m_character.Update(cardinal::RenderingEngine::GetWindow(), dt);
+    m_pChunkRegulator->Update(m_character.GetPosition(), dt);
+    m_pWorld->Update(m_character.GetPosition(), dt);
     m_cameraManager.Update(cardinal::RenderingEngine::GetWindow(), dt);
 }
 
@@ -82,6 +82,9 @@ void Main_Plugin::OnPostUpdate(float dt)
     // Character update
     m_character.Update(cardinal::RenderingEngine::GetWindow(), dt);
 
+    // World update
+    m_pWorld->Update(m_character.GetPosition(), dt);
+
     // Camera manager update
     m_cameraManager.Update(cardinal::RenderingEngine::GetWindow(), dt);
 }
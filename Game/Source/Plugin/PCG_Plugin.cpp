@@ -129,6 +129,7 @@ void PCG_Plugin::OnPreUpdate()
 void PCG_Plugin::OnPostUpdate(float dt)
 {
     m_character.Update(cardinal::RenderingEngine::GetWindow(), dt);
+    m_pWorld->Update(m_character.GetPosition(), dt);
     m_cameraManager.Update(cardinal::RenderingEngine::GetWindow(), dt);
 
     cardinal::Camera * pCamera = cardinal::RenderingEngine::GetMainCamera();
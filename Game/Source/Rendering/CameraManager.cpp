@@ -41,7 +41,11 @@ void CameraManager::Update(cardinal::Window * p_Window, float dt)
     deltaCharacter  = m_character->GetPosition() - m_lastCharacterPosition;
 
     glm::vec2 mousePos(mouse.x, mouse.y);
-    glm::vec2 windowSize(1600.0f, 900.0f);
+    int windowWidth  = 0;
+    int windowHeight = 0;
+    p_Window->GetSize(windowWidth, windowHeight);
+
+    glm::vec2 windowSize(windowWidth, windowHeight);
     glm::vec2 windowCenter(windowSize.x / 2, windowSize.y / 2);
 
     // Block mouse
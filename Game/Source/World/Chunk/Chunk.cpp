@@ -32,6 +32,9 @@ Chunk::Chunk() // NOLINT
     m_chunkIndexY = 0;
     m_chunkIndexZ = 0;
 
+    // Chunks start as uniform compressed cubes
+    m_cubes = nullptr;
+
     for(uint i = 0; i < 6; ++i) // NOLINT
         m_neighbors[i] = nullptr;
 
@@ -41,7 +44,7 @@ Chunk::Chunk() // NOLINT
 /// \brief Destructor
 Chunk::~Chunk() // NOLINT
 {
-    // TODO
+    delete[] m_cubes;
 }
 
 /// \brief Initializes the chunk at the given world
@@ -74,9 +77,97 @@ void Chunk::SetNeighbors(Chunk * neighbors[6])
 }
 
 // TODO
-void Chunk::Batch()
+void Chunk::Batch(WorldBuffers & buffers)
+{
+    // Compressed chunks are batched from a dense copy
+    ByteCube (* pCubes)[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize] = m_cubes;
+    if(pCubes == nullptr)
+    {
+        m_storage.Extract(&buffers.m_chunkCubesBuffer[0][0][0]);
+        pCubes = buffers.m_chunkCubesBuffer;
+    }
+
+    // The terrain renderer outputs the triangles of the collider
+    buffers.m_chunkPhysicalVertexBuffer.clear();
+
+    m_grassRenderer.Batch(pCubes, m_neighbors, buffers);
+    m_terrainRenderer.Batch(pCubes, m_neighbors, buffers);
+    m_eighthBlockRenderer.Batch(pCubes, m_neighbors, buffers);
+
+    m_collider.Build(buffers.m_chunkPhysicalVertexBuffer);
+    buffers.m_chunkPhysicalVertexBuffer.clear();
+}
+
+void Chunk::Upload()
+{
+    m_grassRenderer.Upload();
+    m_terrainRenderer.Upload();
+    m_eighthBlockRenderer.Upload();
+    m_collider.Upload();
+}
+
+void Chunk::Clear()
+{
+    m_grassRenderer.Clear();
+    m_terrainRenderer.Clear();
+    m_eighthBlockRenderer.Clear();
+    m_collider.Clear();
+}
+
+/// \brief Fills the whole chunk with the given cube, releases the dense cubes
+/// \param cube The cube
+void Chunk::Fill(ByteCube const& cube)
 {
-    m_grassRenderer.Batch(m_cubes, m_neighbors);
-    m_terrainRenderer.Batch(m_cubes, m_neighbors);
-    m_eighthBlockRenderer.Batch(m_cubes, m_neighbors);
+    delete[] m_cubes;
+    m_cubes = nullptr;
+
+    m_storage.Fill(cube);
+}
+
+/// \brief Copies the cubes into the palette storage, releases the dense cubes
+/// \param pCubes The s_chunkBlockCount cubes, indexed like the dense cubes
+void Chunk::Assign(ByteCube const* pCubes)
+{
+    delete[] m_cubes;
+    m_cubes = nullptr;
+
+    m_storage.Assign(pCubes);
+}
+
+/// \brief Moves the cubes into the palette storage and releases the dense cubes
+void Chunk::Compress()
+{
+    if(m_cubes == nullptr)
+    {
+        return;
+    }
+
+    m_storage.Assign(&m_cubes[0][0][0]);
+
+    delete[] m_cubes;
+    m_cubes = nullptr;
+}
+
+/// \brief Moves the cubes back into a dense array
+void Chunk::Decompress()
+{
+    if(m_cubes != nullptr)
+    {
+        return;
+    }
+
+    m_cubes = new ByteCube[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+    m_storage.Extract(&m_cubes[0][0][0]);
+    m_storage.Fill(ByteCube());
+}
+
+/// \brief Returns the number of bytes used to store the cubes
+size_t Chunk::GetStorageFootprint() const
+{
+    if(m_cubes != nullptr)
+    {
+        return m_storage.GetMemoryFootprint() + WorldSettings::s_chunkBlockCount * sizeof(ByteCube);
+    }
+
+    return m_storage.GetMemoryFootprint();
 }
@@ -0,0 +1,138 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       ChunkCollider.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk
+/// \author     Vincent STEHLY--CALISTO
+
+#include "Runtime/Physics/PhysicsEngine.hpp"
+#include "World/Chunk/ChunkCollider.hpp"
+
+/// \brief Constructor
+ChunkCollider::ChunkCollider()
+: m_bPending(false)
+, m_bEnabled(true)
+, m_bInWorld(false)
+, m_pPendingShape(nullptr)
+, m_pShape(nullptr)
+, m_pBody(nullptr)
+{
+    // None
+}
+
+/// \brief Destructor, releases the body and the shapes
+ChunkCollider::~ChunkCollider()
+{
+    Clear();
+}
+
+/// \brief Builds the shape of the given triangles, can be called from any thread
+void ChunkCollider::Build(std::vector<glm::vec3> const& vertices)
+{
+    delete m_pPendingShape;
+    m_pPendingShape = nullptr;
+
+    // The bounding volume hierarchy is built here, out of the main thread
+    if(!vertices.empty())
+    {
+        m_pPendingShape = new cardinal::VertexShape(0);
+        m_pPendingShape->SetTriangles(vertices);
+    }
+
+    m_bPending = true;
+}
+
+/// \brief Replaces the rigid body by one using the last built shape
+void ChunkCollider::Upload()
+{
+    if(!m_bPending)
+    {
+        return;
+    }
+
+    ReleaseBody();
+
+    m_pShape        = m_pPendingShape;
+    m_pPendingShape = nullptr;
+    m_bPending      = false;
+
+    if(m_pShape == nullptr)
+    {
+        return;
+    }
+
+    m_pBody = cardinal::PhysicsEngine::AllocateRigidbody();
+    m_pBody->SetShape(m_pShape);
+    m_pBody->BuildPhysics(false);
+    m_pBody->SetRestitution(0);
+
+    if(m_bEnabled)
+    {
+        cardinal::PhysicsEngine::AddRigidbody(m_pBody);
+        m_bInWorld = true;
+    }
+}
+
+/// \brief Adds or removes the body from the physics world
+void ChunkCollider::SetEnabled(bool bEnabled)
+{
+    m_bEnabled = bEnabled;
+    if(m_pBody == nullptr || m_bInWorld == bEnabled)
+    {
+        return;
+    }
+
+    if(bEnabled)
+    {
+        cardinal::PhysicsEngine::AddRigidbody(m_pBody);
+    }
+    else
+    {
+        cardinal::PhysicsEngine::ReleaseRigidbody(m_pBody);
+    }
+
+    m_bInWorld = bEnabled;
+}
+
+/// \brief Releases the body and drops the pending shape
+void ChunkCollider::Clear()
+{
+    ReleaseBody();
+
+    delete m_pPendingShape;
+    m_pPendingShape = nullptr;
+    m_bPending      = false;
+}
+
+/// \brief Removes the body from the physics world and deletes it
+void ChunkCollider::ReleaseBody()
+{
+    if(m_bInWorld)
+    {
+        cardinal::PhysicsEngine::ReleaseRigidbody(m_pBody);
+        m_bInWorld = false;
+    }
+
+    // The rigid body does not own its shape
+    delete m_pBody;
+    delete m_pShape;
+
+    m_pBody  = nullptr;
+    m_pShape = nullptr;
+}
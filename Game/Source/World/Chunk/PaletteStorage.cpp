@@ -0,0 +1,150 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       PaletteStorage.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk
+/// \author     Vincent STEHLY--CALISTO
+
+#include <algorithm>
+#include "World/Chunk/PaletteStorage.hpp"
+
+/// \brief Constructor, the storage is filled with default cubes
+PaletteStorage::PaletteStorage()
+{
+    Fill(ByteCube());
+}
+
+/// \brief Fills the whole storage with the given cube
+/// \param cube The cube
+void PaletteStorage::Fill(ByteCube const& cube)
+{
+    m_bitsPerIndex = 0;
+    std::vector<ByteCube>(1, cube).swap(m_palette);
+    std::vector<uint64_t>().swap(m_indexes);
+}
+
+/// \brief Compresses the given dense cubes
+/// \param pCubes The s_chunkBlockCount cubes of the chunk
+void PaletteStorage::Assign(ByteCube const* pCubes)
+{
+    Fill(pCubes[0]);
+
+    // Runs of identical cubes are frequent, the palette is only searched on changes
+    uint paletteIndex = 0;
+    for(uint nCube = 1; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+    {
+        if(pCubes[nCube] != m_palette[paletteIndex])
+        {
+            paletteIndex = GetPaletteIndex(pCubes[nCube]);
+        }
+
+        if(m_bitsPerIndex != 0)
+        {
+            SetIndex(nCube, paletteIndex);
+        }
+    }
+}
+
+/// \brief Decompresses the cubes
+/// \param pCubes The s_chunkBlockCount cubes to fill
+void PaletteStorage::Extract(ByteCube * pCubes) const
+{
+    if(m_bitsPerIndex == 0)
+    {
+        std::fill(pCubes, pCubes + WorldSettings::s_chunkBlockCount, m_palette[0]);
+        return;
+    }
+
+    for(uint nCube = 0; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+    {
+        pCubes[nCube] = m_palette[GetIndex(nCube)];
+    }
+}
+
+/// \brief Sets the cube at the given index
+/// \param index The index of the cube
+/// \param cube The new cube
+void PaletteStorage::Set(uint index, ByteCube const& cube)
+{
+    if(m_bitsPerIndex == 0 && cube == m_palette[0])
+    {
+        return;
+    }
+
+    uint paletteIndex = GetPaletteIndex(cube);
+    SetIndex(index, paletteIndex);
+}
+
+/// \brief  Returns the number of bytes used by the storage
+/// \return The memory footprint in bytes
+size_t PaletteStorage::GetMemoryFootprint() const
+{
+    return sizeof(PaletteStorage)
+         + m_palette.capacity() * sizeof(ByteCube)
+         + m_indexes.capacity() * sizeof(uint64_t);
+}
+
+/// \brief  Returns the palette index of the cube, adds it if needed
+/// \return The palette index
+uint PaletteStorage::GetPaletteIndex(ByteCube const& cube)
+{
+    for(uint nEntry = 0; nEntry < m_palette.size(); ++nEntry)
+    {
+        if(m_palette[nEntry] == cube)
+        {
+            return nEntry;
+        }
+    }
+
+    m_palette.push_back(cube);
+
+    // Growing the indexes to address the new entry
+    uint bitsPerIndex = m_bitsPerIndex == 0 ? 1 : m_bitsPerIndex;
+    while(m_palette.size() > (1u << bitsPerIndex))
+    {
+        bitsPerIndex *= 2;
+    }
+
+    if(bitsPerIndex != m_bitsPerIndex)
+    {
+        Repack(bitsPerIndex);
+    }
+
+    return static_cast<uint>(m_palette.size() - 1);
+}
+
+/// \brief Repacks the indexes with the given number of bits
+void PaletteStorage::Repack(uint bitsPerIndex)
+{
+    std::vector<uint64_t> indexes(WorldSettings::s_chunkBlockCount * bitsPerIndex / 64, 0);
+
+    // A uniform storage references the first entry everywhere
+    if(m_bitsPerIndex != 0)
+    {
+        for(uint nCube = 0; nCube < WorldSettings::s_chunkBlockCount; ++nCube)
+        {
+            uint     paletteIndex = GetIndex(nCube);
+            uint     bit          = nCube * bitsPerIndex;
+            indexes[bit >> 6]    |= uint64_t(paletteIndex) << (bit & 63);
+        }
+    }
+
+    m_indexes.swap(indexes);
+    m_bitsPerIndex = bitsPerIndex;
+}
@@ -0,0 +1,63 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       BatchedMesh.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk/Renderer
+/// \author     Vincent STEHLY--CALISTO
+
+#include "World/Chunk/Renderer/BatchedMesh.hpp"
+
+/// \brief Copies the indexed geometry, can be called from any thread
+void BatchedMesh::Store(std::vector<uint>      const& indexes,
+                        std::vector<glm::vec3> const& vertices,
+                        std::vector<glm::vec3> const& normals,
+                        std::vector<glm::vec2> const& uvs)
+{
+    m_indexes.assign (indexes.begin(),  indexes.end());
+    m_vertices.assign(vertices.begin(), vertices.end());
+    m_normals.assign (normals.begin(),  normals.end());
+    m_uvs.assign     (uvs.begin(),      uvs.end());
+
+    m_isPending = true;
+}
+
+/// \brief Uploads the pending geometry and releases it
+void BatchedMesh::Upload(cardinal::MeshRenderer * pRenderer)
+{
+    if(!m_isPending)
+    {
+        return;
+    }
+
+    pRenderer->Initialize(m_indexes, m_vertices, m_normals, m_uvs);
+
+    // The geometry now lives on the GPU
+    Clear();
+}
+
+/// \brief Drops the pending geometry without uploading it
+void BatchedMesh::Clear()
+{
+    std::vector<uint>     ().swap(m_indexes);
+    std::vector<glm::vec3>().swap(m_vertices);
+    std::vector<glm::vec3>().swap(m_normals);
+    std::vector<glm::vec2>().swap(m_uvs);
+
+    m_isPending = false;
+}
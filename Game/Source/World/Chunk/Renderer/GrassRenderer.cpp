@@ -44,11 +44,11 @@ GrassRenderer::GrassRenderer()
 
 /// \brief Static batching for terrain cubes
 /// \param pCubes The cubes of the chunk
-void GrassRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6])
+void GrassRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], class Chunk * neighbors[6], WorldBuffers & buffers)
 {
-    WorldBuffers::s_chunkVertexBuffer.resize(WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_chunkUVsBuffer.resize   (WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_grassBuffer.resize      (WorldSettings::s_chunkBlockCount * 2);
+    buffers.m_chunkVertexBuffer.resize(WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkUVsBuffer.resize   (WorldSettings::s_chunkVertexCount);
+    buffers.m_grassBuffer.resize      (WorldSettings::s_chunkBlockCount * 2);
 
     size_t triangleIndex = 0;
     float half           = ByteCube::s_cubeSize / 2.0f;
@@ -80,42 +80,42 @@ void GrassRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSetti
                     float UVx =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 0] * WorldSettings::s_textureStep;
                     float UVy =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 1] * WorldSettings::s_textureStep;
 
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[0].x     = UVx;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[0].y     = UVy;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].x = Grass::s_vertices[faceIndex +  0] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].y = Grass::s_vertices[faceIndex +  1] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].z = Grass::s_vertices[faceIndex +  2] * half + offset.z;
+                    buffers.m_grassBuffer[triangleIndex].uv[0].x     = UVx;
+                    buffers.m_grassBuffer[triangleIndex].uv[0].y     = UVy;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].x = Grass::s_vertices[faceIndex +  0] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].y = Grass::s_vertices[faceIndex +  1] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].z = Grass::s_vertices[faceIndex +  2] * half + offset.z;
 
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[1].x     = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[1].y     = UVy;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].x = Grass::s_vertices[faceIndex +  3] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].y = Grass::s_vertices[faceIndex +  4] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].z = Grass::s_vertices[faceIndex +  5] * half + offset.z;
+                    buffers.m_grassBuffer[triangleIndex].uv[1].x     = UVx + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].uv[1].y     = UVy;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].x = Grass::s_vertices[faceIndex +  3] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].y = Grass::s_vertices[faceIndex +  4] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].z = Grass::s_vertices[faceIndex +  5] * half + offset.z;
 
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[2].x     = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[2].y     = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].x = Grass::s_vertices[faceIndex +  6] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].y = Grass::s_vertices[faceIndex +  7] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].z = Grass::s_vertices[faceIndex +  8] * half + offset.z;
+                    buffers.m_grassBuffer[triangleIndex].uv[2].x     = UVx + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].uv[2].y     = UVy + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].x = Grass::s_vertices[faceIndex +  6] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].y = Grass::s_vertices[faceIndex +  7] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].z = Grass::s_vertices[faceIndex +  8] * half + offset.z;
 
                     triangleIndex++;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[0].x     = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[0].y     = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].x = Grass::s_vertices[faceIndex +  9] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].y = Grass::s_vertices[faceIndex + 10] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[0].z = Grass::s_vertices[faceIndex + 11] * half + offset.z;
-
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[1].x     = UVx;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[1].y     = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].x = Grass::s_vertices[faceIndex + 12] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].y = Grass::s_vertices[faceIndex + 13] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[1].z = Grass::s_vertices[faceIndex + 14] * half + offset.z;
-
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[2].x     = UVx;
-                    WorldBuffers::s_grassBuffer[triangleIndex].uv[2].y     = UVy;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].x = Grass::s_vertices[faceIndex + 15] * half + offset.x;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].y = Grass::s_vertices[faceIndex + 16] * half + offset.y;
-                    WorldBuffers::s_grassBuffer[triangleIndex].vertex[2].z = Grass::s_vertices[faceIndex + 17] * half + offset.z;
+                    buffers.m_grassBuffer[triangleIndex].uv[0].x     = UVx + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].uv[0].y     = UVy + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].x = Grass::s_vertices[faceIndex +  9] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].y = Grass::s_vertices[faceIndex + 10] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[0].z = Grass::s_vertices[faceIndex + 11] * half + offset.z;
+
+                    buffers.m_grassBuffer[triangleIndex].uv[1].x     = UVx;
+                    buffers.m_grassBuffer[triangleIndex].uv[1].y     = UVy + WorldSettings::s_textureStep;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].x = Grass::s_vertices[faceIndex + 12] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].y = Grass::s_vertices[faceIndex + 13] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[1].z = Grass::s_vertices[faceIndex + 14] * half + offset.z;
+
+                    buffers.m_grassBuffer[triangleIndex].uv[2].x     = UVx;
+                    buffers.m_grassBuffer[triangleIndex].uv[2].y     = UVy;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].x = Grass::s_vertices[faceIndex + 15] * half + offset.x;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].y = Grass::s_vertices[faceIndex + 16] * half + offset.y;
+                    buffers.m_grassBuffer[triangleIndex].vertex[2].z = Grass::s_vertices[faceIndex + 17] * half + offset.z;
 
                     triangleIndex++;
                 }
@@ -128,45 +128,58 @@ void GrassRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSetti
         return;
 
     // Resize triangles
-    WorldBuffers::s_grassBuffer.resize(triangleIndex);
+    buffers.m_grassBuffer.resize(triangleIndex);
 
     size_t vertexIndex   = 0;
     for(size_t nTriangle = 0; nTriangle < triangleIndex; ++nTriangle)
     {
-        WorldBuffers::s_chunkUVsBuffer[vertexIndex + 0]    = WorldBuffers::s_grassBuffer[nTriangle].uv[0];
-        WorldBuffers::s_chunkUVsBuffer[vertexIndex + 1]    = WorldBuffers::s_grassBuffer[nTriangle].uv[1];
-        WorldBuffers::s_chunkUVsBuffer[vertexIndex + 2]    = WorldBuffers::s_grassBuffer[nTriangle].uv[2];
-        WorldBuffers::s_chunkVertexBuffer[vertexIndex + 0] = WorldBuffers::s_grassBuffer[nTriangle].vertex[0];
-        WorldBuffers::s_chunkVertexBuffer[vertexIndex + 1] = WorldBuffers::s_grassBuffer[nTriangle].vertex[1];
-        WorldBuffers::s_chunkVertexBuffer[vertexIndex + 2] = WorldBuffers::s_grassBuffer[nTriangle].vertex[2];
+        buffers.m_chunkUVsBuffer[vertexIndex + 0]    = buffers.m_grassBuffer[nTriangle].uv[0];
+        buffers.m_chunkUVsBuffer[vertexIndex + 1]    = buffers.m_grassBuffer[nTriangle].uv[1];
+        buffers.m_chunkUVsBuffer[vertexIndex + 2]    = buffers.m_grassBuffer[nTriangle].uv[2];
+        buffers.m_chunkVertexBuffer[vertexIndex + 0] = buffers.m_grassBuffer[nTriangle].vertex[0];
+        buffers.m_chunkVertexBuffer[vertexIndex + 1] = buffers.m_grassBuffer[nTriangle].vertex[1];
+        buffers.m_chunkVertexBuffer[vertexIndex + 2] = buffers.m_grassBuffer[nTriangle].vertex[2];
         vertexIndex += 3;
     }
 
-    WorldBuffers::s_chunkVertexBuffer.resize(vertexIndex);
-    WorldBuffers::s_chunkUVsBuffer.resize   (vertexIndex);
+    buffers.m_chunkVertexBuffer.resize(vertexIndex);
+    buffers.m_chunkUVsBuffer.resize   (vertexIndex);
 
     // Indexing
     cardinal::VBOIndexer::Index(
-            WorldBuffers::s_chunkVertexBuffer,
-            WorldBuffers::s_chunkUVsBuffer,
-            WorldBuffers::s_chunkIndexesBuffer,
-            WorldBuffers::s_chunkIndexedVertexBuffer,
-            WorldBuffers::s_chunkIndexedUVsBuffer);
-
-    m_renderer->Initialize(
-            WorldBuffers::s_chunkIndexesBuffer,
-            WorldBuffers::s_chunkIndexedVertexBuffer,
-            WorldBuffers::s_chunkIndexedVertexBuffer,
-            WorldBuffers::s_chunkIndexedUVsBuffer);
-
-    WorldBuffers::s_chunkUVsBuffer.clear();
-    WorldBuffers::s_chunkVertexBuffer.clear();
-
-    WorldBuffers::s_chunkUVsBuffer.clear();
-    WorldBuffers::s_chunkVertexBuffer.clear();
-    WorldBuffers::s_chunkIndexesBuffer.clear();
-    WorldBuffers::s_chunkIndexedUVsBuffer.clear();
-    WorldBuffers::s_chunkIndexedVertexBuffer.clear();
+            buffers.m_chunkVertexBuffer,
+            buffers.m_chunkUVsBuffer,
+            buffers.m_chunkIndexesBuffer,
+            buffers.m_chunkIndexedVertexBuffer,
+            buffers.m_chunkIndexedUVsBuffer);
+
+    m_mesh.Store(
+            buffers.m_chunkIndexesBuffer,
+            buffers.m_chunkIndexedVertexBuffer,
+            buffers.m_chunkIndexedVertexBuffer,
+            buffers.m_chunkIndexedUVsBuffer);
+
+    buffers.m_chunkUVsBuffer.clear();
+    buffers.m_chunkVertexBuffer.clear();
+
+    buffers.m_chunkUVsBuffer.clear();
+    buffers.m_chunkVertexBuffer.clear();
+    buffers.m_chunkIndexesBuffer.clear();
+    buffers.m_chunkIndexedUVsBuffer.clear();
+    buffers.m_chunkIndexedVertexBuffer.clear();
+}
+
+/// \brief Uploads the last batch to the GPU
+void GrassRenderer::Upload()
+{
+    m_mesh.Upload(m_renderer);
+}
+
+/// \brief Releases the geometry of the renderer
+void GrassRenderer::Clear()
+{
+    m_mesh.Clear();
+    m_renderer->Clear();
 }
 
 /// \brief Translate the chunk terrain renderer
@@ -0,0 +1,328 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainMesher.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Chunk/Renderer
+/// \author     Vincent STEHLY--CALISTO
+
+#include "World/Cube/UVManager.hpp"
+#include "World/Chunk/Renderer/TerrainMesher.hpp"
+#include "Runtime/Rendering/Optimization/VBOIndexer.hpp"
+
+/// \brief Stride used to pack the atlas tile and the local tiling coordinate
+///        of greedy quads in a single UV (see StandardFragmentShader.glsl)
+static const float s_greedyUVStride = 32.0f;
+
+/// \brief Per face, the axes along which the texture u and v coordinates run
+static const uint s_faceUVAxis[6][2] = { {1, 2}, {0, 2}, {1, 2}, {0, 2}, {0, 1}, {1, 0} };
+
+/// \brief Per face vertex, the texture corner used by the batching
+static const float s_faceUVs[6][2] = { {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}, {0.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 0.0f} };
+
+/// \brief  Tells if the face of the given cube is hidden by a neighbor cube
+/// \return True or false
+static bool IsFaceHidden(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], TerrainMesher::Borders const& borders, uint x, uint y, uint z, uint nFace)
+{
+    unsigned size = WorldSettings::s_chunkSize;
+
+    // Visibility determination for faces
+    if((nFace == 0 && x != 0        && pCubes[x - 1][y][z].IsSolid() && !pCubes[x - 1][y][z].IsTransparent() && !pCubes[x - 1][y][z].IsHeighthBlock()) ||
+       (nFace == 2 && x != size - 1 && pCubes[x + 1][y][z].IsSolid() && !pCubes[x + 1][y][z].IsTransparent() && !pCubes[x + 1][y][z].IsHeighthBlock()) ||
+       (nFace == 3 && y != 0        && pCubes[x][y - 1][z].IsSolid() && !pCubes[x][y - 1][z].IsTransparent() && !pCubes[x][y - 1][z].IsHeighthBlock()) ||
+       (nFace == 1 && y != size - 1 && pCubes[x][y + 1][z].IsSolid() && !pCubes[x][y + 1][z].IsTransparent() && !pCubes[x][y + 1][z].IsHeighthBlock()) ||
+       (nFace == 5 && z != 0        && pCubes[x][y][z - 1].IsSolid() && !pCubes[x][y][z - 1].IsTransparent() && !pCubes[x][y][z - 1].IsHeighthBlock()) ||
+       (nFace == 4 && z != size - 1 && pCubes[x][y][z + 1].IsSolid() && !pCubes[x][y][z + 1].IsTransparent() && !pCubes[x][y][z + 1].IsHeighthBlock()))
+    {
+        return true;
+    }
+
+    // Visibility inter-chunk
+    return (nFace == 0 && (x ==        0) && borders.m_bNeighbor[0] && borders.m_cubes[0][y][z].IsSolid() && !pCubes[size - 1][y][z].IsHeighthBlock()) ||
+           (nFace == 2 && (x == size - 1) && borders.m_bNeighbor[1] && borders.m_cubes[1][y][z].IsSolid() && !pCubes[       0][y][z].IsHeighthBlock()) ||
+           (nFace == 3 && (y ==        0) && borders.m_bNeighbor[2] && borders.m_cubes[2][x][z].IsSolid() && !pCubes[x][size - 1][z].IsHeighthBlock()) ||
+           (nFace == 1 && (y == size - 1) && borders.m_bNeighbor[3] && borders.m_cubes[3][x][z].IsSolid() && !pCubes[x][       0][z].IsHeighthBlock()) ||
+           (nFace == 5 && (z ==        0) && borders.m_bNeighbor[4] && borders.m_cubes[4][x][y].IsSolid() && !pCubes[x][y][size - 1].IsHeighthBlock()) ||
+           (nFace == 4 && (z == size - 1) && borders.m_bNeighbor[5] && borders.m_cubes[5][x][y].IsSolid() && !pCubes[x][y][       0].IsHeighthBlock());
+}
+
+/// \brief  Tells if the cube is batched by the terrain renderer
+/// \return True or false
+static bool IsTerrainCube(ByteCube const& cube)
+{
+    return cube.IsVisible() && cube.IsSolid() && !cube.IsTransparent() && !cube.IsHeighthBlock();
+}
+
+/// \brief  Emits the terrain geometry of a chunk and indexes it
+/// \return The number of emitted vertices, 3 per triangle
+/* static */ size_t TerrainMesher::Build(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, bool bGreedy, WorldBuffers & buffers)
+{
+    // Resizing the vector to ensure that the current size
+    // is large enough to hold all vertices and UVs
+    buffers.m_chunkVertexBuffer.resize   (WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkNormalBuffer.resize   (WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkUVsBuffer.resize      (WorldSettings::s_chunkVertexCount);
+
+    size_t vertexIndex = bGreedy ?
+                         BatchGreedy(pCubes, borders, buffers) :
+                         BatchFaces (pCubes, borders, buffers);
+
+    buffers.m_chunkVertexBuffer.resize(vertexIndex);
+    buffers.m_chunkNormalBuffer.resize(vertexIndex);
+    buffers.m_chunkUVsBuffer.resize   (vertexIndex);
+
+    cardinal::VBOIndexer::Index(
+            buffers.m_chunkVertexBuffer,
+            buffers.m_chunkNormalBuffer,
+            buffers.m_chunkUVsBuffer,
+            buffers.m_chunkIndexesBuffer,
+            buffers.m_chunkIndexedVertexBuffer,
+            buffers.m_chunkIndexedNormalBuffer,
+            buffers.m_chunkIndexedUVsBuffer);
+
+    return vertexIndex;
+}
+
+/// \brief  Emits 6 vertices per visible face
+/// \return The number of emitted vertices
+/* static */ size_t TerrainMesher::BatchFaces(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, WorldBuffers & buffers)
+{
+    size_t vertexIndex = 0;
+    float half         = ByteCube::s_cubeSize / 2.0f;
+
+    for(uint x = 0; x < WorldSettings::s_chunkSize; ++x) // NOLINT
+    {
+        for(uint y = 0; y < WorldSettings::s_chunkSize; ++y)
+        {
+            for(uint z = 0; z < WorldSettings::s_chunkSize; ++z)
+            {
+                // Pre-conditions
+                ByteCube const& cube = pCubes[x][y][z];
+                if(!IsTerrainCube(cube))
+                {
+                    continue;
+                }
+
+                // Face by face batching
+                for(unsigned nFace = 0; nFace < 6; ++nFace)
+                {
+                    if(IsFaceHidden(pCubes, borders, x, y, z, nFace))
+                    {
+                        continue;
+                    }
+
+                    // Offset of the current cube
+                    glm::vec3 offset(
+                            x * ByteCube::s_cubeSize,
+                            y * ByteCube::s_cubeSize,
+                            z * ByteCube::s_cubeSize);
+
+                    size_t faceIndex = nFace * 18;
+
+                    float UVx =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 0] * WorldSettings::s_textureStep;
+                    float UVy =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 1] * WorldSettings::s_textureStep;
+
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 0];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 1];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 2];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  0] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  1] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  2] * half + offset.z;
+
+                    vertexIndex += 1;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 3];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 4];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 5];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  3] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  4] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  5] * half + offset.z;
+                    vertexIndex += 1;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy+ WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 6];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 7];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 8];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  6] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  7] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  8] * half + offset.z;
+
+                    vertexIndex += 1;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex +  9];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 10];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 11];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  9] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 10] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 11] * half + offset.z;
+
+                    vertexIndex += 1;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 12];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 13];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 14];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 12] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 13] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 14] * half + offset.z;
+
+                    vertexIndex += 1;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 15];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 16];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 17];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 15] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 16] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 17] * half + offset.z;
+                    vertexIndex += 1;
+                }
+            }
+        }
+    }
+
+    return vertexIndex;
+}
+
+/// \brief  Merges coplanar visible faces of the same type into rectangles
+///         The UVs of a quad store the atlas tile and the number of times
+///         the tile is repeated, the shader wraps them back in the atlas
+/// \return The number of emitted vertices
+/* static */ size_t TerrainMesher::BatchGreedy(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Borders const& borders, WorldBuffers & buffers)
+{
+    const uint size    = WorldSettings::s_chunkSize;
+    size_t vertexIndex = 0;
+    float half         = ByteCube::s_cubeSize / 2.0f;
+
+    // Type of the visible face of each cell of the current slice, air if none
+    ByteCube::EType mask[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize];
+
+    for(uint nFace = 0; nFace < 6; ++nFace)
+    {
+        // Axis of the face normal and axes of the face plane
+        uint d  = (nFace == 0 || nFace == 2) ? 0u : ((nFace == 1 || nFace == 3) ? 1u : 2u);
+        uint a1 = (d + 1) % 3;
+        uint a2 = (d + 2) % 3;
+
+        size_t faceIndex = nFace * 18;
+
+        for(uint slice = 0; slice < size; ++slice)
+        {
+            // Builds the mask of the slice
+            uint c[3];
+            c[d] = slice;
+            for(uint i = 0; i < size; ++i)
+            {
+                for(uint j = 0; j < size; ++j)
+                {
+                    c[a1] = i;
+                    c[a2] = j;
+
+                    ByteCube const& cube = pCubes[c[0]][c[1]][c[2]];
+                    mask[i][j] = (IsTerrainCube(cube) && !IsFaceHidden(pCubes, borders, c[0], c[1], c[2], nFace)) ?
+                                 cube.GetType() : ByteCube::EType::Air;
+                }
+            }
+
+            // Extracts maximal rectangles from the mask
+            for(uint j = 0; j < size; ++j)
+            {
+                for(uint i = 0; i < size; )
+                {
+                    ByteCube::EType type = mask[i][j];
+                    if(type == ByteCube::EType::Air)
+                    {
+                        ++i;
+                        continue;
+                    }
+
+                    uint w = 1;
+                    while(i + w < size && mask[i + w][j] == type)
+                    {
+                        ++w;
+                    }
+
+                    uint h = 1;
+                    while(j + h < size)
+                    {
+                        uint k = 0;
+                        while(k < w && mask[i + k][j + h] == type)
+                        {
+                            ++k;
+                        }
+
+                        if(k < w)
+                        {
+                            break;
+                        }
+
+                        ++h;
+                    }
+
+                    for(uint dj = 0; dj < h; ++dj)
+                    {
+                        for(uint di = 0; di < w; ++di)
+                        {
+                            mask[i + di][j + dj] = ByteCube::EType::Air;
+                        }
+                    }
+
+                    // Bounds of the quad, in cubes
+                    uint  minCube[3];
+                    uint  maxCube[3];
+                    float extent [3];
+
+                    minCube[d]  = slice;     maxCube[d]  = slice;         extent[d]  = 1.0f;
+                    minCube[a1] = i;         maxCube[a1] = i + w - 1;     extent[a1] = static_cast<float>(w);
+                    minCube[a2] = j;         maxCube[a2] = j + h - 1;     extent[a2] = static_cast<float>(h);
+
+                    float tileX = UVManager::UV[type >> 1][nFace * 2 + 0] * s_greedyUVStride;
+                    float tileY = UVManager::UV[type >> 1][nFace * 2 + 1] * s_greedyUVStride;
+
+                    for(uint nVertex = 0; nVertex < 6; ++nVertex)
+                    {
+                        size_t vertex = faceIndex + nVertex * 3;
+                        for(uint axis = 0; axis < 3; ++axis)
+                        {
+                            float corner = ByteCube::s_vertices[vertex + axis];
+                            float value  = (axis == d) ?
+                                           corner * half + minCube[axis] * ByteCube::s_cubeSize :
+                                           (corner < 0.0f ? minCube[axis] * ByteCube::s_cubeSize - half :
+                                                            maxCube[axis] * ByteCube::s_cubeSize + half);
+
+                            buffers.m_chunkVertexBuffer[vertexIndex][axis] = value;
+                            buffers.m_chunkNormalBuffer[vertexIndex][axis] = ByteCube::s_normals[vertex + axis];
+                        }
+
+                        buffers.m_chunkUVsBuffer[vertexIndex].x = tileX + s_faceUVs[nVertex][0] * extent[s_faceUVAxis[nFace][0]];
+                        buffers.m_chunkUVsBuffer[vertexIndex].y = tileY + s_faceUVs[nVertex][1] * extent[s_faceUVAxis[nFace][1]];
+                        vertexIndex += 1;
+                    }
+
+                    i += w;
+                }
+            }
+        }
+    }
+
+    return vertexIndex;
+}
@@ -28,8 +28,7 @@
 #include <Header/Runtime/Rendering/Shader/Built-in/Lit/LitTextureShader.hpp>
 #include <Header/Runtime/Rendering/Debug/Debug.hpp>
 #include <Header/Runtime/Rendering/Shader/Built-in/Standard/StandardShader.hpp>
-#include "World/Cube/UVManager.hpp"
-#include "Runtime/Rendering/Optimization/VBOIndexer.hpp"
+#include "World/Chunk/Renderer/TerrainMesher.hpp"
 
 #include <algorithm>
 
@@ -39,168 +38,83 @@ TerrainRenderer::TerrainRenderer()
     m_renderer = cardinal::RenderingEngine::AllocateMeshRenderer();
     cardinal::StandardShader * pShader = new cardinal::StandardShader(); // NOLINT
     pShader->SetTexture(cardinal::TextureManager::GetTextureID("Block"));
+
+    if(WorldSettings::s_greedyMeshing)
+    {
+        pShader->SetAtlasTiling(WorldSettings::s_textureStep);
+    }
+
     m_renderer->SetShader(pShader);
 }
 
-/// \brief Static batching for terrain cubes
-/// \param pCubes The cubes of the chunk
-void TerrainRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Chunk * neighbors[6])
+/// \brief Copies the layers of the neighbor chunks touching the chunk
+static void GatherBorders(Chunk * neighbors[6], TerrainMesher::Borders & borders)
 {
-    // Resizing the vector to ensure that the current size
-    // is large enough to hold all vertices and UVs
-    WorldBuffers::s_chunkVertexBuffer.resize   (WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_chunkNormalBuffer.resize   (WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_chunkUVsBuffer.resize      (WorldSettings::s_chunkVertexCount);
+    const uint size = WorldSettings::s_chunkSize;
 
-    size_t vertexIndex = 0;
-    float half         = ByteCube::s_cubeSize / 2.0f;
+    for(uint nSide = 0; nSide < 6; ++nSide)
+    {
+        borders.m_bNeighbor[nSide] = neighbors[nSide] != nullptr;
+    }
 
-    for(uint x = 0; x < WorldSettings::s_chunkSize; ++x) // NOLINT
+    for(uint i = 0; i < size; ++i)
     {
-        for(uint y = 0; y < WorldSettings::s_chunkSize; ++y)
+        for(uint j = 0; j < size; ++j)
         {
-            for(uint z = 0; z < WorldSettings::s_chunkSize; ++z)
-            {
-                // Pre-conditions
-                ByteCube const& cube = pCubes[x][y][z];
-                if(!cube.IsVisible() || !cube.IsSolid() || cube.IsTransparent() || cube.IsHeighthBlock())
-                {
-                    continue;
-                }
-
-                // Face by face batching
-                unsigned size = WorldSettings::s_chunkSize;
-                for(unsigned nFace = 0; nFace < 6; ++nFace)
-                {
-                    // Visibility determination for faces
-                    if((nFace == 0 && x != 0        && pCubes[x - 1][y][z].IsSolid() && !pCubes[x - 1][y][z].IsTransparent() && !pCubes[x - 1][y][z].IsHeighthBlock()) ||
-                       (nFace == 2 && x != size - 1 && pCubes[x + 1][y][z].IsSolid() && !pCubes[x + 1][y][z].IsTransparent() && !pCubes[x + 1][y][z].IsHeighthBlock()) ||
-                       (nFace == 3 && y != 0        && pCubes[x][y - 1][z].IsSolid() && !pCubes[x][y - 1][z].IsTransparent() && !pCubes[x][y - 1][z].IsHeighthBlock()) ||
-                       (nFace == 1 && y != size - 1 && pCubes[x][y + 1][z].IsSolid() && !pCubes[x][y + 1][z].IsTransparent() && !pCubes[x][y + 1][z].IsHeighthBlock()) ||
-                       (nFace == 5 && z != 0        && pCubes[x][y][z - 1].IsSolid() && !pCubes[x][y][z - 1].IsTransparent() && !pCubes[x][y][z - 1].IsHeighthBlock()) ||
-                       (nFace == 4 && z != size - 1 && pCubes[x][y][z + 1].IsSolid() && !pCubes[x][y][z + 1].IsTransparent() && !pCubes[x][y][z + 1].IsHeighthBlock()))
-                    {
-                        continue;
-                    }
-
-                    // Visibility inter-chunk
-                    if((nFace == 0 && (x ==        0) && neighbors[0] != nullptr && neighbors[0]->m_cubes[size - 1][y][z].IsSolid() && !pCubes[size - 1][y][z].IsHeighthBlock()) ||
-                       (nFace == 2 && (x == size - 1) && neighbors[1] != nullptr && neighbors[1]->m_cubes[0       ][y][z].IsSolid() && !pCubes[       0][y][z].IsHeighthBlock()) ||
-                       (nFace == 3 && (y ==        0) && neighbors[2] != nullptr && neighbors[2]->m_cubes[x][size - 1][z].IsSolid() && !pCubes[x][size - 1][z].IsHeighthBlock()) ||
-                       (nFace == 1 && (y == size - 1) && neighbors[3] != nullptr && neighbors[3]->m_cubes[x][0       ][z].IsSolid() && !pCubes[x][       0][z].IsHeighthBlock()) ||
-                       (nFace == 5 && (z ==        0) && neighbors[4] != nullptr && neighbors[4]->m_cubes[x][y][size - 1].IsSolid() && !pCubes[x][y][size - 1].IsHeighthBlock()) ||
-                       (nFace == 4 && (z == size - 1) && neighbors[5] != nullptr && neighbors[5]->m_cubes[x][y][       0].IsSolid() && !pCubes[x][y][       0].IsHeighthBlock()))
-                    {
-                        continue;
-                    }
-
-                    // Offset of the current cube
-                    glm::vec3 offset(
-                            x * ByteCube::s_cubeSize,
-                            y * ByteCube::s_cubeSize,
-                            z * ByteCube::s_cubeSize);
-
-                    size_t faceIndex = nFace * 18;
-
-                    float UVx =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 0] * WorldSettings::s_textureStep;
-                    float UVy =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 1] * WorldSettings::s_textureStep;
-
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 0];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 1];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 2];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  0] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  1] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  2] * half + offset.z;
-
-                    vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 3];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 4];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 5];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  3] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  4] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  5] * half + offset.z;
-                    vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy+ WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 6];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 7];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 8];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  6] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  7] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  8] * half + offset.z;
-
-                    vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex +  9];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 10];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 11];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  9] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 10] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 11] * half + offset.z;
-
-                    vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 12];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 13];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 14];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 12] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 13] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 14] * half + offset.z;
-
-                    vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 15];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 16];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 17];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 15] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 16] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 17] * half + offset.z;
-                    vertexIndex += 1;
-                }
-            }
+            if(neighbors[0] != nullptr) { borders.m_cubes[0][i][j] = neighbors[0]->GetCube(size - 1, i, j); }
+            if(neighbors[1] != nullptr) { borders.m_cubes[1][i][j] = neighbors[1]->GetCube(       0, i, j); }
+            if(neighbors[2] != nullptr) { borders.m_cubes[2][i][j] = neighbors[2]->GetCube(i, size - 1, j); }
+            if(neighbors[3] != nullptr) { borders.m_cubes[3][i][j] = neighbors[3]->GetCube(i,        0, j); }
+            if(neighbors[4] != nullptr) { borders.m_cubes[4][i][j] = neighbors[4]->GetCube(i, j, size - 1); }
+            if(neighbors[5] != nullptr) { borders.m_cubes[5][i][j] = neighbors[5]->GetCube(i, j,        0); }
         }
     }
+}
+
+/// \brief Static batching for terrain cubes
+/// \param pCubes The cubes of the chunk
+void TerrainRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Chunk * neighbors[6], WorldBuffers & buffers)
+{
+    TerrainMesher::Borders borders;
+    GatherBorders(neighbors, borders);
 
-    WorldBuffers::s_chunkVertexBuffer.resize(vertexIndex);
-    WorldBuffers::s_chunkNormalBuffer.resize(vertexIndex);
-    WorldBuffers::s_chunkUVsBuffer.resize   (vertexIndex);
+    size_t vertexIndex = TerrainMesher::Build(pCubes, borders, WorldSettings::s_greedyMeshing, buffers);
+    m_triangleCount    = vertexIndex / 3;
 
     // Copy vertex for later physical updates before optimizing
-    for(size_t i = 0ul ; i < WorldBuffers::s_chunkVertexBuffer.size() ; ++i)
-        WorldBuffers::s_chunkPhysicalVertexBuffer.push_back(WorldBuffers::s_chunkVertexBuffer[i] + m_model);
-
-    cardinal::VBOIndexer::Index(
-            WorldBuffers::s_chunkVertexBuffer,
-            WorldBuffers::s_chunkNormalBuffer,
-            WorldBuffers::s_chunkUVsBuffer,
-            WorldBuffers::s_chunkIndexesBuffer,
-            WorldBuffers::s_chunkIndexedVertexBuffer,
-            WorldBuffers::s_chunkIndexedNormalBuffer,
-            WorldBuffers::s_chunkIndexedUVsBuffer);
-
-   if (WorldBuffers::s_chunkIndexesBuffer.size() != 0) // NOLINT
+    for(size_t i = 0ul ; i < buffers.m_chunkVertexBuffer.size() ; ++i)
+        buffers.m_chunkPhysicalVertexBuffer.push_back(buffers.m_chunkVertexBuffer[i] + m_model);
+
+   if (buffers.m_chunkIndexesBuffer.size() != 0) // NOLINT
    {
-        m_renderer->Initialize(
-                WorldBuffers::s_chunkIndexesBuffer,
-                WorldBuffers::s_chunkIndexedVertexBuffer,
-                WorldBuffers::s_chunkIndexedNormalBuffer,
-                WorldBuffers::s_chunkIndexedUVsBuffer);
+        m_mesh.Store(
+                buffers.m_chunkIndexesBuffer,
+                buffers.m_chunkIndexedVertexBuffer,
+                buffers.m_chunkIndexedNormalBuffer,
+                buffers.m_chunkIndexedUVsBuffer);
     }
 
-    WorldBuffers::s_chunkUVsBuffer.clear();
-    WorldBuffers::s_chunkNormalBuffer.clear();
-    WorldBuffers::s_chunkVertexBuffer.clear();
-    WorldBuffers::s_chunkIndexesBuffer.clear();
-    WorldBuffers::s_chunkIndexedUVsBuffer.clear();
-    WorldBuffers::s_chunkIndexedVertexBuffer.clear();
-    WorldBuffers::s_chunkIndexedNormalBuffer.clear();
+    buffers.m_chunkUVsBuffer.clear();
+    buffers.m_chunkNormalBuffer.clear();
+    buffers.m_chunkVertexBuffer.clear();
+    buffers.m_chunkIndexesBuffer.clear();
+    buffers.m_chunkIndexedUVsBuffer.clear();
+    buffers.m_chunkIndexedVertexBuffer.clear();
+    buffers.m_chunkIndexedNormalBuffer.clear();
+}
+
+/// \brief Uploads the last batch to the GPU
+void TerrainRenderer::Upload()
+{
+    m_mesh.Upload(m_renderer);
+}
+
+/// \brief Releases the geometry of the renderer
+void TerrainRenderer::Clear()
+{
+    m_mesh.Clear();
+    m_renderer->Clear();
+    m_triangleCount = 0;
 }
 
 /// \brief Translate the chunk terrain renderer
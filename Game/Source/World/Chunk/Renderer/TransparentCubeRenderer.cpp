@@ -42,13 +42,13 @@ TransparentCubeRenderer::TransparentCubeRenderer()
 
 /// \brief Static batching for terrain cubes
 /// \param pCubes The cubes of the chunk
-void TransparentCubeRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Chunk * neighbors[6])
+void TransparentCubeRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][WorldSettings::s_chunkSize][WorldSettings::s_chunkSize], Chunk * neighbors[6], WorldBuffers & buffers)
 {
     // Resizing the vector to ensure that the current size
     // is large enough to hold all vertices and UVs
-    WorldBuffers::s_chunkVertexBuffer.resize   (WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_chunkNormalBuffer.resize   (WorldSettings::s_chunkVertexCount);
-    WorldBuffers::s_chunkUVsBuffer.resize      (WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkVertexBuffer.resize   (WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkNormalBuffer.resize   (WorldSettings::s_chunkVertexCount);
+    buffers.m_chunkUVsBuffer.resize      (WorldSettings::s_chunkVertexCount);
 
     size_t vertexIndex = 0;
     float half         = ByteCube::s_cubeSize / 2.0f;
@@ -92,98 +92,111 @@ void TransparentCubeRenderer::Batch(ByteCube pCubes[WorldSettings::s_chunkSize][
                     float UVx =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 0] * WorldSettings::s_textureStep;
                     float UVy =  UVManager::UV[cube.GetType() >> 1][nFace * 2 + 1] * WorldSettings::s_textureStep;
 
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 0];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 1];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 2];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  0] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  1] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  2] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 0];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 1];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 2];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  0] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  1] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  2] * half + offset.z;
 
                     vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 3];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 4];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 5];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  3] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  4] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  5] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 3];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 4];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 5];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  3] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  4] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  5] * half + offset.z;
                     vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy+ WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 6];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 7];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 8];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  6] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  7] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  8] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy+ WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 6];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 7];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 8];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  6] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex +  7] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex +  8] * half + offset.z;
 
                     vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex +  9];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 10];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 11];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  9] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 10] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 11] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy + WorldSettings::s_textureStep;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex +  9];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 10];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 11];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex +  9] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 10] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 11] * half + offset.z;
 
                     vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 12];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 13];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 14];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 12] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 13] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 14] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 12];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 13];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 14];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 12] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 13] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 14] * half + offset.z;
 
                     vertexIndex += 1;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
-                    WorldBuffers::s_chunkUVsBuffer   [vertexIndex].y = UVy;
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 15];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 16];
-                    WorldBuffers::s_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 17];
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 15] * half + offset.x;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 16] * half + offset.y;
-                    WorldBuffers::s_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 17] * half + offset.z;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].x = UVx + WorldSettings::s_textureStep;
+                    buffers.m_chunkUVsBuffer   [vertexIndex].y = UVy;
+                    buffers.m_chunkNormalBuffer[vertexIndex].x = ByteCube::s_normals [faceIndex + 15];
+                    buffers.m_chunkNormalBuffer[vertexIndex].y = ByteCube::s_normals [faceIndex + 16];
+                    buffers.m_chunkNormalBuffer[vertexIndex].z = ByteCube::s_normals [faceIndex + 17];
+                    buffers.m_chunkVertexBuffer[vertexIndex].x = ByteCube::s_vertices[faceIndex + 15] * half + offset.x;
+                    buffers.m_chunkVertexBuffer[vertexIndex].y = ByteCube::s_vertices[faceIndex + 16] * half + offset.y;
+                    buffers.m_chunkVertexBuffer[vertexIndex].z = ByteCube::s_vertices[faceIndex + 17] * half + offset.z;
                     vertexIndex += 1;
                 }
             }
         }
     }
 
-    WorldBuffers::s_chunkVertexBuffer.resize(vertexIndex);
-    WorldBuffers::s_chunkNormalBuffer.resize(vertexIndex);
-    WorldBuffers::s_chunkUVsBuffer.resize   (vertexIndex);
+    buffers.m_chunkVertexBuffer.resize(vertexIndex);
+    buffers.m_chunkNormalBuffer.resize(vertexIndex);
+    buffers.m_chunkUVsBuffer.resize   (vertexIndex);
 
     cardinal::VBOIndexer::Index(
-            WorldBuffers::s_chunkVertexBuffer,
-            WorldBuffers::s_chunkNormalBuffer,
-            WorldBuffers::s_chunkUVsBuffer,
-            WorldBuffers::s_chunkIndexesBuffer,
-            WorldBuffers::s_chunkIndexedVertexBuffer,
-            WorldBuffers::s_chunkIndexedNormalBuffer,
-            WorldBuffers::s_chunkIndexedUVsBuffer);
-
-    if (WorldBuffers::s_chunkIndexesBuffer.size() != 0) // NOLINT
+            buffers.m_chunkVertexBuffer,
+            buffers.m_chunkNormalBuffer,
+            buffers.m_chunkUVsBuffer,
+            buffers.m_chunkIndexesBuffer,
+            buffers.m_chunkIndexedVertexBuffer,
+            buffers.m_chunkIndexedNormalBuffer,
+            buffers.m_chunkIndexedUVsBuffer);
+
+    if (buffers.m_chunkIndexesBuffer.size() != 0) // NOLINT
     {
-        m_renderer->Initialize(
-                WorldBuffers::s_chunkIndexesBuffer,
-                WorldBuffers::s_chunkIndexedVertexBuffer,
-                WorldBuffers::s_chunkIndexedNormalBuffer,
-                WorldBuffers::s_chunkIndexedUVsBuffer);
+        m_mesh.Store(
+                buffers.m_chunkIndexesBuffer,
+                buffers.m_chunkIndexedVertexBuffer,
+                buffers.m_chunkIndexedNormalBuffer,
+                buffers.m_chunkIndexedUVsBuffer);
     }
 
-    WorldBuffers::s_chunkUVsBuffer.clear();
-    WorldBuffers::s_chunkNormalBuffer.clear();
-    WorldBuffers::s_chunkVertexBuffer.clear();
-    WorldBuffers::s_chunkIndexesBuffer.clear();
-    WorldBuffers::s_chunkIndexedUVsBuffer.clear();
-    WorldBuffers::s_chunkIndexedVertexBuffer.clear();
-    WorldBuffers::s_chunkIndexedNormalBuffer.clear();
+    buffers.m_chunkUVsBuffer.clear();
+    buffers.m_chunkNormalBuffer.clear();
+    buffers.m_chunkVertexBuffer.clear();
+    buffers.m_chunkIndexesBuffer.clear();
+    buffers.m_chunkIndexedUVsBuffer.clear();
+    buffers.m_chunkIndexedVertexBuffer.clear();
+    buffers.m_chunkIndexedNormalBuffer.clear();
+}
+
+/// \brief Uploads the last batch to the GPU
+void TransparentCubeRenderer::Upload()
+{
+    m_mesh.Upload(m_renderer);
+}
+
+/// \brief Releases the geometry of the renderer
+void TransparentCubeRenderer::Clear()
+{
+    m_mesh.Clear();
+    m_renderer->Clear();
 }
 
 /// \brief Translate the chunk terrain renderer
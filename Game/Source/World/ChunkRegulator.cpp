@@ -2,6 +2,7 @@
 // Created by kelle on 19/02/2018.
 //
 
+#include <algorithm>
 #include "World/ChunkRegulator.hpp"
 
 ChunkRegulator::ChunkRegulator(World *world) : mp_world(world)
@@ -12,4 +13,478 @@ ChunkRegulator::ChunkRegulator(World *world) : mp_world(world)
     m_playerChunkText->Initialize();
     m_playerChunkText->SetText("Cube : 0 0 0",  680, 530, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
     m_playerCubeText->SetText ("Chunk : 0 0 0", 680, 515, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+    m_bTracking   = false;
+    m_bStop       = false;
+    m_playerChunk = glm::tvec3<int>(0, 0, 0);
+
+    size_t workerCount = std::max(1u, WorldSettings::s_streamingWorkers);
+    m_buffers.resize(workerCount);
+    for(size_t nWorker = 0; nWorker < workerCount; ++nWorker)
+    {
+        m_workers.emplace_back(&ChunkRegulator::WorkerLoop, this, nWorker);
+    }
+}
+
+/// \brief Destructor, cancels all jobs and stops the workers
+ChunkRegulator::~ChunkRegulator()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_bStop = true;
+    }
+
+    m_condition.notify_all();
+    for(std::thread & worker : m_workers)
+    {
+        worker.join();
+    }
+
+    // Jobs of cancelled shifts are only referenced by the ready list
+    for(StreamingJob * pJob : m_readyJobs)
+    {
+        if(pJob->m_bCancelled)
+        {
+            delete pJob->m_pChunk;
+            delete pJob;
+        }
+    }
+
+    for(PendingShift & shift : m_pendingShifts)
+    {
+        for(StreamingJob * pJob : shift.m_jobs)
+        {
+            delete pJob->m_pChunk;
+            delete pJob;
+        }
+    }
+
+    for(Chunk * pChunk : m_spareChunks)
+    {
+        delete pChunk;
+    }
+}
+
+/// \brief Sets the function filling the cubes of the streamed chunks
+void ChunkRegulator::SetChunkGenerator(ChunkGenerator const& generator)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_generator = generator;
+}
+
+/// \brief Updates the world from the character position
+/// \param position The position of the character
+void ChunkRegulator::Update(const glm::vec3 &position, float /* dt */)
+{
+    // Updating debug text
+    // Computing player position, rounded down to stay right in negative coordinates
+    int posX = static_cast<int>(glm::floor(position.x / ByteCube::s_cubeSize));
+    int posY = static_cast<int>(glm::floor(position.y / ByteCube::s_cubeSize));
+    int posZ = static_cast<int>(glm::floor(position.z / ByteCube::s_cubeSize));
+
+    int chunkX = static_cast<int>(glm::floor(posX / static_cast<float>(WorldSettings::s_chunkSize)));
+    int chunkY = static_cast<int>(glm::floor(posY / static_cast<float>(WorldSettings::s_chunkSize)));
+    int chunkZ = static_cast<int>(glm::floor(posZ / static_cast<float>(WorldSettings::s_chunkSize)));
+
+    glm::tvec3<int> currentPosition(chunkX, chunkY, chunkZ);
+
+    std::string _cube  = "Cube : "  + std::to_string(posX)   + " " + std::to_string(posY)   + " " + std::to_string(posZ);
+    std::string _chunk = "Chunk : " + std::to_string(chunkX) + " " + std::to_string(chunkY) + " " + std::to_string(chunkZ);
+
+    m_playerChunkText->SetText(_cube.c_str(),  680, 530, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    m_playerCubeText->SetText (_chunk.c_str(), 680, 515, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+
+    // Debug draw
+    for(uint x = 0; x < WorldSettings::s_matSize; ++x)
+    {
+        for(uint y = 0; y < WorldSettings::s_matSize; ++y)
+        {
+            for(uint z = 0; z < WorldSettings::s_matHeight; ++z)
+            {
+                glm::vec3 boxColor;
+                glm::tvec3<int> chunkIndex = mp_world->m_chunks[x][y][z]->GetChunkIndex();
+
+                if(chunkIndex.x == chunkX && chunkIndex.y == chunkY && chunkIndex.z == chunkZ)
+                {
+                    boxColor = glm::vec3(1.0f, 0.0f, 0.0f);
+                }
+                else if(mp_world->m_chunks[x][y][z]->GetState() == Chunk::EChunkState::Generated)
+                {
+                    boxColor = glm::vec3(0.0f, 1.0f, 0.0f);
+                }
+
+                int chunkSize = (int)WorldSettings::s_chunkSize; // NOLINT
+                cardinal::debug::DrawBox(glm::vec3(
+                        (chunkIndex.x * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f,
+                        (chunkIndex.y * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f,
+                        (chunkIndex.z * (chunkSize * ByteCube::s_cubeSize)) + (8.0f * ByteCube::s_cubeSize) - ByteCube::s_cubeSize / 2.0f),
+                                chunkSize * ByteCube::s_cubeSize,
+                                chunkSize * ByteCube::s_cubeSize, boxColor);
+
+            }
+        }
+    }
+
+    // The first update only records the player position
+    if(!m_bTracking)
+    {
+        m_lastPlayerPos = currentPosition;
+        m_targetOrigin  = GetRingChunk(glm::tvec3<int>(0, 0, 0))->GetChunkIndex();
+        m_bTracking     = true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_playerChunk = currentPosition;
+    }
+
+    // Checking delta position
+    glm::tvec3<int> delta = currentPosition - m_lastPlayerPos;
+    m_lastPlayerPos       = currentPosition;
+
+    CheckChunkDelta(delta);
+    UploadReadyChunks();
+    ApplyReadyShifts();
+}
+
+/// \brief Worker loop, generates and batches the closest queued chunk
+/// \param nWorker The index of the worker
+void ChunkRegulator::WorkerLoop(size_t nWorker)
+{
+    WorldBuffers & buffers = m_buffers[nWorker];
+
+    while(true)
+    {
+        StreamingJob * pJob = nullptr;
+        ChunkGenerator generator;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_bStop || !m_queuedJobs.empty(); });
+
+            if(m_bStop)
+            {
+                return;
+            }
+
+            // The closest chunk to the player goes first
+            auto closest = std::min_element(m_queuedJobs.begin(), m_queuedJobs.end(),
+                [this](StreamingJob const* a, StreamingJob const* b)
+                {
+                    return GetSquaredDistance(a->m_chunkIndex, m_playerChunk) < GetSquaredDistance(b->m_chunkIndex, m_playerChunk);
+                });
+
+            pJob = *closest;
+            m_queuedJobs.erase(closest);
+            generator = m_generator;
+        }
+
+        Chunk & chunk = *pJob->m_pChunk;
+        if(!pJob->m_bCancelled)
+        {
+            if(generator)
+            {
+                generator(chunk);
+            }
+            else
+            {
+                ByteCube air;
+                air.SetType(ByteCube::EType::Air);
+                air.Disable();
+                chunk.Fill(air);
+            }
+        }
+
+        if(!pJob->m_bCancelled)
+        {
+            chunk.Batch(buffers);
+
+            if(WorldSettings::s_compressChunks)
+            {
+                chunk.Compress();
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_readyJobs.push_back(pJob);
+    }
+}
+
+/// \brief Checks if the player changed of chunks
+///        A move cancels the last pending shift when it goes the other way
+///        The ring spans the whole height of the terrain, it only moves horizontally
+/// \param delta The delta position (in chunks unit)
+void ChunkRegulator::CheckChunkDelta(glm::tvec3<int> const& delta)
+{
+    for(int axis = 0; axis < 2; ++axis)
+    {
+        int direction = delta[axis] > 0 ? 1 : -1;
+        for(int nStep = 0; nStep < std::abs(delta[axis]); ++nStep)
+        {
+            if(!m_pendingShifts.empty()
+            &&  m_pendingShifts.back().m_axis      ==  axis
+            &&  m_pendingShifts.back().m_direction == -direction)
+            {
+                CancelLastShift();
+            }
+            else
+            {
+                QueueShift(axis, direction);
+            }
+        }
+    }
+}
+
+/// \brief Queues the jobs of the slice exposed by a translation of the ring
+/// \param axis The axis of the translation
+/// \param direction 1 or -1
+void ChunkRegulator::QueueShift(int axis, int direction)
+{
+    m_targetOrigin[axis] += direction;
+
+    PendingShift shift;
+    shift.m_axis      = axis;
+    shift.m_direction = direction;
+
+    int axisU = (axis + 1) % 3;
+    int axisV = (axis + 2) % 3;
+
+    Chunk * noNeighbors[6] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+    for(int u = 0; u < GetRingSize(axisU); ++u)
+    {
+        for(int v = 0; v < GetRingSize(axisV); ++v)
+        {
+            StreamingJob * pJob = new StreamingJob();
+            pJob->m_ringIndex[axis]  = direction > 0 ? GetRingSize(axis) - 1 : 0;
+            pJob->m_ringIndex[axisU] = u;
+            pJob->m_ringIndex[axisV] = v;
+            pJob->m_chunkIndex       = m_targetOrigin + pJob->m_ringIndex;
+            pJob->m_bCancelled       = false;
+            pJob->m_bUploaded        = false;
+
+            // Renderers are touched on this thread only, the chunk is not drawn yet
+            pJob->m_pChunk = AllocateSpareChunk();
+            pJob->m_pChunk->Initialize(pJob->m_chunkIndex.x, pJob->m_chunkIndex.y, pJob->m_chunkIndex.z);
+            pJob->m_pChunk->SetNeighbors(noNeighbors);
+            pJob->m_pChunk->SetState(Chunk::EChunkState::Generating);
+
+            shift.m_jobs.push_back(pJob);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuedJobs.insert(m_queuedJobs.end(), shift.m_jobs.begin(), shift.m_jobs.end());
+    }
+
+    m_condition.notify_all();
+    m_pendingShifts.push_back(std::move(shift));
+}
+
+/// \brief Cancels the last pending shift, its jobs are dropped
+void ChunkRegulator::CancelLastShift()
+{
+    PendingShift & shift = m_pendingShifts.back();
+    m_targetOrigin[shift.m_axis] -= shift.m_direction;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(StreamingJob * pJob : shift.m_jobs)
+    {
+        pJob->m_bCancelled = true;
+
+        auto queued = std::find(m_queuedJobs.begin(), m_queuedJobs.end(), pJob);
+        auto ready  = std::find(m_readyJobs.begin(),  m_readyJobs.end(),  pJob);
+
+        if(queued != m_queuedJobs.end())
+        {
+            m_queuedJobs.erase(queued);
+        }
+        else if(ready != m_readyJobs.end())
+        {
+            m_readyJobs.erase(ready);
+        }
+        else if(!pJob->m_bUploaded)
+        {
+            // A worker still owns the job, it is dropped once handed back
+            continue;
+        }
+
+        pJob->m_pChunk->Clear();
+        m_spareChunks.push_back(pJob->m_pChunk);
+        delete pJob;
+    }
+
+    m_pendingShifts.pop_back();
+}
+
+/// \brief Uploads ready chunks within the frame budget
+void ChunkRegulator::UploadReadyChunks()
+{
+    std::vector<StreamingJob *> uploads;
+    std::vector<StreamingJob *> dropped;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto stale = std::partition(m_readyJobs.begin(), m_readyJobs.end(),
+            [](StreamingJob const* pJob) { return !pJob->m_bCancelled; });
+
+        dropped.assign(stale, m_readyJobs.end());
+        m_readyJobs.erase(stale, m_readyJobs.end());
+
+        // The closest chunks to the player are uploaded first
+        std::sort(m_readyJobs.begin(), m_readyJobs.end(),
+            [this](StreamingJob const* a, StreamingJob const* b)
+            {
+                return GetSquaredDistance(a->m_chunkIndex, m_playerChunk) < GetSquaredDistance(b->m_chunkIndex, m_playerChunk);
+            });
+
+        size_t count = std::min(static_cast<size_t>(WorldSettings::s_streamingUploadBudget), m_readyJobs.size());
+        uploads.assign(m_readyJobs.begin(), m_readyJobs.begin() + count);
+        m_readyJobs.erase(m_readyJobs.begin(), m_readyJobs.begin() + count);
+    }
+
+    for(StreamingJob * pJob : dropped)
+    {
+        pJob->m_pChunk->Clear();
+        m_spareChunks.push_back(pJob->m_pChunk);
+        delete pJob;
+    }
+
+    for(StreamingJob * pJob : uploads)
+    {
+        pJob->m_pChunk->Upload();
+        pJob->m_bUploaded = true;
+    }
+}
+
+/// \brief Applies the pending shifts whose slice is fully uploaded
+void ChunkRegulator::ApplyReadyShifts()
+{
+    while(!m_pendingShifts.empty())
+    {
+        PendingShift & shift = m_pendingShifts.front();
+
+        bool bReady = std::all_of(shift.m_jobs.begin(), shift.m_jobs.end(),
+            [](StreamingJob const* pJob) { return pJob->m_bUploaded; });
+
+        if(!bReady)
+        {
+            return;
+        }
+
+        ApplyShift(shift);
+        for(StreamingJob * pJob : shift.m_jobs)
+        {
+            pJob->m_pChunk->SetState(Chunk::EChunkState::Generated);
+            delete pJob;
+        }
+
+        m_pendingShifts.pop_front();
+    }
+}
+
+/// \brief Translates the ring of chunks and inserts the new slice
+///        The chunks leaving the ring become spare chunks, the chunks
+///        on both sides of the new seam are batched again
+/// \param shift The shift to apply
+void ChunkRegulator::ApplyShift(PendingShift const& shift)
+{
+    int axis  = shift.m_axis;
+    int axisU = (axis + 1) % 3;
+    int axisV = (axis + 2) % 3;
+    int size  = GetRingSize(axis);
+
+    for(int u = 0; u < GetRingSize(axisU); ++u)
+    {
+        for(int v = 0; v < GetRingSize(axisV); ++v)
+        {
+            glm::tvec3<int> from;
+            glm::tvec3<int> to;
+            from[axisU] = to[axisU] = u;
+            from[axisV] = to[axisV] = v;
+
+            // Translate pointers
+            to[axis] = shift.m_direction > 0 ? 0 : size - 1;
+            Chunk * pTrailing = GetRingChunk(to);
+
+            for(int nStep = 0; nStep < size - 1; ++nStep)
+            {
+                from[axis] = to[axis] + shift.m_direction;
+                GetRingChunk(to) = GetRingChunk(from);
+                to[axis] = from[axis];
+            }
+
+            pTrailing->Clear();
+            m_spareChunks.push_back(pTrailing);
+        }
+    }
+
+    for(StreamingJob * pJob : shift.m_jobs)
+    {
+        GetRingChunk(pJob->m_ringIndex) = pJob->m_pChunk;
+    }
+
+    // The chunks kept in the ring still point to the ones that left it,
+    // which are recycled and filled again by the workers
+    mp_world->LinkNeighbors();
+
+    // Both sides of the seam were meshed without a neighbor across it,
+    // their faces on the seam are batched again to be culled
+    int newSlice = shift.m_direction > 0 ? size - 1 : 0;
+    int oldSlice = newSlice - shift.m_direction;
+
+    std::vector<Chunk *> seamChunks;
+    for(int u = 0; u < GetRingSize(axisU); ++u)
+    {
+        for(int v = 0; v < GetRingSize(axisV); ++v)
+        {
+            glm::tvec3<int> ringIndex;
+            ringIndex[axisU] = u;
+            ringIndex[axisV] = v;
+
+            ringIndex[axis] = newSlice;
+            seamChunks.push_back(GetRingChunk(ringIndex));
+
+            if(size > 1)
+            {
+                ringIndex[axis] = oldSlice;
+                seamChunks.push_back(GetRingChunk(ringIndex));
+            }
+        }
+    }
+
+    mp_world->BatchChunks(seamChunks);
+}
+
+/// \brief Returns a chunk out of the ring, allocating it if needed
+Chunk * ChunkRegulator::AllocateSpareChunk()
+{
+    if(m_spareChunks.empty())
+    {
+        return new Chunk();
+    }
+
+    Chunk * pChunk = m_spareChunks.back();
+    m_spareChunks.pop_back();
+    return pChunk;
+}
+
+/// \brief Returns the size of the ring along the given axis
+/* static */ int ChunkRegulator::GetRingSize(int axis)
+{
+    return static_cast<int>(axis == 2 ? WorldSettings::s_matHeight : WorldSettings::s_matSize);
+}
+
+/// \brief Returns the chunk of the ring at the given index
+Chunk *& ChunkRegulator::GetRingChunk(glm::tvec3<int> const& ringIndex)
+{
+    return mp_world->m_chunks[ringIndex.x][ringIndex.y][ringIndex.z];
+}
+
+/// \brief Returns the squared distance between two chunk indexes
+/* static */ int ChunkRegulator::GetSquaredDistance(glm::tvec3<int> const& a, glm::tvec3<int> const& b)
+{
+    glm::tvec3<int> delta = a - b;
+    return delta.x * delta.x + delta.y * delta.y + delta.z * delta.z;
 }
@@ -4,6 +4,15 @@
 #include "Glm/glm/glm.hpp"
 #include "World/Generator/Noise/FastNoise.h"
 #include <algorithm>
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include "Runtime/Core/Debug/Logger.hpp"
+#include "Runtime/Rendering/RenderingEngine.hpp"
+
+// About 70 trees in the world
+static const float s_treesPerColumn = 70.0f / static_cast<float>(WorldSettings::s_matSize * WorldSettings::s_matSize);
 
 World * BasicWorldGenerator::generateWorld(GenerationSettings settings)
 {
@@ -12,42 +21,6 @@ World * BasicWorldGenerator::generateWorld(GenerationSettings settings)
     return regenerateWorld(settings);
 }
 
-double map(double x, double in_min, double in_max, double out_min, double out_max)
-{
-    ASSERT_TRUE(x >= in_min && x <= in_max);
-    double result = (x - in_min) / (in_max - in_min) + out_min * (out_max - out_min);
-    ASSERT_TRUE(result >= out_min && result <= out_max);
-    return result;
-}
-
-inline float clamp(double x, double a, double b)
-{
-    return x < a ? a : (x > b ? b : x);
-}
-
-void BasicWorldGenerator::generateHeights()
-{
-    FastNoise noiseGenerator(m_generationSettings.seed);
-    noiseGenerator.SetNoiseType(m_generationSettings.noiseType);
-    noiseGenerator.SetInterp(m_generationSettings.interpolationType);
-    noiseGenerator.SetFrequency(m_generationSettings.frequency);
-    //noiseGenerator.SetGradientPerturbAmp(m_generationSettings.gradientPerturb); // TODO check that
-    noiseGenerator.SetFractalType(m_generationSettings.fractalType);
-    noiseGenerator.SetFractalOctaves(m_generationSettings.octaves);
-    noiseGenerator.SetFractalLacunarity(m_generationSettings.lacunarity);
-    noiseGenerator.SetFractalGain(m_generationSettings.gain);
-    noiseGenerator.SetCellularDistanceFunction(m_generationSettings.distanceFunction);
-    noiseGenerator.SetCellularReturnType(m_generationSettings.returnType);
-	for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
-		for (int y = 0; y < WorldSettings::s_matSizeCubes; y++)
-		{
-			double noise = clamp(noiseGenerator.GetNoise(x, y), -1.0, 1.0);
-
-            noise = map(noise, -1.0, 1.0, 0.0, 1.0);
-			buildStack(x, y, WorldSettings::s_matHeightCubes * noise, false);
-		}
-}
-
 /// Generate a cube pile
 void BasicWorldGenerator::buildStack(int x, int y, int height, bool onlyIfZero)
 {
@@ -55,8 +28,8 @@ void BasicWorldGenerator::buildStack(int x, int y, int height, bool onlyIfZero)
 
 	if (height < 1)
 		height = 1;
-	if (height > WorldSettings::s_matHeightCubes)
-		height = WorldSettings::s_matHeightCubes;
+	if (height > static_cast<int>(WorldSettings::s_matHeightCubes))
+		height = static_cast<int>(WorldSettings::s_matHeightCubes);
 
     mp_currentWorld->m_worldHeights[x][y] = height;
 
@@ -80,7 +53,7 @@ void BasicWorldGenerator::buildStack(int x, int y, int height, bool onlyIfZero)
         cube->SetType(ByteCube::EType::Snow);
 	}
 
-	for (int z = height; z < WorldSettings::s_matHeightCubes; z++)
+	for (int z = height; z < static_cast<int>(WorldSettings::s_matHeightCubes); z++)
 	{
         ByteCube* cube = mp_currentWorld->GetCube(x, y, z);
         cube->Enable();
@@ -144,19 +117,20 @@ void BasicWorldGenerator::generate_piles(int x1, int y1,
 void BasicWorldGenerator::smooth()
 {
     int sizeWidow = 4;
+    const int matSizeCubes = static_cast<int>(WorldSettings::s_matSizeCubes);
     int worldHeightsTemp[WorldSettings::s_matSizeCubes][WorldSettings::s_matSizeCubes];
     memset(worldHeightsTemp, 0x00, sizeof(int)*WorldSettings::s_matSizeCubes*WorldSettings::s_matSizeCubes);
-    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
+    for (int x = 0; x<matSizeCubes; x++)
     {
-        for (int y = 0; y<WorldSettings::s_matSizeCubes; y++)
+        for (int y = 0; y<matSizeCubes; y++)
         {
             //on moyenne sur une distance
             int nb = 0;
             for (int i = (x - sizeWidow < 0 ? 0 : x - sizeWidow);
-                 i < (x + sizeWidow >= WorldSettings::s_matSizeCubes ? WorldSettings::s_matSizeCubes - 1 : x + sizeWidow); i++)
+                 i < (x + sizeWidow >= matSizeCubes ? matSizeCubes - 1 : x + sizeWidow); i++)
             {
                 for (int j = (y - sizeWidow < 0 ? 0 : y - sizeWidow);
-                     j <(y + sizeWidow >= WorldSettings::s_matSizeCubes ? WorldSettings::s_matSizeCubes - 1 : y + sizeWidow); j++)
+                     j <(y + sizeWidow >= matSizeCubes ? matSizeCubes - 1 : y + sizeWidow); j++)
                 {
                     worldHeightsTemp[x][y] += mp_currentWorld->m_worldHeights[i][j];
                     nb++;
@@ -168,9 +142,9 @@ void BasicWorldGenerator::smooth()
     }
 
     //On reset les piles
-    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
+    for (int x = 0; x<matSizeCubes; x++)
     {
-        for (int y = 0; y<WorldSettings::s_matSizeCubes; y++)
+        for (int y = 0; y<matSizeCubes; y++)
         {
             buildStack(x, y, worldHeightsTemp[x][y], false);
         }
@@ -181,17 +155,27 @@ void BasicWorldGenerator::generate3DPerlinWorld() {
     FastNoise noiseGenerator(m_generationSettings.seed);
     noiseGenerator.SetNoiseType(FastNoise::PerlinFractal);
     noiseGenerator.SetFractalOctaves(4);
-    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
-        for (int y = 0; y < WorldSettings::s_matSizeCubes; y++)
-        {
-            for (int z = 0; z < WorldSettings::s_matHeightCubes; z++)
-            {
-                double noise = noiseGenerator.GetNoise(x, y, z);
-                if (noise > 0)
-                    mp_currentWorld->GetCube(x, y, z)->SetType(ByteCube::EType::Snow);
-                mp_currentWorld->GetCube(x, y, z)->Enable();
-            }
-        }
+
+    forEachColumn([&](int chunkX, int chunkY)
+    {
+        const int size   = WorldSettings::s_chunkSize;
+        const int height = WorldSettings::s_matHeightCubes;
+        const int x0     = chunkX * size;
+        const int y0     = chunkY * size;
+
+        std::vector<FN_DECIMAL> noises(size * size * height);
+        noiseGenerator.FillNoiseGrid(noises.data(), x0, y0, 0, size, size, height);
+
+        for (int z = 0; z < height; z++)
+            for (int x = 0; x < size; x++)
+                for (int y = 0; y < size; y++)
+                {
+                    double noise = noises[(z * size + y) * size + x];
+                    if (noise > 0)
+                        mp_currentWorld->GetCube(x0 + x, y0 + y, z)->SetType(ByteCube::EType::Snow);
+                    mp_currentWorld->GetCube(x0 + x, y0 + y, z)->Enable();
+                }
+    });
 }
 
 void BasicWorldGenerator::generateFBNWorld() {
@@ -213,15 +197,15 @@ void BasicWorldGenerator::generateCaves() {
     int iter = 50;
     int x =50  , y = 50, z = 52;
     mp_currentWorld->GetCube(x, y, z)->SetType(ByteCube::EType::Dirt);
-    FastNoise noiseGeneratorX(rand());
+    FastNoise noiseGeneratorX(TerrainGenerator::GetRegionSeed(m_generationSettings.seed, TerrainGenerator::Pass::Caves, 0));
     noiseGeneratorX.SetNoiseType(FastNoise::PerlinFractal);
     noiseGeneratorX.SetFrequency(0.01);
     noiseGeneratorX.SetFractalOctaves(1);
-    FastNoise noiseGeneratorY(rand());
+    FastNoise noiseGeneratorY(TerrainGenerator::GetRegionSeed(m_generationSettings.seed, TerrainGenerator::Pass::Caves, 1));
     noiseGeneratorY.SetNoiseType(FastNoise::PerlinFractal);
     noiseGeneratorY.SetFractalOctaves(1);
     noiseGeneratorY.SetFrequency(0.01);
-    FastNoise noiseGeneratorZ(rand());
+    FastNoise noiseGeneratorZ(TerrainGenerator::GetRegionSeed(m_generationSettings.seed, TerrainGenerator::Pass::Caves, 2));
     noiseGeneratorZ.SetNoiseType(FastNoise::PerlinFractal);
     noiseGeneratorZ.SetFractalOctaves(1);
     noiseGeneratorZ.SetFrequency(0.01);
@@ -245,9 +229,10 @@ void BasicWorldGenerator::generateCavesWithCA() {
                                         WorldSettings::s_matHeightCubes,
                                         WorldSettings::s_matHeightCubes);
 
-    for (int x = 0; x<WorldSettings::s_matHeightCubes; x++)
-        for (int y = 0; y < WorldSettings::s_matHeightCubes; y++)
-            for (int z = 0; z < WorldSettings::s_matHeightCubes; z++)
+    const int matHeightCubes = static_cast<int>(WorldSettings::s_matHeightCubes);
+    for (int x = 0; x < matHeightCubes; x++)
+        for (int y = 0; y < matHeightCubes; y++)
+            for (int z = 0; z < matHeightCubes; z++)
             {
                 if (cells[x][y][z].currentState) {
                     mp_currentWorld->GetCube(x, y, z)->SetType(ByteCube::EType::Air);
@@ -271,6 +256,8 @@ World* BasicWorldGenerator::generateWorld()
 
 World *BasicWorldGenerator::regenerateWorld(GenerationSettings settings)
 {
+    auto generationBegin = std::chrono::steady_clock::now();
+
     if (mp_currentWorld == nullptr)
     {
         mp_currentWorld = new World();
@@ -283,12 +270,14 @@ World *BasicWorldGenerator::regenerateWorld(GenerationSettings settings)
     m_randomGenerator = std::default_random_engine(m_generationSettings.seed);
 
     //generateCaves();
-    generateHeights();
-    generateGrass();
-    generateTrees(70);
+    generateTerrain();
     //generateFBNWorld();
     //smooth();
 
+    auto generationEnd = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(generationEnd - generationBegin);
+    cardinal::Logger::LogInfo("World generated in %d ms", static_cast<int>(elapsed.count()));
+
     mp_currentWorld->Batch();
     return mp_currentWorld;
 }
@@ -297,47 +286,42 @@ void BasicWorldGenerator::applySettings(GenerationSettings settings) {
     m_generationSettings = settings;
 }
 
-void BasicWorldGenerator::generateTree(int x, int y, int z) {
-    int trunkHeight = 4;
-    for (int i = 0; i < trunkHeight; ++i) {
-        mp_currentWorld->GetCube(x, y, z + i)->SetType(ByteCube::EType::Wood1);
-    }
-
-    // Create leaves
-    for (int i = -1; i < 2; ++i) {
-        for (int j = -1; j < 2; ++j) {
-            for (int k = 0; k < 2; ++k) {
-                mp_currentWorld->GetCube(x + i, y + j, z + k + trunkHeight - 1)->SetType(ByteCube::EType::Leaf1);
-            }
-        }
-    }
+void BasicWorldGenerator::generateTerrain() {
+    const int columnCount = static_cast<int>(WorldSettings::s_matSize);
+    const int chunkCount  = static_cast<int>(WorldSettings::s_matHeight);
 
-    mp_currentWorld->GetCube(x, y, z + 2 + trunkHeight - 1)->SetType(ByteCube::EType::Leaf1);
+    // The columns are generated by the same code as the streamed chunks
+    TerrainGenerator terrain(m_generationSettings, s_treesPerColumn);
+    terrain.GenerateRegion(cardinal::RenderingEngine::GetWorkerPool(), columnCount, columnCount, chunkCount,
+                           [this, chunkCount](int chunkX, int chunkY, int const* pHeights, ByteCube const* pCubes)
+    {
+        const int size = static_cast<int>(WorldSettings::s_chunkSize);
+        for (int x = 0; x < size; x++)
+            for (int y = 0; y < size; y++)
+                mp_currentWorld->m_worldHeights[chunkX * size + x][chunkY * size + y] = pHeights[x * size + y];
+
+        for (int chunkZ = 0; chunkZ < chunkCount; chunkZ++)
+            mp_currentWorld->m_chunks[chunkX][chunkY][chunkZ]->Assign(pCubes + chunkZ * WorldSettings::s_chunkBlockCount);
+    });
 }
 
-void BasicWorldGenerator::generateTrees(int numberTrees) {
-    std::default_random_engine generator;
-    std::poisson_distribution<int> distribution(WorldSettings::s_matSizeCubes / 2);
-    for (int i = 0; i < numberTrees; ++i) {
-        int x = rand()  % WorldSettings::s_matSizeCubes;
-        int y = rand()  % WorldSettings::s_matSizeCubes;
-        if (x >= 2 && x < WorldSettings::s_matSizeCubes - 1 && y >= 2 && y < WorldSettings::s_matSizeCubes - 1)
-            generateTree(x, y, mp_currentWorld->m_worldHeights[x][y]);
-        else numberTrees++;
-    }
-}
+ChunkRegulator::ChunkGenerator BasicWorldGenerator::getChunkGenerator() const {
+    // The generator keeps its own copy of the settings
+    std::shared_ptr<TerrainGenerator> terrain = std::make_shared<TerrainGenerator>(m_generationSettings, s_treesPerColumn);
 
-void BasicWorldGenerator::generateGrass() {
-    FastNoise noiseGenerator(rand());
-    noiseGenerator.SetNoiseType(FastNoise::PerlinFractal);
-    noiseGenerator.SetFrequency(0.15);
-    noiseGenerator.SetFractalOctaves(1);
-    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
-        for (int y = 0; y < WorldSettings::s_matSizeCubes; y++) {
-            double noise = noiseGenerator.GetNoise(x, y);
-            if (noise > 0)
-                mp_currentWorld->GetCube(x, y, mp_currentWorld->m_worldHeights[x][y])->SetType(ByteCube::EType::Grass1);
-        }
+    return [terrain](Chunk & chunk) {
+        ByteCube cubes[WorldSettings::s_chunkBlockCount];
+        terrain->GenerateChunk(chunk.GetChunkIndex(), cubes);
+        chunk.Assign(cubes);
+    };
 }
 
+void BasicWorldGenerator::forEachColumn(std::function<void(int chunkX, int chunkY)> const& job) {
+    const int columnCount = static_cast<int>(WorldSettings::s_matSize * WorldSettings::s_matSize);
+
+    // One job per column on the worker pool of the engine, the calling thread works too
+    cardinal::RenderingEngine::GetWorkerPool().ParallelFor(columnCount, [&](int nColumn) {
+        job(nColumn / static_cast<int>(WorldSettings::s_matSize), nColumn % static_cast<int>(WorldSettings::s_matSize));
+    });
+}
 
@@ -34,6 +34,15 @@
 #include <algorithm>
 #include <random>
 
+// SSE2 lanes for FillNoiseGrid(...), float only
+#if !defined(FN_USE_DOUBLES) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define FN_GRID_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
 const FN_DECIMAL GRAD_X[] =
 {
 	1, -1, 1, -1,
@@ -2254,3 +2263,557 @@ void FastNoise::SingleGradientPerturb(unsigned char offset, FN_DECIMAL warpAmp,
 	x += Lerp(lx0x, lx1x, ys) * warpAmp;
 	y += Lerp(ly0x, ly1x, ys) * warpAmp;
 }
+
+// Grid evaluation
+
+bool FastNoise::IsGridSIMDSupported()
+{
+#if defined(FN_GRID_SSE2)
+#if defined(_MSC_VER)
+	static const bool supported = []()
+	{
+		int info[4];
+		__cpuid(info, 1);
+		return (info[3] & (1 << 26)) != 0;
+	}();
+#else
+	static const bool supported = __builtin_cpu_supports("sse2") != 0;
+#endif
+	return supported;
+#else
+	return false;
+#endif
+}
+
+bool FastNoise::UseGridSIMD() const
+{
+	if (!m_gridSIMD || !IsGridSIMDSupported())
+		return false;
+
+	switch (m_noiseType)
+	{
+	case Perlin:
+	case Simplex:
+		return true;
+	case PerlinFractal:
+	case SimplexFractal:
+		return m_fractalType == FBM || m_fractalType == Billow || m_fractalType == RigidMulti;
+	default:
+		return false;
+	}
+}
+
+#if defined(FN_GRID_SSE2)
+
+// Each lane follows the operation order of the scalar functions above, only the
+// permutation table lookups are done lane by lane. The gradients are selected from
+// the bits of their lut position instead of being loaded from GRAD_X, GRAD_Y and GRAD_Z
+
+struct GridSSE2
+{
+	const unsigned char* perm;
+	const unsigned char* perm12;
+	FastNoise::Interp    interp;
+};
+
+static inline __m128 Set1(FN_DECIMAL f) { return _mm_set1_ps(f); }
+
+// Matches FastFloor, including its -1 on negative integers
+static inline __m128i FastFloorSSE2(__m128 f)
+{
+	__m128i truncated = _mm_cvttps_epi32(f);
+	__m128i negative  = _mm_castps_si128(_mm_cmplt_ps(f, _mm_setzero_ps()));
+	return _mm_add_epi32(truncated, negative);
+}
+
+static inline __m128 LerpSSE2(__m128 a, __m128 b, __m128 t)
+{
+	return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+static inline __m128 InterpSSE2(FastNoise::Interp interp, __m128 t)
+{
+	switch (interp)
+	{
+	case FastNoise::Hermite:
+		return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(Set1(3), _mm_mul_ps(Set1(2), t)));
+	case FastNoise::Quintic:
+		return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t),
+			_mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, Set1(6)), Set1(15))), Set1(10)));
+	default:
+		return t;
+	}
+}
+
+// Index2D_12 of each lane
+static inline __m128i Index2D_12SSE2(const GridSSE2& grid, unsigned char offset, __m128i x, __m128i y)
+{
+	alignas(16) int xi[4];
+	alignas(16) int yi[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(xi), x);
+	_mm_store_si128(reinterpret_cast<__m128i*>(yi), y);
+
+	int lutPos[4];
+	for (int l = 0; l < 4; l++)
+		lutPos[l] = grid.perm12[(xi[l] & 0xff) + grid.perm[(yi[l] & 0xff) + offset]];
+
+	return _mm_setr_epi32(lutPos[0], lutPos[1], lutPos[2], lutPos[3]);
+}
+
+// Index3D_12 of each lane
+static inline __m128i Index3D_12SSE2(const GridSSE2& grid, unsigned char offset, __m128i x, __m128i y, __m128i z)
+{
+	alignas(16) int xi[4];
+	alignas(16) int yi[4];
+	alignas(16) int zi[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(xi), x);
+	_mm_store_si128(reinterpret_cast<__m128i*>(yi), y);
+	_mm_store_si128(reinterpret_cast<__m128i*>(zi), z);
+
+	int lutPos[4];
+	for (int l = 0; l < 4; l++)
+		lutPos[l] = grid.perm12[(xi[l] & 0xff) + grid.perm[(yi[l] & 0xff) + grid.perm[(zi[l] & 0xff) + offset]]];
+
+	return _mm_setr_epi32(lutPos[0], lutPos[1], lutPos[2], lutPos[3]);
+}
+
+static inline __m128 SelectSSE2(__m128 mask, __m128 a, __m128 b)
+{
+	return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// Sign mask of the given bit of the lut positions
+static inline __m128 SignBitSSE2(__m128i lutPos, int bit)
+{
+	return _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(lutPos, bit), 31));
+}
+
+// The 12 gradients are (+-1, +-1, 0), (+-1, 0, +-1) and (0, +-1, +-1),
+// bit 0 of the lut position gives the sign of the first non zero component
+// and bit 1 the sign of the second one
+static inline __m128 GradCoord2DSSE2(__m128i lutPos, __m128 xd, __m128 yd)
+{
+	__m128 below4 = _mm_castsi128_ps(_mm_cmplt_epi32(lutPos, _mm_set1_epi32(4)));
+	__m128 below8 = _mm_castsi128_ps(_mm_cmplt_epi32(lutPos, _mm_set1_epi32(8)));
+
+	__m128 u = _mm_xor_ps(SelectSSE2(below8, xd, yd), SignBitSSE2(lutPos, 0));
+	__m128 v = _mm_and_ps(below4, _mm_xor_ps(yd, SignBitSSE2(lutPos, 1)));
+
+	return _mm_add_ps(u, v);
+}
+
+static inline __m128 GradCoord3DSSE2(__m128i lutPos, __m128 xd, __m128 yd, __m128 zd)
+{
+	__m128 below4 = _mm_castsi128_ps(_mm_cmplt_epi32(lutPos, _mm_set1_epi32(4)));
+	__m128 below8 = _mm_castsi128_ps(_mm_cmplt_epi32(lutPos, _mm_set1_epi32(8)));
+
+	__m128 u = _mm_xor_ps(SelectSSE2(below8, xd, yd), SignBitSSE2(lutPos, 0));
+	__m128 v = _mm_xor_ps(SelectSSE2(below4, yd, zd), SignBitSSE2(lutPos, 1));
+
+	return _mm_add_ps(u, v);
+}
+
+// Index3D_12 of the 8 corners of the cells, corner c is at (x0 + (c & 1), y0 + ((c >> 1) & 1), z0 + (c >> 2))
+// The permutation chains shared by the corners are only walked once, and lanes
+// in the same cell as the previous lane reuse its indexes
+static inline void CellIndex3D_12SSE2(const GridSSE2& grid, unsigned char offset, __m128i x0, __m128i y0, __m128i z0, __m128i lutPos[8])
+{
+	alignas(16) int xi[4];
+	alignas(16) int yi[4];
+	alignas(16) int zi[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(xi), x0);
+	_mm_store_si128(reinterpret_cast<__m128i*>(yi), y0);
+	_mm_store_si128(reinterpret_cast<__m128i*>(zi), z0);
+
+	// All the lanes in the same cell, the common case on a grid
+	bool uniform = xi[0] == xi[3] && yi[0] == yi[3] && zi[0] == zi[3];
+
+	int corners[4][8];
+	for (int l = 0; l < (uniform ? 1 : 4); l++)
+	{
+		if (l > 0 && xi[l] == xi[l - 1] && yi[l] == yi[l - 1] && zi[l] == zi[l - 1])
+		{
+			for (int c = 0; c < 8; c++)
+				corners[l][c] = corners[l - 1][c];
+			continue;
+		}
+
+		int x = xi[l] & 0xff;
+		int y = yi[l] & 0xff;
+		int z = zi[l] & 0xff;
+		for (int dz = 0; dz < 2; dz++)
+		{
+			int hz = grid.perm[((z + dz) & 0xff) + offset];
+			for (int dy = 0; dy < 2; dy++)
+			{
+				int hy = grid.perm[((y + dy) & 0xff) + hz];
+				corners[l][dz * 4 + dy * 2    ] = grid.perm12[x + hy];
+				corners[l][dz * 4 + dy * 2 + 1] = grid.perm12[((x + 1) & 0xff) + hy];
+			}
+		}
+	}
+
+	if (uniform)
+	{
+		for (int c = 0; c < 8; c++)
+			lutPos[c] = _mm_set1_epi32(corners[0][c]);
+		return;
+	}
+
+	for (int c = 0; c < 8; c++)
+		lutPos[c] = _mm_setr_epi32(corners[0][c], corners[1][c], corners[2][c], corners[3][c]);
+}
+
+static inline void CellIndex2D_12SSE2(const GridSSE2& grid, unsigned char offset, __m128i x0, __m128i y0, __m128i lutPos[4])
+{
+	alignas(16) int xi[4];
+	alignas(16) int yi[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(xi), x0);
+	_mm_store_si128(reinterpret_cast<__m128i*>(yi), y0);
+
+	// All the lanes in the same cell, the common case on a grid
+	bool uniform = xi[0] == xi[3] && yi[0] == yi[3];
+
+	int corners[4][4];
+	for (int l = 0; l < (uniform ? 1 : 4); l++)
+	{
+		if (l > 0 && xi[l] == xi[l - 1] && yi[l] == yi[l - 1])
+		{
+			for (int c = 0; c < 4; c++)
+				corners[l][c] = corners[l - 1][c];
+			continue;
+		}
+
+		int x = xi[l] & 0xff;
+		int y = yi[l] & 0xff;
+		for (int dy = 0; dy < 2; dy++)
+		{
+			int hy = grid.perm[((y + dy) & 0xff) + offset];
+			corners[l][dy * 2    ] = grid.perm12[x + hy];
+			corners[l][dy * 2 + 1] = grid.perm12[((x + 1) & 0xff) + hy];
+		}
+	}
+
+	if (uniform)
+	{
+		for (int c = 0; c < 4; c++)
+			lutPos[c] = _mm_set1_epi32(corners[0][c]);
+		return;
+	}
+
+	for (int c = 0; c < 4; c++)
+		lutPos[c] = _mm_setr_epi32(corners[0][c], corners[1][c], corners[2][c], corners[3][c]);
+}
+
+static __m128 SinglePerlinSSE2(const GridSSE2& grid, unsigned char offset, __m128 x, __m128 y)
+{
+	__m128i x0 = FastFloorSSE2(x);
+	__m128i y0 = FastFloorSSE2(y);
+
+	__m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+	__m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+	__m128 xd1 = _mm_sub_ps(xd0, Set1(1));
+	__m128 yd1 = _mm_sub_ps(yd0, Set1(1));
+
+	__m128 xs = InterpSSE2(grid.interp, xd0);
+	__m128 ys = InterpSSE2(grid.interp, yd0);
+
+	__m128i lutPos[4];
+	CellIndex2D_12SSE2(grid, offset, x0, y0, lutPos);
+
+	__m128 xf0 = LerpSSE2(GradCoord2DSSE2(lutPos[0], xd0, yd0), GradCoord2DSSE2(lutPos[1], xd1, yd0), xs);
+	__m128 xf1 = LerpSSE2(GradCoord2DSSE2(lutPos[2], xd0, yd1), GradCoord2DSSE2(lutPos[3], xd1, yd1), xs);
+
+	return LerpSSE2(xf0, xf1, ys);
+}
+
+static __m128 SinglePerlinSSE2(const GridSSE2& grid, unsigned char offset, __m128 x, __m128 y, __m128 z)
+{
+	__m128i x0 = FastFloorSSE2(x);
+	__m128i y0 = FastFloorSSE2(y);
+	__m128i z0 = FastFloorSSE2(z);
+
+	__m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+	__m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+	__m128 zd0 = _mm_sub_ps(z, _mm_cvtepi32_ps(z0));
+	__m128 xd1 = _mm_sub_ps(xd0, Set1(1));
+	__m128 yd1 = _mm_sub_ps(yd0, Set1(1));
+	__m128 zd1 = _mm_sub_ps(zd0, Set1(1));
+
+	__m128 xs = InterpSSE2(grid.interp, xd0);
+	__m128 ys = InterpSSE2(grid.interp, yd0);
+	__m128 zs = InterpSSE2(grid.interp, zd0);
+
+	__m128i lutPos[8];
+	CellIndex3D_12SSE2(grid, offset, x0, y0, z0, lutPos);
+
+	__m128 xf00 = LerpSSE2(GradCoord3DSSE2(lutPos[0], xd0, yd0, zd0), GradCoord3DSSE2(lutPos[1], xd1, yd0, zd0), xs);
+	__m128 xf10 = LerpSSE2(GradCoord3DSSE2(lutPos[2], xd0, yd1, zd0), GradCoord3DSSE2(lutPos[3], xd1, yd1, zd0), xs);
+	__m128 xf01 = LerpSSE2(GradCoord3DSSE2(lutPos[4], xd0, yd0, zd1), GradCoord3DSSE2(lutPos[5], xd1, yd0, zd1), xs);
+	__m128 xf11 = LerpSSE2(GradCoord3DSSE2(lutPos[6], xd0, yd1, zd1), GradCoord3DSSE2(lutPos[7], xd1, yd1, zd1), xs);
+
+	__m128 yf0 = LerpSSE2(xf00, xf10, ys);
+	__m128 yf1 = LerpSSE2(xf01, xf11, ys);
+
+	return LerpSSE2(yf0, yf1, zs);
+}
+
+static inline __m128 NotSSE2(__m128 mask)
+{
+	return _mm_xor_ps(mask, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+}
+
+// Contribution of a simplex corner, zero when t < 0
+static inline __m128 SimplexCornerSSE2(__m128 t, __m128 gradient)
+{
+	__m128 inside = _mm_cmpge_ps(t, _mm_setzero_ps());
+	t = _mm_mul_ps(t, t);
+	return _mm_and_ps(inside, _mm_mul_ps(_mm_mul_ps(t, t), gradient));
+}
+
+static __m128 SingleSimplexSSE2(const GridSSE2& grid, unsigned char offset, __m128 x, __m128 y)
+{
+	const __m128i one  = _mm_set1_epi32(1);
+	const __m128  oneF = Set1(1);
+
+	__m128 t = _mm_mul_ps(_mm_add_ps(x, y), Set1(F2));
+	__m128i i = FastFloorSSE2(_mm_add_ps(x, t));
+	__m128i j = FastFloorSSE2(_mm_add_ps(y, t));
+
+	t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(i, j)), Set1(G2));
+	__m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+	__m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+
+	__m128 upper = _mm_cmpgt_ps(x0, y0);
+	__m128i i1 = _mm_and_si128(_mm_castps_si128(upper), one);
+	__m128i j1 = _mm_andnot_si128(_mm_castps_si128(upper), one);
+
+	__m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(upper, oneF)), Set1(G2));
+	__m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_andnot_ps(upper, oneF)), Set1(G2));
+	__m128 x2 = _mm_add_ps(_mm_sub_ps(x0, oneF), Set1(2 * G2));
+	__m128 y2 = _mm_add_ps(_mm_sub_ps(y0, oneF), Set1(2 * G2));
+
+	__m128 t0 = _mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.5)), _mm_mul_ps(x0, x0)), _mm_mul_ps(y0, y0));
+	__m128 t1 = _mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.5)), _mm_mul_ps(x1, x1)), _mm_mul_ps(y1, y1));
+	__m128 t2 = _mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.5)), _mm_mul_ps(x2, x2)), _mm_mul_ps(y2, y2));
+
+	__m128 n0 = SimplexCornerSSE2(t0, GradCoord2DSSE2(Index2D_12SSE2(grid, offset, i, j), x0, y0));
+	__m128 n1 = SimplexCornerSSE2(t1, GradCoord2DSSE2(Index2D_12SSE2(grid, offset, _mm_add_epi32(i, i1), _mm_add_epi32(j, j1)), x1, y1));
+	__m128 n2 = SimplexCornerSSE2(t2, GradCoord2DSSE2(Index2D_12SSE2(grid, offset, _mm_add_epi32(i, one), _mm_add_epi32(j, one)), x2, y2));
+
+	return _mm_mul_ps(Set1(70), _mm_add_ps(_mm_add_ps(n0, n1), n2));
+}
+
+static __m128 SingleSimplexSSE2(const GridSSE2& grid, unsigned char offset, __m128 x, __m128 y, __m128 z)
+{
+	const __m128i one  = _mm_set1_epi32(1);
+	const __m128  oneF = Set1(1);
+
+	__m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(x, y), z), Set1(F3));
+	__m128i i = FastFloorSSE2(_mm_add_ps(x, t));
+	__m128i j = FastFloorSSE2(_mm_add_ps(y, t));
+	__m128i k = FastFloorSSE2(_mm_add_ps(z, t));
+
+	t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_add_epi32(i, j), k)), Set1(G3));
+	__m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+	__m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+	__m128 z0 = _mm_sub_ps(z, _mm_sub_ps(_mm_cvtepi32_ps(k), t));
+
+	// Branchless version of the corner ordering of the scalar SingleSimplex
+	__m128 xy = _mm_cmpge_ps(x0, y0);
+	__m128 yz = _mm_cmpge_ps(y0, z0);
+	__m128 xz = _mm_cmpge_ps(x0, z0);
+
+	__m128 i1 = _mm_and_ps(xy, _mm_or_ps(yz, xz));
+	__m128 j1 = _mm_andnot_ps(xy, yz);
+	__m128 k1 = NotSSE2(_mm_or_ps(yz, _mm_and_ps(xy, xz)));
+	__m128 i2 = _mm_or_ps(xy, _mm_and_ps(yz, xz));
+	__m128 j2 = _mm_or_ps(yz, NotSSE2(xy));
+	__m128 k2 = NotSSE2(_mm_and_ps(yz, _mm_or_ps(xy, xz)));
+
+	__m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(i1, oneF)), Set1(G3));
+	__m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(j1, oneF)), Set1(G3));
+	__m128 z1 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(k1, oneF)), Set1(G3));
+	__m128 x2 = _mm_add_ps(_mm_sub_ps(x0, _mm_and_ps(i2, oneF)), Set1(2 * G3));
+	__m128 y2 = _mm_add_ps(_mm_sub_ps(y0, _mm_and_ps(j2, oneF)), Set1(2 * G3));
+	__m128 z2 = _mm_add_ps(_mm_sub_ps(z0, _mm_and_ps(k2, oneF)), Set1(2 * G3));
+	__m128 x3 = _mm_add_ps(_mm_sub_ps(x0, oneF), Set1(3 * G3));
+	__m128 y3 = _mm_add_ps(_mm_sub_ps(y0, oneF), Set1(3 * G3));
+	__m128 z3 = _mm_add_ps(_mm_sub_ps(z0, oneF), Set1(3 * G3));
+
+	__m128 t0 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.6)), _mm_mul_ps(x0, x0)), _mm_mul_ps(y0, y0)), _mm_mul_ps(z0, z0));
+	__m128 t1 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.6)), _mm_mul_ps(x1, x1)), _mm_mul_ps(y1, y1)), _mm_mul_ps(z1, z1));
+	__m128 t2 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.6)), _mm_mul_ps(x2, x2)), _mm_mul_ps(y2, y2)), _mm_mul_ps(z2, z2));
+	__m128 t3 = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(Set1(FN_DECIMAL(0.6)), _mm_mul_ps(x3, x3)), _mm_mul_ps(y3, y3)), _mm_mul_ps(z3, z3));
+
+	__m128i ii1 = _mm_and_si128(_mm_castps_si128(i1), one);
+	__m128i jj1 = _mm_and_si128(_mm_castps_si128(j1), one);
+	__m128i kk1 = _mm_and_si128(_mm_castps_si128(k1), one);
+	__m128i ii2 = _mm_and_si128(_mm_castps_si128(i2), one);
+	__m128i jj2 = _mm_and_si128(_mm_castps_si128(j2), one);
+	__m128i kk2 = _mm_and_si128(_mm_castps_si128(k2), one);
+
+	__m128 n0 = SimplexCornerSSE2(t0, GradCoord3DSSE2(Index3D_12SSE2(grid, offset, i, j, k), x0, y0, z0));
+	__m128 n1 = SimplexCornerSSE2(t1, GradCoord3DSSE2(Index3D_12SSE2(grid, offset, _mm_add_epi32(i, ii1), _mm_add_epi32(j, jj1), _mm_add_epi32(k, kk1)), x1, y1, z1));
+	__m128 n2 = SimplexCornerSSE2(t2, GradCoord3DSSE2(Index3D_12SSE2(grid, offset, _mm_add_epi32(i, ii2), _mm_add_epi32(j, jj2), _mm_add_epi32(k, kk2)), x2, y2, z2));
+	__m128 n3 = SimplexCornerSSE2(t3, GradCoord3DSSE2(Index3D_12SSE2(grid, offset, _mm_add_epi32(i, one), _mm_add_epi32(j, one), _mm_add_epi32(k, one)), x3, y3, z3));
+
+	return _mm_mul_ps(Set1(32), _mm_add_ps(_mm_add_ps(_mm_add_ps(n0, n1), n2), n3));
+}
+
+// Single noise of the grid, 2D or 3D
+struct SinglePerlin2DSSE2  { __m128 operator()(const GridSSE2& g, unsigned char o, __m128 x, __m128 y, __m128)  const { return SinglePerlinSSE2(g, o, x, y); } };
+struct SinglePerlin3DSSE2  { __m128 operator()(const GridSSE2& g, unsigned char o, __m128 x, __m128 y, __m128 z) const { return SinglePerlinSSE2(g, o, x, y, z); } };
+struct SingleSimplex2DSSE2 { __m128 operator()(const GridSSE2& g, unsigned char o, __m128 x, __m128 y, __m128)  const { return SingleSimplexSSE2(g, o, x, y); } };
+struct SingleSimplex3DSSE2 { __m128 operator()(const GridSSE2& g, unsigned char o, __m128 x, __m128 y, __m128 z) const { return SingleSimplexSSE2(g, o, x, y, z); } };
+
+struct FractalSSE2
+{
+	bool                    fractal;
+	FastNoise::FractalType  type;
+	int                     octaves;
+	FN_DECIMAL              lacunarity;
+	FN_DECIMAL              gain;
+	FN_DECIMAL              bounding;
+};
+
+static inline __m128 AbsSSE2(__m128 f)
+{
+	return _mm_andnot_ps(Set1(FN_DECIMAL(-0.0)), f);
+}
+
+// Mirrors the Single*Fractal* functions, the z lane is ignored in 2D
+template <typename Single>
+static __m128 FractalNoiseSSE2(const GridSSE2& grid, const FractalSSE2& fractal, __m128 x, __m128 y, __m128 z)
+{
+	Single single;
+	if (!fractal.fractal)
+		return single(grid, 0, x, y, z);
+
+	__m128 lacunarity = Set1(fractal.lacunarity);
+	__m128 sum;
+	switch (fractal.type)
+	{
+	case FastNoise::Billow:
+		sum = _mm_sub_ps(_mm_mul_ps(AbsSSE2(single(grid, grid.perm[0], x, y, z)), Set1(2)), Set1(1));
+		break;
+	case FastNoise::RigidMulti:
+		sum = _mm_sub_ps(Set1(1), AbsSSE2(single(grid, grid.perm[0], x, y, z)));
+		break;
+	default:
+		sum = single(grid, grid.perm[0], x, y, z);
+		break;
+	}
+
+	FN_DECIMAL amp = 1;
+	int i = 0;
+
+	while (++i < fractal.octaves)
+	{
+		x = _mm_mul_ps(x, lacunarity);
+		y = _mm_mul_ps(y, lacunarity);
+		z = _mm_mul_ps(z, lacunarity);
+
+		amp *= fractal.gain;
+		__m128 noise = single(grid, grid.perm[i], x, y, z);
+		switch (fractal.type)
+		{
+		case FastNoise::Billow:
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(AbsSSE2(noise), Set1(2)), Set1(1)), Set1(amp)));
+			break;
+		case FastNoise::RigidMulti:
+			sum = _mm_sub_ps(sum, _mm_mul_ps(_mm_sub_ps(Set1(1), AbsSSE2(noise)), Set1(amp)));
+			break;
+		default:
+			sum = _mm_add_ps(sum, _mm_mul_ps(noise, Set1(amp)));
+			break;
+		}
+	}
+
+	return fractal.type == FastNoise::RigidMulti ? sum : _mm_mul_ps(sum, Set1(fractal.bounding));
+}
+
+// Stores the first count lanes of a vector
+static inline void StoreLanesSSE2(FN_DECIMAL* out, __m128 v, int count)
+{
+	if (count == 4)
+	{
+		_mm_storeu_ps(out, v);
+		return;
+	}
+
+	alignas(16) FN_DECIMAL lanes[4];
+	_mm_store_ps(lanes, v);
+	for (int l = 0; l < count; l++)
+		out[l] = lanes[l];
+}
+
+template <typename Single>
+static void FillGridSSE2(const GridSSE2& grid, const FractalSSE2& fractal, FN_DECIMAL frequency,
+	FN_DECIMAL* out, FN_DECIMAL x0, FN_DECIMAL y0, FN_DECIMAL z0, int width, int height, int depth, FN_DECIMAL step)
+{
+	const __m128 lane = _mm_set_ps(3, 2, 1, 0);
+	const __m128 frequencyV = Set1(frequency);
+
+	for (int k = 0; k < depth; k++)
+	{
+		__m128 z = _mm_mul_ps(Set1(z0 + (FN_DECIMAL)k * step), frequencyV);
+		for (int j = 0; j < height; j++)
+		{
+			__m128 y = _mm_mul_ps(Set1(y0 + (FN_DECIMAL)j * step), frequencyV);
+			for (int i = 0; i < width; i += 4)
+			{
+				__m128 x = _mm_add_ps(Set1(x0), _mm_mul_ps(_mm_add_ps(Set1((FN_DECIMAL)i), lane), Set1(step)));
+				x = _mm_mul_ps(x, frequencyV);
+
+				StoreLanesSSE2(out, FractalNoiseSSE2<Single>(grid, fractal, x, y, z), std::min(4, width - i));
+				out += std::min(4, width - i);
+			}
+		}
+	}
+}
+
+#endif
+
+void FastNoise::FillNoiseGrid(FN_DECIMAL* out, FN_DECIMAL x0, FN_DECIMAL y0, int width, int height, FN_DECIMAL step) const
+{
+#if defined(FN_GRID_SSE2)
+	if (UseGridSIMD())
+	{
+		GridSSE2    grid    = { m_perm, m_perm12, m_interp };
+		FractalSSE2 fractal = { m_noiseType == PerlinFractal || m_noiseType == SimplexFractal, m_fractalType, m_octaves, m_lacunarity, m_gain, m_fractalBounding };
+
+		if (m_noiseType == Perlin || m_noiseType == PerlinFractal)
+			FillGridSSE2<SinglePerlin2DSSE2>(grid, fractal, m_frequency, out, x0, y0, 0, width, height, 1, step);
+		else
+			FillGridSSE2<SingleSimplex2DSSE2>(grid, fractal, m_frequency, out, x0, y0, 0, width, height, 1, step);
+		return;
+	}
+#endif
+
+	for (int j = 0; j < height; j++)
+		for (int i = 0; i < width; i++)
+			*out++ = GetNoise(x0 + (FN_DECIMAL)i * step, y0 + (FN_DECIMAL)j * step);
+}
+
+void FastNoise::FillNoiseGrid(FN_DECIMAL* out, FN_DECIMAL x0, FN_DECIMAL y0, FN_DECIMAL z0, int width, int height, int depth, FN_DECIMAL step) const
+{
+#if defined(FN_GRID_SSE2)
+	if (UseGridSIMD())
+	{
+		GridSSE2    grid    = { m_perm, m_perm12, m_interp };
+		FractalSSE2 fractal = { m_noiseType == PerlinFractal || m_noiseType == SimplexFractal, m_fractalType, m_octaves, m_lacunarity, m_gain, m_fractalBounding };
+
+		if (m_noiseType == Perlin || m_noiseType == PerlinFractal)
+			FillGridSSE2<SinglePerlin3DSSE2>(grid, fractal, m_frequency, out, x0, y0, z0, width, height, depth, step);
+		else
+			FillGridSSE2<SingleSimplex3DSSE2>(grid, fractal, m_frequency, out, x0, y0, z0, width, height, depth, step);
+		return;
+	}
+#endif
+
+	for (int k = 0; k < depth; k++)
+		for (int j = 0; j < height; j++)
+			for (int i = 0; i < width; i++)
+				*out++ = GetNoise(x0 + (FN_DECIMAL)i * step, y0 + (FN_DECIMAL)j * step, z0 + (FN_DECIMAL)k * step);
+}
@@ -0,0 +1,246 @@
+/// Copyright (C) 2018-2019, Cardinal Engine
+/// Vincent STEHLY--CALISTO, vincentstehly@hotmail.fr
+///
+/// This program is free software; you can redistribute it and/or modify
+/// it under the terms of the GNU General Public License as published by
+/// the Free Software Foundation; either version 2 of the License, or
+/// (at your option) any later version.
+///
+/// This program is distributed in the hope that it will be useful,
+/// but WITHOUT ANY WARRANTY; without even the implied warranty of
+/// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+/// GNU General Public License for more details.
+///
+/// You should have received a copy of the GNU General Public License along
+/// with this program; if not, write to the Free Software Foundation, Inc.,
+/// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+/// \file       TerrainGenerator.cpp
+/// \date       17/10/2026
+/// \project    Cardinal Engine
+/// \package    World/Generator
+/// \author     Vincent STEHLY--CALISTO
+
+#include <cmath>
+#include <random>
+#include <cstdint>
+#include <algorithm>
+
+#include "World/Generator/TerrainGenerator.hpp"
+
+/// \brief Constructor
+/// \param settings The settings of the height noise
+/// \param treesPerColumn The average number of trees per chunk column
+TerrainGenerator::TerrainGenerator(GenerationSettings const& settings, float treesPerColumn)
+: m_settings(settings)
+, m_heightNoise(settings.seed)
+, m_grassNoise(GetRegionSeed(settings.seed, Pass::Grass))
+, m_treesPerColumn(treesPerColumn)
+{
+    m_heightNoise.SetNoiseType(m_settings.noiseType);
+    m_heightNoise.SetInterp(m_settings.interpolationType);
+    m_heightNoise.SetFrequency(m_settings.frequency);
+    m_heightNoise.SetFractalType(m_settings.fractalType);
+    m_heightNoise.SetFractalOctaves(m_settings.octaves);
+    m_heightNoise.SetFractalLacunarity(m_settings.lacunarity);
+    m_heightNoise.SetFractalGain(m_settings.gain);
+    m_heightNoise.SetCellularDistanceFunction(m_settings.distanceFunction);
+    m_heightNoise.SetCellularReturnType(m_settings.returnType);
+
+    m_grassNoise.SetNoiseType(FastNoise::PerlinFractal);
+    m_grassNoise.SetFrequency(0.15);
+    m_grassNoise.SetFractalOctaves(1);
+}
+
+/// \brief Generates the cubes of a chunk
+/// \param chunkIndex The index of the chunk
+/// \param pCubes The s_chunkBlockCount cubes to fill
+void TerrainGenerator::GenerateChunk(glm::tvec3<int> const& chunkIndex, ByteCube * pCubes) const
+{
+    Column column;
+    BuildColumn(chunkIndex.x, chunkIndex.y, column);
+    WriteChunk(column, chunkIndex.z, pCubes);
+}
+
+/// \brief Generates the chunks [0, chunkCount) of a column
+/// \param chunkX The x index of the column
+/// \param chunkY The y index of the column
+/// \param chunkCount The number of chunks of the column
+/// \param pHeights The s_chunkSize * s_chunkSize heights to fill, may be null
+/// \param pCubes The chunkCount * s_chunkBlockCount cubes to fill
+void TerrainGenerator::GenerateColumn(int chunkX, int chunkY, int chunkCount, int * pHeights, ByteCube * pCubes) const
+{
+    Column column;
+    BuildColumn(chunkX, chunkY, column);
+
+    for(int chunkZ = 0; chunkZ < chunkCount; ++chunkZ)
+    {
+        WriteChunk(column, chunkZ, pCubes + chunkZ * WorldSettings::s_chunkBlockCount);
+    }
+
+    if(pHeights != nullptr)
+    {
+        std::copy(&column.heights[0][0], &column.heights[0][0] + WorldSettings::s_chunkSize * WorldSettings::s_chunkSize, pHeights);
+    }
+}
+
+/// \brief Generates the columns [0, columnCountX) x [0, columnCountY) on the pool
+///        The result does not depend on the number of threads of the pool
+/// \param pool The pool running one job per column
+/// \param columnCountX The number of columns along x
+/// \param columnCountY The number of columns along y
+/// \param chunkCount The number of chunks of each column
+/// \param sink Receives the columns
+void TerrainGenerator::GenerateRegion(cardinal::WorkerPool & pool, int columnCountX, int columnCountY, int chunkCount, ColumnSink const& sink) const
+{
+    pool.ParallelFor(columnCountX * columnCountY, [&](int nColumn)
+    {
+        const int chunkX = nColumn / columnCountY;
+        const int chunkY = nColumn % columnCountY;
+
+        std::vector<int>      heights(WorldSettings::s_chunkSize * WorldSettings::s_chunkSize);
+        std::vector<ByteCube> cubes  (static_cast<size_t>(chunkCount) * WorldSettings::s_chunkBlockCount);
+        GenerateColumn(chunkX, chunkY, chunkCount, heights.data(), cubes.data());
+
+        sink(chunkX, chunkY, heights.data(), cubes.data());
+    });
+}
+
+/// \brief  Returns a seed derived from the world seed, unique for a pass and a chunk column
+///         The same world seed always gives the same seeds, whatever the number of workers
+/// \param  worldSeed The seed of the world
+/// \param  pass The generation pass
+/// \param  chunkX The x index of the column
+/// \param  chunkY The y index of the column
+/// \return The seed
+/* static */ int TerrainGenerator::GetRegionSeed(int worldSeed, Pass pass, int chunkX, int chunkY)
+{
+    // splitmix64 finalizer over the world seed, the pass and the column
+    uint64_t hash = static_cast<uint32_t>(worldSeed);
+    hash ^= static_cast<uint64_t>(pass) * 0x9E3779B97F4A7C15ull;
+    hash ^= static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) * 0xC2B2AE3D27D4EB4Full;
+    hash ^= static_cast<uint64_t>(static_cast<uint32_t>(chunkY)) * 0x165667B19E3779F9ull;
+
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+    hash =  hash ^ (hash >> 31);
+
+    return static_cast<int>(hash >> 33);
+}
+
+/// \brief Evaluates the heights, the grass and the trees of a column
+/// \param chunkX The x index of the column
+/// \param chunkY The y index of the column
+/// \param column The column to fill
+void TerrainGenerator::BuildColumn(int chunkX, int chunkY, Column & column) const
+{
+    const int size      = static_cast<int>(WorldSettings::s_chunkSize);
+    const int maxHeight = static_cast<int>(WorldSettings::s_matHeightCubes);
+    const int x0        = chunkX * size;
+    const int y0        = chunkY * size;
+
+    // Evaluates the noises of the column at once, vectorized for Perlin and Simplex
+    FN_DECIMAL heightNoises[WorldSettings::s_chunkSize * WorldSettings::s_chunkSize];
+    FN_DECIMAL grassNoises [WorldSettings::s_chunkSize * WorldSettings::s_chunkSize];
+    m_heightNoise.FillNoiseGrid(heightNoises, x0, y0, size, size);
+    m_grassNoise.FillNoiseGrid (grassNoises,  x0, y0, size, size);
+
+    for(int x = 0; x < size; ++x)
+    {
+        for(int y = 0; y < size; ++y)
+        {
+            // Maps the noise from [-1, 1] to [0, 1]
+            double noise  = std::min(std::max(static_cast<double>(heightNoises[y * size + x]), -1.0), 1.0);
+            int    height = static_cast<int>(maxHeight * (noise + 1.0) / 2.0);
+
+            column.heights[x][y] = std::min(std::max(height, 1), maxHeight);
+            column.grass  [x][y] = grassNoises[y * size + x] > 0;
+        }
+    }
+
+    // The trees are kept one cube away from the borders of the
+    // column so that the leaves never reach a neighbor column
+    std::mt19937 generator(static_cast<uint32_t>(GetRegionSeed(m_settings.seed, Pass::Trees, chunkX, chunkY)));
+    std::uniform_int_distribution<int>    position(1, size - 2);
+    std::uniform_real_distribution<float> extra(0.0f, 1.0f);
+
+    int treeCount = static_cast<int>(m_treesPerColumn);
+    if(extra(generator) < m_treesPerColumn - static_cast<float>(treeCount))
+    {
+        treeCount++;
+    }
+
+    column.trees.clear();
+    for(int nTree = 0; nTree < treeCount; ++nTree)
+    {
+        int x = position(generator);
+        int y = position(generator);
+        column.trees.emplace_back(x, y);
+    }
+}
+
+/// \brief Writes the cubes of a chunk of the column
+/// \param column The column
+/// \param chunkZ The z index of the chunk
+/// \param pCubes The s_chunkBlockCount cubes to fill
+/* static */ void TerrainGenerator::WriteChunk(Column const& column, int chunkZ, ByteCube * pCubes)
+{
+    const int size = static_cast<int>(WorldSettings::s_chunkSize);
+    const int z0   = chunkZ * size;
+
+    auto setType = [pCubes, size, z0](int x, int y, int z, ByteCube::EType type)
+    {
+        if(z >= z0 && z < z0 + size)
+        {
+            pCubes[(x * size + y) * size + (z - z0)].SetType(type);
+        }
+    };
+
+    // Stacks : rock, three cubes of dirt topped with snow, then air
+    for(int x = 0; x < size; ++x)
+    {
+        for(int y = 0; y < size; ++y)
+        {
+            const int height = column.heights[x][y];
+            for(int z = z0; z < z0 + size; ++z)
+            {
+                ByteCube & cube = pCubes[(x * size + y) * size + (z - z0)];
+                cube.Enable();
+
+                if(z < height - 3)
+                    cube.SetType(ByteCube::EType::Rock);
+                else if(z == height - 1 && height - 3 > 0)
+                    cube.SetType(ByteCube::EType::Snow);
+                else if(z < height)
+                    cube.SetType(ByteCube::EType::Dirt);
+                else if(z == height && column.grass[x][y])
+                    cube.SetType(ByteCube::EType::Grass1);
+                else
+                    cube.SetType(ByteCube::EType::Air);
+            }
+        }
+    }
+
+    // Trees : a trunk under two layers of leaves and a top leaf
+    for(glm::tvec2<int> const& tree : column.trees)
+    {
+        const int height = column.heights[tree.x][tree.y];
+        for(int z = height; z < height + s_trunkHeight; ++z)
+        {
+            setType(tree.x, tree.y, z, ByteCube::EType::Wood1);
+        }
+
+        for(int i = -1; i < 2; ++i)
+        {
+            for(int j = -1; j < 2; ++j)
+            {
+                for(int k = 0; k < 2; ++k)
+                {
+                    setType(tree.x + i, tree.y + j, height + s_trunkHeight - 1 + k, ByteCube::EType::Leaf1);
+                }
+            }
+        }
+
+        setType(tree.x, tree.y, height + s_trunkHeight + 1, ByteCube::EType::Leaf1);
+    }
+}
@@ -21,10 +21,14 @@
 /// \package    World
 /// \author     Vincent STEHLY--CALISTO
 
+#include <mutex>
+#include <atomic>
+#include <thread>
 #include <iostream>
+#include <algorithm>
+#include <condition_variable>
 #include "World/World.hpp"
 
-#include "Runtime/Physics/PhysicsEngine.hpp"
 
 /// \brief Default constructor
 World::World()
@@ -43,8 +47,6 @@ World::World()
     m_worldText->SetText("World info",          730, 580, 14, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
     m_cubeText->SetText ("Cubes count  : 0",    680, 560, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
     m_chunkText->SetText("Chunks count : 0",    680, 545, 12, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-
-    m_body = cardinal::PhysicsEngine::AllocateRigidbody();
 }
 
 /// \brief Destructor
@@ -53,8 +55,6 @@ World::~World() // NOLINT
     // TODO : Delete chunks
     delete[](m_chunks);
     delete[](m_worldHeights);
-
-    cardinal::PhysicsEngine::ReleaseRigidbody(m_body);
 }
 
 
@@ -65,7 +65,6 @@ void World::Initialize()
 {
     auto worldBegin = std::chrono::steady_clock::now();
 
-    WorldBuffers::Initialize();
     cardinal::Logger::LogInfo("Allocating chunks ....");
 
     m_worldHeights = new int*[WorldSettings::s_matSizeCubes];
@@ -94,18 +93,7 @@ void World::Initialize()
         }
     }
 
-    Chunk * neighbors[6];
-    for(int i = 0; i < WorldSettings::s_matSize; ++i)
-    {
-        for(int j = 0; j < WorldSettings::s_matSize; ++j)
-        {
-            for(int k = 0; k < WorldSettings::s_matHeight; ++k)
-            {
-                GetNeighbors(i, j, k, neighbors);
-                m_chunks[i][j][k]->SetNeighbors(neighbors);
-            }
-        }
-    }
+    LinkNeighbors();
 
     cardinal::Logger::LogInfo("%d chunks allocated",
                               WorldSettings::s_matSize *
@@ -133,6 +121,22 @@ void World::Initialize()
     cardinal::Logger::LogInfo("World generated in %d ms", elapsed);
 }
 
+void World::LinkNeighbors()
+{
+    Chunk * neighbors[6];
+    for(int i = 0; i < WorldSettings::s_matSize; ++i)
+    {
+        for(int j = 0; j < WorldSettings::s_matSize; ++j)
+        {
+            for(int k = 0; k < WorldSettings::s_matHeight; ++k)
+            {
+                GetNeighbors(i, j, k, neighbors);
+                m_chunks[i][j][k]->SetNeighbors(neighbors);
+            }
+        }
+    }
+}
+
 void World::GetNeighbors(int x, int y, int z, Chunk * neighbors[6])
 {
     if(x - 1 >= 0                        ) { neighbors[0] = m_chunks[x - 1][y][z]; } else { neighbors[0] = nullptr; }
@@ -145,7 +149,11 @@ void World::GetNeighbors(int x, int y, int z, Chunk * neighbors[6])
 
 void World::Batch()
 {
-    WorldBuffers::s_chunkPhysicalVertexBuffer.clear();
+    auto batchBegin = std::chrono::steady_clock::now();
+
+    // Flattening the chunks so that workers can pick them with a single counter
+    std::vector<Chunk *> chunks;
+    chunks.reserve(WorldSettings::s_matSize * WorldSettings::s_matSize * WorldSettings::s_matHeight);
 
     for(int i = 0; i < WorldSettings::s_matSize; ++i)
     {
@@ -153,35 +161,193 @@ void World::Batch()
         {
             for(int k = 0; k < WorldSettings::s_matHeight; ++k)
             {
-                m_chunks[i][j][k]->Batch();
+                chunks.push_back(m_chunks[i][j][k]);
             }
         }
     }
 
-    if (m_body->IsInitialized() == true)
-        cardinal::PhysicsEngine::ReleaseRigidbody(m_body);
+    size_t workerCount = BatchChunks(chunks);
+
+    size_t triangleCount = 0;
+    size_t colliderCount = 0;
+    size_t storageSize   = 0;
+    for(Chunk * pChunk : chunks)
+    {
+        triangleCount += pChunk->GetTerrainTriangleCount();
+        colliderCount += pChunk->GetCollider().HasBody() ? 1 : 0;
+        storageSize   += pChunk->GetStorageFootprint();
+    }
 
-    cardinal::VertexShape* shape = new cardinal::VertexShape(0);
+    auto batchEnd = std::chrono::steady_clock::now();
+    auto elapsed  = std::chrono::duration_cast<std::chrono::milliseconds>(batchEnd - batchBegin);
 
-    shape->SetTriangles(WorldBuffers::s_chunkPhysicalVertexBuffer);
+    cardinal::Logger::LogInfo("World batched in %d ms on %u workers (%s meshing, %u terrain triangles, %u colliders)",
+                              static_cast<int>(elapsed.count()),
+                              static_cast<unsigned>(workerCount),
+                              WorldSettings::s_greedyMeshing ? "greedy" : "per face",
+                              static_cast<unsigned>(triangleCount),
+                              static_cast<unsigned>(colliderCount));
 
-    m_body->SetShape(shape);
-    m_body->BuildPhysics(false);
-    m_body->SetRestitution(0);
-    cardinal::PhysicsEngine::AddRigidbody(m_body);
+    cardinal::Logger::LogInfo("Chunk cubes stored in %u KB (%u KB dense)",
+                              static_cast<unsigned>(storageSize / 1024),
+                              static_cast<unsigned>(chunks.size() * WorldSettings::s_chunkBlockCount * sizeof(ByteCube) / 1024));
 }
 
-void World::Clean()
+size_t World::BatchChunks(std::vector<Chunk *> const& chunks)
 {
-    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
-        for (int y = 0; y < WorldSettings::s_matSizeCubes; y++) 
+    if(chunks.empty())
+    {
+        return 0;
+    }
+
+    // Each job of the engine pool drains the chunks with its own scratch buffers
+    cardinal::WorkerPool & workerPool = cardinal::RenderingEngine::GetWorkerPool();
+    size_t workerCount = std::min(workerPool.GetThreadCount(), chunks.size());
+    if(m_buffers.size() < workerCount)
+    {
+        m_buffers.resize(workerCount);
+    }
+
+    // Upload stage : the GL context belongs to this thread
+    size_t uploadedCount = 0;
+    auto UploadChunk = [&uploadedCount](Chunk * pChunk)
+    {
+        pChunk->Upload();
+        uploadedCount++;
+    };
+
+    // Mesh stage : workers hand their chunks over to the calling thread.
+    // ParallelFor blocks, so the calling thread uploads from its own job,
+    // between two chunks it meshes itself.
+    const std::thread::id   uploadThread = std::this_thread::get_id();
+    std::atomic<size_t>     nextChunk(0);
+    std::mutex              batchedMutex;
+    std::condition_variable batchedCondition;
+    std::vector<Chunk *>    batchedChunks;
+
+    auto UploadBatchedChunks = [&](bool bWait)
+    {
+        std::vector<Chunk *> uploadQueue;
         {
-            m_worldHeights[x][y] = 0;
-            for (int z = 0; z < WorldSettings::s_matHeightCubes; z++) 
+            std::unique_lock<std::mutex> lock(batchedMutex);
+            if(bWait)
             {
-                ByteCube *cube = GetCube(x, y, z);
-                cube->SetType(ByteCube::EType::Air);
-                cube->Disable();
+                batchedCondition.wait(lock, [&batchedChunks]() { return !batchedChunks.empty(); });
             }
+
+            uploadQueue.swap(batchedChunks);
+        }
+
+        for(Chunk * pChunk : uploadQueue)
+        {
+            UploadChunk(pChunk);
         }
+    };
+
+    workerPool.ParallelFor(static_cast<int>(workerCount), [&](int nWorker)
+    {
+        WorldBuffers & buffers   = m_buffers[nWorker];
+        bool           bUploader = std::this_thread::get_id() == uploadThread;
+
+        for(size_t nChunk = nextChunk++; nChunk < chunks.size(); nChunk = nextChunk++)
+        {
+            chunks[nChunk]->Batch(buffers);
+
+            if(bUploader)
+            {
+                UploadChunk(chunks[nChunk]);
+                UploadBatchedChunks(false);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(batchedMutex);
+                batchedChunks.push_back(chunks[nChunk]);
+                batchedCondition.notify_one();
+            }
+        }
+
+        // The last chunks are still being meshed by the workers
+        while(bUploader && uploadedCount < chunks.size())
+        {
+            UploadBatchedChunks(true);
+        }
+    });
+
+    // The workers took every job before the calling thread could start one
+    while(uploadedCount < chunks.size())
+    {
+        UploadBatchedChunks(true);
+    }
+
+    // Batched chunks are only read until the next edition
+    if(WorldSettings::s_compressChunks)
+    {
+        for(Chunk * pChunk : chunks)
+        {
+            pChunk->Compress();
+        }
+    }
+
+    return workerCount;
+}
+
+void World::BatchChunk(int x, int y, int z)
+{
+    if(m_buffers.empty())
+    {
+        m_buffers.resize(1);
+    }
+
+    Chunk * pChunk = m_chunks[x][y][z];
+    pChunk->Batch(m_buffers[0]);
+    pChunk->Upload();
+
+    if(WorldSettings::s_compressChunks)
+    {
+        pChunk->Compress();
+    }
+}
+
+void World::Update(glm::vec3 const& position, float /* dt */)
+{
+    // Clamping keeps the closest chunks active when the character is out of the world
+    // The first chunk of the grid is the origin, the ChunkRegulator keeps the grid sorted
+    const float           chunkSize = WorldSettings::s_chunkSize * ByteCube::s_cubeSize;
+    const glm::tvec3<int> origin    = m_chunks[0][0][0]->GetChunkIndex();
+    const glm::tvec3<int> extent(WorldSettings::s_matSize - 1, WorldSettings::s_matSize - 1, WorldSettings::s_matHeight - 1);
+    const glm::tvec3<int> center    = glm::clamp(glm::tvec3<int>(glm::floor(position / chunkSize)), origin, origin + extent);
+    const int             distance  = static_cast<int>(WorldSettings::s_colliderDistance);
+
+    for(uint i = 0; i < WorldSettings::s_matSize; ++i)
+    {
+        for(uint j = 0; j < WorldSettings::s_matSize; ++j)
+        {
+            for(uint k = 0; k < WorldSettings::s_matHeight; ++k)
+            {
+                glm::tvec3<int> delta = m_chunks[i][j][k]->GetChunkIndex() - center;
+                bool bNear = std::abs(delta.x) <= distance &&
+                             std::abs(delta.y) <= distance &&
+                             std::abs(delta.z) <= distance;
+
+                m_chunks[i][j][k]->GetCollider().SetEnabled(bNear);
+            }
+        }
+    }
+}
+
+void World::Clean()
+{
+    for (int x = 0; x<WorldSettings::s_matSizeCubes; x++)
+        for (int y = 0; y < WorldSettings::s_matSizeCubes; y++)
+            m_worldHeights[x][y] = 0;
+
+    // Filling whole chunks keeps them compressed
+    ByteCube air;
+    air.SetType(ByteCube::EType::Air);
+    air.Disable();
+
+    for (int x = 0; x < WorldSettings::s_matSize; x++)
+        for (int y = 0; y < WorldSettings::s_matSize; y++)
+            for (int z = 0; z < WorldSettings::s_matHeight; z++)
+                m_chunks[x][y][z]->Fill(air);
 }
@@ -24,37 +24,20 @@
 #include "World/WorldBuffers.hpp"
 #include "World/WorldSettings.hpp"
 
-// Terrain
-/* static */ std::vector<glm::vec2>  WorldBuffers::s_chunkUVsBuffer;
-/* static */ std::vector<glm::vec3>  WorldBuffers::s_chunkVertexBuffer;
-/* static */ std::vector<glm::vec3>  WorldBuffers::s_chunkPhysicalVertexBuffer;
-/* static */ std::vector<ushort>     WorldBuffers::s_chunkIndexesBuffer;
-/* static */ std::vector<glm::vec2>  WorldBuffers::s_chunkIndexedUVsBuffer;
-/* static */ std::vector<glm::vec3>  WorldBuffers::s_chunkIndexedVertexBuffer;
-/* static */ std::vector<glm::vec3>  WorldBuffers::s_chunkNormalBuffer;
-/* static */ std::vector<glm::vec3>  WorldBuffers::s_chunkIndexedNormalBuffer;
-
-// Details
-/* static */ std::vector<Grass> WorldBuffers::s_grassBuffer;
-
-/// \brief Initializes all world buffers
-/* static */ void WorldBuffers::Initialize()
+/// \brief Constructor, reserves all buffers
+WorldBuffers::WorldBuffers()
 {
-    cardinal::Logger::LogInfo("Initializing static buffers ...");
+    m_chunkVertexBuffer = std::vector<glm::vec3>(WorldSettings::s_chunkVertexCount);
+    m_chunkUVsBuffer    = std::vector<glm::vec2>(WorldSettings::s_chunkVertexCount);
 
-    s_chunkVertexBuffer = std::vector<glm::vec3>(WorldSettings::s_chunkVertexCount);
-    s_chunkUVsBuffer    = std::vector<glm::vec2>(WorldSettings::s_chunkVertexCount);
+    m_chunkIndexesBuffer.reserve       (WorldSettings::s_chunkVertexCount);
+    m_chunkPhysicalVertexBuffer.reserve(WorldSettings::s_chunkVertexCount);
+    m_chunkIndexedUVsBuffer.reserve    (WorldSettings::s_chunkUVsCount);
+    m_chunkIndexedVertexBuffer.reserve (WorldSettings::s_chunkVertexCount);
 
-    s_chunkIndexesBuffer.reserve       (WorldSettings::s_chunkVertexCount);
-    s_chunkPhysicalVertexBuffer.reserve(WorldSettings::s_chunkVertexCount);
-    s_chunkIndexedUVsBuffer.reserve    (WorldSettings::s_chunkUVsCount);
-    s_chunkIndexedVertexBuffer.reserve (WorldSettings::s_chunkVertexCount);
-
-    s_chunkNormalBuffer.reserve(WorldSettings::s_chunkVertexCount);
-    s_chunkIndexedNormalBuffer.reserve(WorldSettings::s_chunkVertexCount);
+    m_chunkNormalBuffer.reserve(WorldSettings::s_chunkVertexCount);
+    m_chunkIndexedNormalBuffer.reserve(WorldSettings::s_chunkVertexCount);
 
     // Details
-    WorldBuffers::s_grassBuffer.reserve(WorldSettings::s_chunkBlockCount * 2);
-
-    cardinal::Logger::LogInfo("World static buffers initialized");
-}
+    m_grassBuffer.reserve(WorldSettings::s_chunkBlockCount * 2);
+}
\ No newline at end of file